@@ -1,18 +1,95 @@
 #pragma once
 
 #include "stm32h7xx_hal.h"
+#include "dma_buffer.hpp"
+#include "panel.hpp"
+#include "row_hash.hpp"
 #include <cstdint>
 
+/// @brief ST7789 SPI屏驱动，几何尺寸和初始化序列来自面板描述符
+/// @note  每个实例独占自己的SPI句柄（及其链接的DMA流）和填充缓冲区，
+///        不同SPI上的多块屏可以同时刷新；SPI发送完成中断经dispatch_tx_complete()分发到对应实例
 class ST7789 {
     public:
-        ST7789(SPI_HandleTypeDef* hspi,
+        static constexpr uint8_t MAX_PANELS {2};
+
+        static constexpr uint8_t MAX_TRANSFERS {16};
+        static constexpr uint8_t TX_WINDOW {0x01};   // 元素在像素前先设置窗口
+        static constexpr uint16_t EXPAND_PIXELS {480};  // 8位索引元素的展开行缓冲（每块最多像素数）
+
+        /// @brief 像素DMA的总线访问方式（由慢到快）
+        /// @note  每次DMA按源地址和长度选不超过上限的最快方式，不满足对齐的区域自动退回
+        enum class DmaMode : uint8_t {
+            Halfword,   // 每个像素一次DMA请求，16位单次读（CubeMX默认配置）
+            Packed,     // DMA FIFO + 32位读写，SPI数据打包：每次请求两个像素（源4字节对齐、偶数像素）
+            Burst,      // 同上，存储器端4拍突发读16字节（源16字节对齐、8像素整数倍）
+        };
+
+        /// @brief 传输链表的一个元素：可选的窗口命令 + 像素
+        /// @note  stride为0时src是count个连续像素；否则每行(x1-x0+1)个像素、行距stride，
+        ///        每行一次DMA，帧缓冲区里的任意矩形不用拷贝就能发送。
+        ///        不带TX_WINDOW的元素接着上一个窗口继续写（RAMWR按窗口自动换行）。
+        ///        lut非空时src是8位调色板索引：中断里按块查表展开成RGB565到行缓冲再DMA，
+        ///        发送当前块的同时展开下一块
+        struct Transfer {
+            uint16_t x0;        // 窗口，含端点，可见区域坐标
+            uint16_t y0;
+            uint16_t x1;
+            uint16_t y1;
+            const void* src;    // RGB565像素，或lut非空时的8位索引
+            uint32_t count;     // 像素数
+            uint16_t stride;    // 源行距（像素），0 = 连续
+            uint8_t flags;
+            const uint16_t* lut;  // 调色板（RGB565），nullptr = src已是RGB565
+        };
+
+        /// @brief 一条链表的耗时（DWT周期）
+        struct ListStats {
+            uint32_t total_cycles;  // 启动到最后一个DMA完成
+            uint32_t gap_cycles;    // DMA空闲：窗口命令和中断里切换元素的时间
+            uint32_t pixels;
+            uint8_t elements;
+        };
+
+        /// @brief 增量模式下一次整帧发送的统计
+        struct DeltaStats {
+            uint16_t rows_changed;  // 和上一帧不同的行
+            uint16_t rows_sent;     // 实际发送的行（含合并进来的未变行）
+            uint8_t spans;          // 窗口数，0 = 整帧未变，没有发送
+            uint32_t bytes_saved;   // 比整帧少发的像素字节
+            uint32_t hash_cycles;   // 逐行CRC和比较的耗时
+        };
+
+        /// @param fill_buffers fill_screen系列使用的两帧缓冲区（2 * panel.pixels() 个像素）
+        ST7789(const lcd::Panel& panel, SPI_HandleTypeDef* hspi,
             GPIO_TypeDef* dc_port, uint16_t dc_pin,
-            GPIO_TypeDef* bl_port, uint16_t bl_pin);
+            GPIO_TypeDef* bl_port, uint16_t bl_pin,
+            uint16_t* fill_buffers);
+
+        const lcd::Panel& panel() const { return panel_; }
+        uint16_t width() const { return panel_.width; }
+        uint16_t height() const { return panel_.height; }
+        SPI_HandleTypeDef* spi() const { return hspi_; }
 
         void init_basic();
         void fill_screen(uint16_t color);
         void fill_screen_dma(uint16_t color);  // ⭐ DMA纯色填充
         void transmit_buffer_dma(uint16_t* buffer);  // ⭐ DMA传输framebuffer
+        void transmit_buffer_dma(DmaBuffer& buffer);  // 只清理脏缓存行后DMA传输
+        void transmit_list_dma(DmaBuffer& buffer, const Transfer* list, uint8_t count);  // 局部刷新：清理脏缓存行后发送链表
+        /// @brief  异步发送传输链表（复制到内部，调用者无需保留），中断逐个元素发送
+        /// @return 正在发送或元素过多时返回false
+        bool transmit_list(const Transfer* list, uint8_t count);
+        bool is_busy() const { return is_transmitting_; }
+        void set_dma_mode(DmaMode max);  // 像素DMA方式的上限（对比测试用），默认Burst
+        DmaMode dma_mode() const { return dma_mode_max_; }
+        const ListStats& last_list_stats() const { return last_stats_; }  // 最近一条已完成的链表
+        /// @brief 整帧发送（transmit_buffer_dma / fill_screen_dma）的增量模式：
+        ///        用CRC单元逐行计算哈希，和上一帧比较，只发送变化的行（连续的行合并成一个窗口）
+        /// @note  适合应用自己画整帧、不知道哪里变了的情况；其他方式写屏后下一帧自动整帧发送
+        void set_delta_mode(bool on);
+        bool delta_mode() const { return delta_mode_; }
+        const DeltaStats& last_delta_stats() const { return delta_stats_; }
         void update_from_buffer(uint16_t* buffer);  // ⭐ 轮询传输framebuffer
         void display_test_colors();
         // color cycle animation
@@ -25,6 +102,7 @@ class ST7789 {
         
         // DMA回调
         void dma_tx_cplt_callback();
+        static void dispatch_tx_complete(SPI_HandleTypeDef* hspi);  // 按SPI句柄找到实例并调用其回调
 
     private:
         void write_cmd(uint8_t cmd);
@@ -32,8 +110,23 @@ class ST7789 {
         void write_data_16bit(uint16_t data);
         void write_data_buf(uint16_t* buf, uint16_t size);
         void set_addr_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+        void set_window_16bit(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
         void spi_set_datasize(uint16_t datasize);
+        void start_frame_dma(uint16_t* buffer);
+        bool start_list(const Transfer* list, uint8_t count);
+        void wait_idle();
+        void start_element();
+        void send_chunk();
+        uint16_t chunk_len() const;
+        void advance(uint16_t n);
+        void expand_chunk(uint8_t buf, const uint8_t* ptr, uint16_t n);
+        void dma_start(const uint16_t* ptr, uint16_t n);
+        void dma_configure(DmaMode mode);
+
+        static ST7789* instances_[MAX_PANELS];
+        static uint8_t instance_count_;
 
+        const lcd::Panel& panel_;
         SPI_HandleTypeDef* hspi_;
         GPIO_TypeDef* dc_port_;
         uint16_t dc_pin_;
@@ -41,10 +134,27 @@ class ST7789 {
         uint16_t bl_pin_;
         
         // 双缓冲相关
+        uint16_t* fill_buffers_[2];
         uint16_t* current_buffer_;
         volatile bool is_transmitting_;
         
-        // DMA传输状态
-        uint8_t dma_chunk_count_;     // 当前chunk计数器(0或1)
-        uint16_t* dma_next_ptr_;      // 下一个chunk的指针
+        // 传输链表状态（中断中推进），单次DMA不超过面板描述符的分块大小
+        Transfer list_[MAX_TRANSFERS];
+        uint8_t list_count_;
+        uint8_t list_idx_;            // 正在发送的元素
+        const uint8_t* dma_next_ptr_;   // 当前元素下一个chunk（或下一行）的指针
+        uint8_t pixel_bytes_;         // 当前元素源像素的字节数：2 = RGB565，1 = 索引
+        uint16_t* expand_[2];         // 索引展开的两块行缓冲（D2 SRAM，DMA可访问）
+        uint8_t expand_idx_;          // 下一次发送用的行缓冲
+        bool expand_ready_;           // 下一块已经展开在expand_[expand_idx_]中
+        uint32_t dma_remaining_;      // 当前元素剩余像素
+        uint32_t list_start_;         // 链表启动时的DWT计数
+        uint32_t gap_start_;          // 上一个DMA结束（或链表启动）时的DWT计数
+        ListStats list_stats_;        // 正在发送的链表
+        ListStats last_stats_;
+        DmaMode dma_mode_max_;
+        DmaMode dma_mode_;            // DMA流当前的配置
+        bool delta_mode_;
+        RowHash row_hash_;            // 屏上当前内容的逐行哈希
+        DeltaStats delta_stats_;
 };
@@ -0,0 +1,75 @@
+/// @file    accel2d.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    enum class Backend : uint8_t {
+        Dma2d,      // Chrom-ART, operations run asynchronously
+        Software,   // CPU loops, same arithmetic as the DMA2D
+    };
+
+    /// @brief  RGB565 fill / copy / A8-A4 mask blend on DMA2D with a CPU fallback
+    /// @note   strides are in pixels. On the DMA2D backend an operation only starts
+    ///         the transfer, the CPU is free until wait() (or the next operation).
+    ///         Sources (copy source, masks) must already be clean in memory, e.g. by
+    ///         mpu::clean_for_dma() once after they were drawn. Destinations are
+    ///         handled here: clean-invalidated before, invalidated after the transfer,
+    ///         so the CPU must not write them while an operation is in flight.
+    ///         DMA2D cannot reach DTCM/ITCM, such operations run on the CPU.
+    class Accel2D {
+        public:
+            explicit Accel2D(Backend backend = Backend::Dma2d);
+
+            Backend backend() const { return backend_; }
+            /// @brief switch backend, waits for a pending DMA2D operation
+            void set_backend(Backend backend);
+
+            /// @brief  fill a w x h rectangle with one colour (register-to-memory)
+            void fill(uint16_t* dst, uint32_t dst_stride, uint16_t w, uint16_t h, uint16_t color);
+
+            /// @brief  copy a w x h rectangle (memory-to-memory)
+            void copy(uint16_t* dst, uint32_t dst_stride,
+                      const uint16_t* src, uint32_t src_stride, uint16_t w, uint16_t h);
+
+            /// @brief  blend a solid colour through an 8-bit alpha mask onto dst
+            void blend_a8(uint16_t* dst, uint32_t dst_stride,
+                          const uint8_t* mask, uint32_t mask_stride,
+                          uint16_t w, uint16_t h, uint16_t color);
+
+            /// @brief  blend a solid colour through a 4-bit alpha mask onto dst
+            /// @note   two pixels per byte, first pixel in the low nibble;
+            ///         w and mask_stride must be even
+            void blend_a4(uint16_t* dst, uint32_t dst_stride,
+                          const uint8_t* mask, uint32_t mask_stride,
+                          uint16_t w, uint16_t h, uint16_t color);
+
+            /// @brief true while a DMA2D operation is running
+            bool busy() const;
+            /// @brief block until the pending operation is done and visible to the CPU
+            void wait();
+
+            /// @brief DMA2D transfer or configuration errors seen so far
+            uint32_t error_count() const { return errors_; }
+
+            /// @brief software RGB565 blend, the DMA2D arithmetic for an opaque background
+            static uint16_t blend_pixel(uint16_t bg, uint16_t fg, uint8_t alpha);
+
+        private:
+            bool use_dma2d(const void* a, const void* b = nullptr) const;
+            void start(uint32_t mode, uint16_t* dst, uint32_t dst_stride, uint16_t w, uint16_t h);
+            void blend_dma2d(uint16_t* dst, uint32_t dst_stride, const uint8_t* mask,
+                             uint32_t mask_stride, uint16_t w, uint16_t h, uint16_t color, uint32_t cm);
+
+            Backend backend_;
+            bool pending_;
+            uint32_t errors_;
+            // destination of the pending transfer, invalidated by wait()
+            uint16_t* pend_dst_;
+            uint32_t pend_stride_;
+            uint16_t pend_w_;
+            uint16_t pend_h_;
+    };
+
+} // namespace gfx
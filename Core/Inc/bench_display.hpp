@@ -0,0 +1,21 @@
+/// @file    bench_display.hpp
+#pragma once
+#include "main.hpp"
+#include "ST7789.hpp"
+#include <cstdint>
+
+namespace bench {
+    namespace display {
+
+        /// @brief  push full frames from SDRAM to the panel with every ST7789::DmaMode,
+        ///         print frame time and SPI utilization (wire time / frame time), then
+        ///         repeat while the CPU copies blocks inside SDRAM and print how much
+        ///         copy throughput the pixel stream costs the renderer; finally redraw
+        ///         whole frames with a small moving square and compare sending them whole
+        ///         against ST7789 delta mode (changed rows only)
+        /// @note   uses the SDRAM scratch window bench::sdram::DEFAULT_BASE, must run
+        ///         before ClockApp; leaves the DMA mode limit at Burst, delta mode off
+        void run_report(ST7789& lcd);
+
+    } // namespace display
+} // namespace bench
@@ -0,0 +1,25 @@
+/// @file    bench_gfx.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace bench {
+    namespace gfx2d {
+
+        /// @brief  run the ClockApp frame operations (fill, dial restore, hand band
+        ///         restore, A8/A4 sprite blends) on the software and DMA2D backends,
+        ///         print cycles per operation and the number of differing pixels;
+        ///         then check the CPU blend against DMA2D for every alpha value over
+        ///         a set of foreground and background colours
+        /// @note   uses the SDRAM scratch window bench::sdram::DEFAULT_BASE, must run
+        ///         before ClockApp
+        void run_report();
+
+        /// @brief  rotozoom a 128x128 texture into an RGB565 frame at several scales
+        ///         with nearest, bilinear and bilinear + alpha-mask sampling, print
+        ///         destination Mpx/s averaged over a set of angles
+        /// @note   same SDRAM scratch window as run_report()
+        void run_rotozoom_report();
+
+    } // namespace gfx2d
+} // namespace bench
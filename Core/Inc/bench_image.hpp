@@ -0,0 +1,17 @@
+/// @file    bench_image.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace bench {
+    namespace image {
+
+        /// @brief  Q565 decode of the dial face against copying the same number of raw
+        ///         bytes out of flash (newlib memcpy and fastmem::copy)
+        /// @note   MB/s of decoded output, caches flushed before every run. Decodes into
+        ///         the SDRAM scratch window bench::sdram::DEFAULT_BASE and band by band
+        ///         into AXI SRAM; must run before ClockApp.
+        void run_report();
+
+    } // namespace image
+} // namespace bench
@@ -0,0 +1,25 @@
+/// @file    bench_mem.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace bench {
+    namespace mem {
+
+        /// @brief one memory under test
+        struct Region {
+            const char* name;
+            uint8_t* base;      // scratch start, contents are destroyed
+            uint32_t bytes;     // source and destination use bytes / 2 each
+        };
+
+        /// @brief  fastmem kernels against newlib on DTCM, AXI SRAM and SDRAM
+        /// @note   DWT cycles, D-Cache on, caches flushed before every run.
+        ///         Must run before ClockApp, the SDRAM window is bench::sdram::DEFAULT_BASE.
+        void run_report();
+
+        /// @brief  same table for a single region
+        void run_region(const Region& r);
+
+    } // namespace mem
+} // namespace bench
@@ -0,0 +1,46 @@
+/// @file    bench_sdram.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace bench {
+    namespace sdram {
+
+        /// @brief default scratch window, placed after the ClockApp frame buffers
+        constexpr uint32_t DEFAULT_BASE  {0xC0100000};
+        /// @brief default window size, large enough to defeat the 16KB D-Cache
+        constexpr uint32_t DEFAULT_BYTES {1024 * 1024};
+
+        /// @brief throughput of bytes moved in cycles, MB/s x10 (all benchmarks report in it)
+        inline uint32_t to_mbps_x10(uint64_t bytes, uint32_t cycles) {
+            if (cycles == 0) return 0;
+            return (uint32_t)(bytes * SystemCoreClock / cycles / 100000U);
+        }
+
+        /// @brief throughput figures for one cache state, MB/s x10
+        struct Report {
+            bool dcache_on;
+            uint32_t write_mbps_x10[4];     // 8/16/32/64-bit sequential stores
+            uint32_t read_mbps_x10[4];      // 8/16/32/64-bit sequential loads
+            uint32_t copy_mbps_x10[4];      // 8/16/32/64-bit word copy loop
+            uint32_t memcpy_mbps_x10;       // newlib memcpy
+            uint32_t mdma_mbps_x10;         // MDMA SDRAM -> SDRAM, incl. cache maintenance, 0 on failure
+            uint32_t latency_cycles_x10;    // random dependent load, per access
+        };
+
+        /// @brief  measure one cache state over the given window
+        /// @param  base  start address of the scratch window (contents are destroyed)
+        /// @param  bytes window size, source and destination use 2 x bytes
+        /// @param  dcache_on run with D-Cache enabled or disabled
+        /// @return measured figures
+        /// @note   D-Cache state is restored to enabled on return
+        Report measure(uint32_t base, uint32_t bytes, bool dcache_on);
+
+        /// @brief run the full suite (D-Cache on and off) and print a compact report
+        /// @param base  start address of the scratch window (contents are destroyed)
+        /// @param bytes window size, source and destination use 2 x bytes
+        /// @note  must run before ClockApp, it takes over the SDRAM and the cache
+        void run_report(uint32_t base = DEFAULT_BASE, uint32_t bytes = DEFAULT_BYTES);
+
+    } // namespace sdram
+} // namespace bench
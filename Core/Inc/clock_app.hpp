@@ -2,63 +2,158 @@
 
 #include "stm32h7xx_hal.h"
 #include "ST7789.hpp"
+#include "accel2d.hpp"
+#include "compositor.hpp"
+#include "scene.hpp"
+#include "font.hpp"
+#include "sprite_cache.hpp"
+#include "frame_governor.hpp"
+#include "frame_pacer.hpp"
+#include "timebase.hpp"
 #include <cstdint>
 
+/// @brief 主循环空闲时调用的后台任务（例如SDRAM自检）
+using IdleTask = void (*)();
+
 /// @brief 基于DMA双缓冲的秒表应用（平滑指针）
+/// @note  表盘是启动时解码的压缩图片；指针、进度条是保留模式的场景节点，每帧只更新节点状态，
+///        由场景算出变化区域、合成器只重画这些区域。秒表停止时没有变化，不绘制也不发送。
+///        表盘下半部的数字读数用预合成的字形单元拼出，FPS/CPU显示在屏幕底部。
+///        指针在启动时按量化角度预渲染成精灵遮罩，每帧不再做三角运算和抗锯齿光栅化。
+///        帧缓冲区是8位调色板索引（内存和SDRAM带宽减半），发送时逐块查表展开成RGB565。
+///        毫秒针和轨迹每帧都在动，画在半分辨率画布上（AXI SRAM），合成时放大两倍；其余图层保持全分辨率。
+///        帧预算调节器在渲染或传输超出10ms时逐级降低画质（见Quality），有余量时逐级恢复。
+///        帧节拍模式下每次屏刷新画一帧，按扫描位置选发送时机，扫描线不穿过正在写的行（无撕裂）。
+///        晚锁存模式下秒表时间在更新场景前才采样，并外推到这一帧扫描到屏上的时刻。
 class ClockApp {
 public:
     ClockApp(ST7789* lcd);
     
+    void set_idle_task(IdleTask task);  // 注册后台任务，每次主循环空闲时执行一步
+    bool attach_te(GPIO_TypeDef* port, uint16_t pin);  // 屏的TE信号接到的EXTI引脚（5..15）
+    void set_frame_pacing(bool on);     // 帧节拍：跟随屏刷新（有TE时同步，否则按标称刷新率估计）
+    void set_late_latch(bool on);       // 晚锁存：画面时间 = 预测的上屏时刻
+    void set_profile_report(bool on);   // 启动时在三种帧缓冲区MPU属性下跑同一段帧循环，打印耗时对比
+    
     void start();   // 启动秒表
     void stop();    // 停止秒表
     void reset();   // 重置秒表
     void run();     // 主循环
     
 private:
-    static constexpr uint16_t WIDTH = 240;
-    static constexpr uint16_t HEIGHT = 280;
+    static constexpr uint16_t WIDTH = lcd::panels::st7789_240x280.width;
+    static constexpr uint16_t HEIGHT = lcd::panels::st7789_240x280.height;
     static constexpr uint16_t CENTER_X = 120;
     static constexpr uint16_t CENTER_Y = 140;
     static constexpr uint16_t RADIUS = 100;
+    static constexpr uint32_t FRAME_MS = 10;        // 帧周期（100 FPS），也是帧预算
+    static constexpr uint32_t SLOW_HAND_MS = 500;   // 降级时秒针和进度条的刷新周期
+    static constexpr uint8_t FAST_SHIFT = 1;        // 快速图层（毫秒针）的缩小倍数：1 = 半分辨率
+    
+    // 指针（按绘制顺序），用作精灵缓存和节点数组的下标
+    enum Hand : uint8_t { SEC, MIN, TRAIL_FAR, TRAIL_NEAR, MS, HAND_COUNT };
     
-    // 双缓冲区（在SDRAM中）
-    uint16_t* buffer_[2];
+    // 画质等级，超预算时按顺序降级（每级包含前面各级）
+    enum Quality : uint8_t {
+        Q_FULL,         // 全部效果
+        Q_NO_TRAILS,    // 去掉毫秒针的运动模糊轨迹
+        Q_NO_AA,        // 指针和中心装饰不做抗锯齿
+        Q_SLOW_HANDS,   // 秒针和进度条每SLOW_HAND_MS才更新
+        QUALITY_COUNT
+    };
+    
+    // 双缓冲区（在SDRAM中，8位调色板索引，发送时展开成RGB565）
+    uint8_t* frame_[2];
+    gfx::Palette palette_;
     uint8_t current_buffer_idx_;
     
-    // 静态表盘缓冲区（暂时仍在SDRAM，内存配置待优化）
+    gfx::DamageList written_;    // 本帧合成写过的区域，只把这些区域发送到屏幕
+    gfx::Accel2D accel_;         // 读数的字形单元拷贝和表盘图片损坏时的背景填充（DMA2D，可切换到CPU）
+    
+    // 静态表盘缓冲区（SDRAM，只作为合成的底图读取）
     uint16_t* static_dial_;
     
+    // 图层：静态表盘 / 数字读数 / 毫秒针画布（半分辨率） / 指针画布 / HUD（统计+秒进度条），
+    // 由合成器只在脏区内逐行合成到发送缓冲区
+    gfx::BitmapLayer dial_layer_;
+    gfx::BitmapLayer readout_layer_;
+    gfx::CanvasLayer fast_layer_;
+    gfx::CanvasLayer hand_layer_;
+    gfx::CanvasLayer hud_layer_;
+    gfx::Compositor compositor_;
+    
+    // 场景：毫秒针和轨迹（fast_layer_）、秒针分针（hand_layer_）与进度条（hud_layer_）
+    gfx::Scene fast_scene_;
+    gfx::Scene hand_scene_;
+    gfx::Scene hud_scene_;
+    gfx::CapsuleNode sec_hand_;
+    gfx::CapsuleNode min_hand_;
+    gfx::LineNode ms_trail_[2];  // 毫秒指针的运动模糊轨迹
+    gfx::CapsuleNode ms_hand_;
+    gfx::SpriteCache hand_cache_[HAND_COUNT];   // 每根指针按量化角度预渲染的遮罩（SDRAM）
+    gfx::SpriteNode hand_sprite_[HAND_COUNT];   // 场景中实际使用的指针节点（缓存建好时）
+    gfx::CircleNode hub_;
+    gfx::CircleNode hub_cap_;
+    gfx::CapsuleNode hud_track_;
+    gfx::CapsuleNode hud_fill_;
+    gfx::TextNode fps_text_;
+    gfx::TextNode cpu_text_;
+    
+    // 数字读数 "MM:SS.mmm"：字形单元预先合成在表盘底色上，每帧只拷贝变化的字符（DMA2D）
+    gfx::GlyphCache readout_cache_;
+    char readout_text_[12];
+    int16_t readout_x0_;         // 上次读数的起始位置（面板内）
+    
     ST7789* lcd_;
+    IdleTask idle_task_;
     
-    // 秒表状态
+    // 秒表状态（64位时基计时，不受DWT计数器回绕限制）
     bool is_running_;
-    uint32_t elapsed_ms_;  // 已过时间（毫秒）
-    uint32_t last_update_tick_;
+    uint64_t elapsed_cycles_;       // 已过时间（CPU周期）
+    uint64_t last_update_cycles_;
+    uint64_t frame_us_;             // 本帧画面表示的秒表时间（微秒）
+    
+    // 晚锁存：采样到链表就绪的耗时（滑动平均），用来预测上屏时刻
+    struct LatchStats {
+        uint32_t frames;
+        uint32_t lead_us_sum;       // 采样时外推的提前量
+        uint32_t error_us_sum;      // |画面时间 - 上屏时刻的真实时间|
+        uint32_t jitter_us_sum;     // 相邻两帧误差之差（画面时间步长 - 上屏间隔）
+        uint32_t jitter_us_max;
+    };
+    bool late_latch_;
+    uint32_t render_cycles_;
+    LatchStats latch_stats_;
+    int32_t last_error_us_;
+    bool have_last_error_;
     
     // CPU占用率统计
-    uint32_t last_cpu_calc_tick_;
+    uint64_t cpu_window_start_;     // 统计窗口起点（时基周期）
     uint32_t busy_time_us_;
+    uint32_t frames_sent_;  // 统计周期内实际发送的帧数
     float cpu_usage_;
     
-    // 绘制函数
-    void draw_to_buffer(uint16_t* fb);
-    void render_static_dial();  // 预渲染静态表盘（只调用一次）
-    void draw_pointers_only(uint16_t* fb);  // 只绘制指针到缓冲区
-    
-    // 图形绘制基础函数
-    void set_pixel(uint16_t* fb, uint16_t x, uint16_t y, uint16_t color);
-    void set_pixel_aa(uint16_t* fb, uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
-    void draw_line(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
-    void draw_line_aa(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
-    void draw_thick_line(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t thickness, uint16_t color);
-    void draw_thick_line_aa(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t thickness, uint16_t color);
-    void draw_circle(uint16_t* fb, uint16_t cx, uint16_t cy, uint16_t r, uint16_t color);
-    void fill_circle(uint16_t* fb, uint16_t cx, uint16_t cy, uint16_t r, uint16_t color);
-    
-    // 辅助函数
-    uint16_t blend_color(uint16_t fg, uint16_t bg, uint8_t alpha);
-    
-    // 查表sin/cos
-    int16_t get_sin(uint16_t angle);
-    int16_t get_cos(uint16_t angle);
+    FrameGovernor governor_;        // 帧预算调节器（渲染 / 传输耗时 -> 画质等级）
+    FramePacer pacer_;              // 帧节拍（屏扫描位置 -> 发送时机）
+    bool pacing_;
+    bool profile_report_;
+    
+    void render_static_dial();          // 解码静态表盘图片（只调用一次）
+    void build_palette();               // 由表盘颜色和配色过渡生成调色板（只调用一次）
+    void build_hand_sprites();          // 预渲染指针精灵并组建指针场景（只调用一次）
+    gfx::Node* hand_shape(Hand hand);   // 指针的矢量形状（精灵缓存的来源）
+    static bool is_fast(Hand hand) { return hand == MS || hand == TRAIL_FAR || hand == TRAIL_NEAR; }
+    gfx::CanvasLayer& hand_canvas(Hand hand) { return is_fast(hand) ? fast_layer_ : hand_layer_; }
+    void set_hand(Hand hand, float degrees);
+    void apply_quality();               // 把调节器的等级应用到场景节点
+    void advance_clock();               // 把上次以来的周期数累加到已过时间
+    uint32_t elapsed_ms() const { return (uint32_t)(timebase::to_us(elapsed_cycles_) / 1000); }
+    uint32_t predict_lead(uint64_t latch) const;    // 采样时刻到上屏时刻的预测周期数
+    void record_present(uint64_t latch, uint64_t present);  // 统计画面时间相对上屏时刻的误差
+    void update_scene();                // 根据frame_us_更新节点状态
+    gfx::Rect update_readout();         // 更新数字读数，返回变化区域
+    bool render_frame(uint8_t idx);     // 重画变化区域到缓冲区idx，无变化返回false
+    uint8_t build_transfers(uint8_t idx, ST7789::Transfer* list) const;  // 写过的区域 -> 传输链表
+    uint32_t pace(const ST7789::Transfer* list, uint8_t count, uint64_t input);  // 等到不撕裂的时机，返回等待的周期
+    void compare_mpu_profiles();        // 各MPU帧缓冲区属性下的帧循环耗时（启动时调用一次）
 };
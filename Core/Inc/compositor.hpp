@@ -0,0 +1,175 @@
+/// @file    compositor.hpp
+#pragma once
+#include "main.hpp"
+#include "surface.hpp"
+#include "palette.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief  small set of disjoint screen rectangles
+    /// @note   an added rectangle absorbs every one it overlaps; when the list is full
+    ///         everything collapses into the bounding box
+    struct DamageList {
+        static constexpr uint8_t MAX_RECTS {8};
+
+        Rect rects[MAX_RECTS];
+        uint8_t count;
+
+        void clear() { count = 0; }
+        bool empty() const { return count == 0; }
+        /// @brief add a rectangle, empty ones are ignored
+        void add(Rect r);
+        /// @brief bounding box of all rectangles
+        Rect bounds() const;
+    };
+
+    /// @brief one compositor layer: bounds, global alpha and a span renderer
+    class Layer {
+        public:
+            explicit Layer(const Rect& bounds, uint8_t alpha = 255);
+            virtual ~Layer() = default;
+
+            const Rect& bounds() const { return bounds_; }
+            void set_bounds(const Rect& bounds) { bounds_ = bounds; }
+            uint8_t alpha() const { return alpha_; }
+            void set_alpha(uint8_t alpha) { alpha_ = alpha; }
+            bool visible() const { return visible_ && alpha_ != 0; }
+            void set_visible(bool visible) { visible_ = visible; }
+
+            /// @brief true when every pixel of the bounds is written fully opaque
+            bool opaque() const { return alpha_ == 255 && content_opaque(); }
+
+            /// @brief  merge row y, columns [x0, x1) onto line
+            /// @param  line indexed by absolute x; x0/x1/y lie inside bounds()
+            virtual void render_span(uint16_t* line, int16_t y, int16_t x0, int16_t x1) const = 0;
+
+        protected:
+            virtual bool content_opaque() const { return false; }
+
+        private:
+            Rect bounds_;
+            uint8_t alpha_;
+            bool visible_;
+    };
+
+    /// @brief RGB565 image, opaque unless the layer alpha is below 255 (e.g. cached background)
+    class BitmapLayer : public Layer {
+        public:
+            /// @param pixels top-left pixel of bounds, stride in pixels
+            BitmapLayer(const Rect& bounds, const uint16_t* pixels, uint32_t stride, uint8_t alpha = 255);
+
+            void render_span(uint16_t* line, int16_t y, int16_t x0, int16_t x1) const override;
+
+        protected:
+            bool content_opaque() const override { return true; }
+
+        private:
+            const uint16_t* pixels_;
+            uint32_t stride_;
+    };
+
+    /// @brief RGB565 + 8-bit coverage drawing surface (dynamic sprites, vectors, HUD)
+    /// @note  coverage 0 is transparent. The planes cover the bounds at full resolution,
+    ///        or at half resolution with scale_shift 1 (bounds on even coordinates):
+    ///        nodes are then drawn in canvas coordinates (screen / 2) and render_span()
+    ///        doubles every pixel and line on its way into the compositor, so fast
+    ///        content costs a quarter of the drawing and memory while the layers
+    ///        around it stay sharp.
+    class CanvasLayer : public Layer {
+        public:
+            CanvasLayer(const Rect& bounds, uint16_t* pixels, uint8_t* coverage, uint8_t alpha = 255,
+                        uint8_t scale_shift = 0);
+
+            uint16_t* pixels() const { return pixels_; }
+            uint8_t* coverage() const { return coverage_; }
+            uint8_t scale_shift() const { return shift_; }
+            uint16_t width() const { return (uint16_t)(bounds().w >> shift_); }
+            uint16_t height() const { return (uint16_t)(bounds().h >> shift_); }
+            /// @brief the planes in canvas coordinates (the bounds at full resolution)
+            Rect area() const {
+                return {(int16_t)(bounds().x >> shift_), (int16_t)(bounds().y >> shift_), width(), height()};
+            }
+            /// @brief screen rectangle covered by a canvas rectangle
+            Rect to_screen(const Rect& r) const {
+                return {(int16_t)(r.x << shift_), (int16_t)(r.y << shift_),
+                        (uint16_t)(r.w << shift_), (uint16_t)(r.h << shift_)};
+            }
+            /// @brief colour / coverage planes as surfaces in canvas coordinates
+            Surface565 surface() const { return {pixels_, width(), height(), width(), area().x, area().y}; }
+            SurfaceA8 coverage_surface() const { return {coverage_, width(), height(), width(), area().x, area().y}; }
+
+            /// @brief make rows [y0, y1] (plane rows, inclusive) transparent
+            void clear_rows(uint16_t y0, uint16_t y1);
+            /// @brief make a canvas rectangle transparent (clipped to the area)
+            void clear_rect(const Rect& r);
+            void clear() { clear_rows(0, height() - 1); }
+
+            void render_span(uint16_t* line, int16_t y, int16_t x0, int16_t x1) const override;
+
+        private:
+            uint16_t* pixels_;
+            uint8_t* coverage_;
+            uint8_t shift_;
+    };
+
+    /// @brief  merges layers bottom to top into the outgoing frame, only inside damage
+    /// @note   every target (frame buffer) keeps its own damage list: damage() marks a
+    ///         region on all targets, compose() repaints and clears one target. A region
+    ///         is composed line by line in a DTCM line buffer and written once to the
+    ///         target (RGB565, or quantized to a palette index for 8 bpp frames), so
+    ///         cached layers cost nothing outside damaged regions.
+    class Compositor {
+        public:
+            static constexpr uint8_t MAX_LAYERS {5};
+            static constexpr uint8_t MAX_TARGETS {2};
+            static constexpr uint16_t MAX_WIDTH {320};
+
+            Compositor(uint16_t width, uint16_t height, uint8_t targets, uint16_t clear_color = 0);
+
+            /// @brief  add a layer on top of the existing ones
+            /// @return false when MAX_LAYERS is reached
+            bool add_layer(Layer* layer);
+
+            /// @brief mark a screen region as changed on every target
+            void damage(const Rect& r);
+            void damage_all() { damage({0, 0, width_, height_}); }
+
+            /// @brief bounding box of the pending damage of a target
+            Rect pending(uint8_t target) const;
+
+            /// @brief  repaint the damage of one target and clear it
+            /// @param  frame   target surface; damage outside its clip is dropped
+            /// @param  written when set, receives the disjoint rectangles written
+            /// @return bounding box of the pixels written (empty when nothing to do)
+            Rect compose(uint8_t target, const Surface565& frame, DamageList* written = nullptr);
+            /// @brief same into an 8 bpp frame, every composed line quantized through
+            ///        the palette (its inverse table must be built)
+            Rect compose(uint8_t target, const SurfaceI8& frame, const Palette& palette,
+                         DamageList* written = nullptr);
+
+            /// @brief pixels written by the last compose()
+            uint32_t last_pixels() const { return last_pixels_; }
+
+        private:
+            /// one of the frame kinds compose() writes
+            struct Target {
+                const Surface565* rgb;
+                const SurfaceI8* indexed;
+                const Palette* palette;
+            };
+
+            Rect compose(uint8_t target, const Target& frame, const Rect& clip, DamageList* written);
+            void compose_rect(const Rect& r, const Target& frame);
+
+            uint16_t width_;
+            uint16_t height_;
+            uint8_t targets_;
+            uint16_t clear_color_;
+            Layer* layers_[MAX_LAYERS];
+            uint8_t layer_count_;
+            DamageList damage_[MAX_TARGETS];
+            uint32_t last_pixels_;
+    };
+
+} // namespace gfx
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "stm32h7xx_hal.h"
+#include "ST7789.hpp"
+#include "dma_buffer.hpp"
+#include "compositor.hpp"
+#include "scene.hpp"
+#include <cstdint>
+
+/// @brief 数字时钟（保留模式场景，双缓冲DMA）
+/// @note  时、分、秒是独立的文字节点，每秒通常只有秒的区域被重画和发送。
+///        颜色模式下背景色表示时间（红=时 绿=分 蓝=秒），与ST7789::clock_color_display相同。
+///        与ClockApp共用SDRAM中的帧缓冲区和画布区域，两者只能运行一个。
+class DigitalClock {
+public:
+    DigitalClock(ST7789* lcd);
+    
+    void set_time(uint8_t hours, uint8_t minutes, uint8_t seconds);
+    void set_color_mode(bool on);   // 颜色时钟模式
+    void run();                     // 主循环
+    
+private:
+    static constexpr uint16_t WIDTH = lcd::panels::st7789_240x280.width;
+    static constexpr uint16_t HEIGHT = lcd::panels::st7789_240x280.height;
+    
+    DmaBuffer frame_[2];
+    uint8_t current_buffer_idx_;
+    
+    gfx::CanvasLayer canvas_;
+    gfx::Compositor compositor_;
+    gfx::Scene scene_;
+    gfx::RectNode background_;
+    gfx::TextNode colon_[2];
+    gfx::TextNode hours_text_;
+    gfx::TextNode minutes_text_;
+    gfx::TextNode seconds_text_;
+    
+    ST7789* lcd_;
+    uint8_t hours_;
+    uint8_t minutes_;
+    uint8_t seconds_;
+    bool color_mode_;
+    
+    void tick();            // 时间加一秒
+    void update_scene();    // 把当前时间写入节点（没变的节点不产生脏区）
+};
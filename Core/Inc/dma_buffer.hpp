@@ -0,0 +1,58 @@
+/// @file    dma_buffer.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+/// @brief  memory block handed to DMA, with range-tracked D-Cache maintenance
+/// @note   writers record what they touched with mark_dirty(), clean() then only
+///         writes back the dirty cache lines before the DMA hand-off
+class DmaBuffer {
+    public:
+        static constexpr uint32_t CACHE_LINE {32};  // Cortex-M7 D-Cache line
+        static constexpr uint8_t MAX_RANGES {8};    // merged when exceeded
+
+        /// @brief  wrap an existing block
+        /// @param  data start address, must be CACHE_LINE aligned
+        /// @param  size size in bytes
+        /// @note   the block starts fully dirty
+        DmaBuffer(void* data, uint32_t size);
+
+        void* data() const { return data_; }
+        uint16_t* data16() const { return (uint16_t*)data_; }
+        uint32_t size() const { return size_; }
+
+        /// @brief record a written byte range
+        /// @param offset byte offset from data()
+        /// @param bytes  length in bytes
+        void mark_dirty(uint32_t offset, uint32_t bytes);
+
+        /// @brief record that the whole block was written
+        void mark_all_dirty();
+
+        /// @brief  write back the dirty lines and reset the tracking
+        /// @return number of bytes cleaned (multiple of CACHE_LINE)
+        uint32_t clean();
+
+        bool is_dirty() const { return range_count_ > 0; }
+        /// @brief bytes currently marked dirty, rounded to cache lines
+        uint32_t dirty_bytes() const;
+        /// @brief bytes written back by the last clean()
+        uint32_t last_cleaned_bytes() const { return last_cleaned_; }
+        /// @brief CPU cycles spent in the last clean()
+        uint32_t last_clean_cycles() const { return last_clean_cycles_; }
+
+    private:
+        struct Range {
+            uint32_t begin;     // line aligned
+            uint32_t end;       // line aligned, exclusive
+        };
+
+        void merge_closest();
+
+        uint8_t* data_;
+        uint32_t size_;
+        Range ranges_[MAX_RANGES];
+        uint8_t range_count_;
+        uint32_t last_cleaned_;
+        uint32_t last_clean_cycles_;
+};
@@ -0,0 +1,50 @@
+/// @file    fastmem.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+/// @brief  copy/fill kernels for the Cortex-M7 bus: 64-bit LDRD/STRD, 32 bytes
+///         (one cache line, one 16-bit SDRAM burst of 16 beats) per iteration
+/// @note   every kernel handles unaligned heads and tails itself, any pointer and
+///         length is valid
+namespace fastmem {
+
+    /// @brief  copy bytes, regions must not overlap
+    void copy(void* dst, const void* src, uint32_t bytes);
+
+    /// @brief  copy bytes, regions may overlap
+    void move(void* dst, const void* src, uint32_t bytes);
+
+    /// @brief  fill with a repeated 16-bit value (RGB565 pixel)
+    /// @param  dst   2-byte aligned
+    /// @param  count number of halfwords
+    void fill16(uint16_t* dst, uint16_t value, uint32_t count);
+
+    /// @brief  fill with a repeated 32-bit value
+    /// @param  dst   4-byte aligned
+    /// @param  count number of words
+    void fill32(uint32_t* dst, uint32_t value, uint32_t count);
+
+    /// @brief  copy a w x h block of 16-bit pixels between strided surfaces
+    /// @param  dst_stride / src_stride line pitch in pixels
+    void copy_rect16(uint16_t* dst, uint32_t dst_stride,
+                     const uint16_t* src, uint32_t src_stride,
+                     uint32_t w, uint32_t h);
+
+    /// @brief  fill a w x h block of 16-bit pixels in a strided surface
+    void fill_rect16(uint16_t* dst, uint32_t dst_stride, uint32_t w, uint32_t h, uint16_t value);
+
+    /// @brief  non-temporal copy: the result is written to memory and neither the
+    ///         source nor the destination is left in the D-Cache
+    /// @note   the M7 has no streaming hint, the copy runs in NT_BLOCK pieces that are
+    ///         clean-invalidated right away, so at most one block occupies the cache.
+    ///         The destination needs no further clean before a DMA read.
+    void copy_nt(void* dst, const void* src, uint32_t bytes);
+
+    /// @brief  non-temporal 16-bit fill, destination is written to memory and evicted
+    void fill16_nt(uint16_t* dst, uint16_t value, uint32_t count);
+
+    /// @brief  block size of the non-temporal kernels, a quarter of the 16 KB D-Cache
+    constexpr uint32_t NT_BLOCK {4096};
+
+} // namespace fastmem
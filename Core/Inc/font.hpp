@@ -0,0 +1,103 @@
+/// @file    font.hpp
+#pragma once
+#include "compositor.hpp"
+#include "accel2d.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    class Painter;
+
+    /// @brief one glyph of an atlas, box relative to the pen at the top of the line
+    struct GlyphInfo {
+        uint16_t code;
+        uint8_t w;
+        uint8_t h;
+        int8_t x_off;
+        int8_t y_off;
+        uint8_t advance;
+        uint16_t offset;    // first code byte in Font::data
+    };
+
+    struct KernPair {
+        uint16_t left;
+        uint16_t right;
+        int8_t adjust;
+    };
+
+    /// @brief  anti-aliased glyph atlas generated by tools/fontconv.py
+    /// @note   glyphs are 4 bpp run/literal coded masks (see mask.hpp). Both tables
+    ///         are sorted for binary search.
+    struct Font {
+        const GlyphInfo* glyphs;
+        uint16_t glyph_count;
+        const uint8_t* data;
+        const KernPair* kerning;
+        uint16_t kern_count;
+        uint8_t line_height;
+
+        /// @brief glyph of a character, nullptr when the atlas lacks it
+        const GlyphInfo* find(uint16_t code) const;
+        /// @brief pen adjustment between two characters
+        int8_t kern(uint16_t left, uint16_t right) const;
+        /// @brief pen advance of a string, kerning included
+        uint16_t measure(const char* text) const;
+        /// @brief ink bounding box of a string drawn with the pen at (x, y)
+        Rect bounds(const char* text, int16_t x, int16_t y) const;
+    };
+
+    /// @brief draw one glyph, the pen at (x, y) = top-left of the line
+    void draw_glyph(Painter& p, const Font& font, const GlyphInfo& g, int16_t x, int16_t y,
+                    uint16_t color, uint8_t alpha = 255);
+
+    /// @brief  draw a string with kerning
+    /// @return pen x after the last character
+    int16_t draw_text(Painter& p, const Font& font, int16_t x, int16_t y, const char* text,
+                      uint16_t color, uint8_t alpha = 255);
+
+    /// @brief  pre-composited glyph cells for fast numeric readouts
+    /// @note   build() renders each character once in fg over an opaque bg into its own
+    ///         advance x line_height RGB565 cell, draw() then only copies cells. Cells are
+    ///         placed without kerning, which is exact for the tabular digits of the
+    ///         generated fonts. Characters not in the cache are blended over bg.
+    ///         With set_accel() the cell copies go through Accel2D (DMA2D runs them in the
+    ///         background); the caller waits on it before reading the destination.
+    class GlyphCache {
+        public:
+            static constexpr uint8_t MAX_GLYPHS {16};
+
+            /// @param storage cell memory, pixels its size in RGB565 pixels
+            GlyphCache(uint16_t* storage, uint32_t pixels);
+
+            /// @return false when storage or slots run out (the cache keeps what fit)
+            bool build(const Font& font, const char* chars, uint16_t fg, uint16_t bg);
+
+            /// @brief  draw text with the pen at screen (x, y), clipped to the surface
+            /// @return pen advance in pixels
+            uint16_t draw(const Surface565& dst, int16_t x, int16_t y, const char* text) const;
+
+            /// @brief copy cells with accel instead of the CPU, nullptr for the CPU
+            void set_accel(Accel2D* accel) { accel_ = accel; }
+
+            const Font* font() const { return font_; }
+
+        private:
+            struct Cell {
+                uint16_t code;
+                uint8_t advance;
+                uint16_t* pixels;
+            };
+
+            const Cell* find(uint16_t code) const;
+
+            uint16_t* storage_;
+            uint32_t capacity_;
+            Accel2D* accel_;
+            const Font* font_;
+            uint16_t fg_;
+            uint16_t bg_;
+            Cell cells_[MAX_GLYPHS];
+            uint8_t count_;
+    };
+
+} // namespace gfx
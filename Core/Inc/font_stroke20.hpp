@@ -0,0 +1,242 @@
+/// @file    font_stroke20.hpp
+/// @brief   20 px anti-aliased glyph atlas (built-in stroke font, weight 1.10), 4 bpp run/literal coded
+/// @note    generated by tools/fontconv.py, do not edit: 22 glyphs, 1969 bytes coded (2607 bytes as plain 4 bpp)
+#pragma once
+#include "font.hpp"
+
+namespace gfx::fonts {
+
+    inline constexpr uint8_t stroke20_rle[] = {
+        0x00, 0x84, 0x71, 0x8B, 0x01, 0x03, 0xBF, 0xE1, 0x0E, 0xC0, 0xFF, 0xEF, 0x02, 0x00, 0xF8, 0x0E,
+        0xF7, 0x8F, 0xFE, 0x09, 0x10, 0xFE, 0x08, 0xFB, 0x08, 0xF5, 0x0F, 0x80, 0xEF, 0x01, 0xFF, 0x04,
+        0xF1, 0x0F, 0xE1, 0x8F, 0x00, 0xFB, 0x07, 0x99, 0xF5, 0x0F, 0xF8, 0x1E, 0x00, 0xF8, 0x5E, 0xFC,
+        0x1B, 0xFE, 0x08, 0x00, 0xE1, 0x43, 0x84, 0x83, 0xEF, 0x01, 0x03, 0x88, 0xA2, 0xAE, 0x13, 0xFE,
+        0x08, 0x09, 0x83, 0xF8, 0x1E, 0x08, 0x83, 0xE1, 0x8F, 0x09, 0x83, 0xF8, 0x1E, 0x08, 0x83, 0xE1,
+        0x8F, 0x09, 0x88, 0xF8, 0x1E, 0xA3, 0xAE, 0x02, 0x03, 0x84, 0xE1, 0x8F, 0x03, 0x43, 0xBF, 0x1E,
+        0x00, 0x80, 0xEF, 0xB1, 0xCF, 0xE5, 0x8F, 0x00, 0xE1, 0x8F, 0xF0, 0x5F, 0x70, 0xBF, 0x00, 0xF8,
+        0x1E, 0xF0, 0x1F, 0x40, 0xFF, 0x10, 0xFE, 0x08, 0xF0, 0x5F, 0x80, 0xBF, 0x80, 0xEF, 0x01, 0x99,
+        0x90, 0xEF, 0xF8, 0x7F, 0xE0, 0x8F, 0x00, 0x20, 0xFE, 0xFF, 0x0C, 0xE0, 0x1E, 0x03, 0x85, 0x81,
+        0x7B, 0x01, 0x80, 0x0E, 0x45, 0x81, 0xEE, 0x45, 0x80, 0x0E, 0x83, 0xEE, 0xEE, 0x06, 0x82, 0xE1,
+        0x0E, 0x06, 0x82, 0xF6, 0x0E, 0x06, 0x82, 0xFC, 0x09, 0x05, 0x83, 0xF3, 0x3F, 0x05, 0x82, 0xF9,
+        0x0C, 0x05, 0x83, 0xE1, 0x6F, 0x05, 0x83, 0xF6, 0x1E, 0x05, 0x82, 0xFC, 0x09, 0x05, 0x83, 0xF3,
+        0x3F, 0x05, 0x82, 0xF9, 0x0C, 0x05, 0x83, 0xE1, 0x6F, 0x05, 0x83, 0xF6, 0x1E, 0x05, 0x82, 0xFC,
+        0x09, 0x05, 0x83, 0xF3, 0x3F, 0x05, 0x82, 0xF9, 0x0C, 0x05, 0x83, 0xE1, 0x6F, 0x05, 0x83, 0xF6,
+        0x1E, 0x05, 0x82, 0xFC, 0x09, 0x05, 0x83, 0xF3, 0x3F, 0x05, 0x82, 0xF9, 0x0C, 0x06, 0x82, 0xFE,
+        0x06, 0x06, 0x82, 0xEE, 0x01, 0x06, 0x03, 0x85, 0xD6, 0xFF, 0x6D, 0x06, 0x80, 0x09, 0x45, 0x80,
+        0x09, 0x04, 0x90, 0xF8, 0x8F, 0x33, 0xF8, 0x8F, 0x00, 0x40, 0xFF, 0x07, 0x03, 0x88, 0xF7, 0x4F,
+        0x00, 0xFB, 0x0B, 0x05, 0x87, 0xFB, 0x0B, 0xF3, 0x3F, 0x05, 0x86, 0xF3, 0x3F, 0xF8, 0x0C, 0x07,
+        0x85, 0xFC, 0xB8, 0x8F, 0x07, 0x85, 0xF8, 0xEB, 0x5F, 0x07, 0x85, 0xF5, 0xFE, 0x4F, 0x07, 0x80,
+        0x04, 0x43, 0x80, 0x02, 0x07, 0x80, 0x02, 0x43, 0x80, 0x02, 0x07, 0x80, 0x02, 0x43, 0x80, 0x04,
+        0x07, 0x85, 0xF4, 0xEF, 0x5F, 0x07, 0x85, 0xF5, 0xBE, 0x8F, 0x07, 0x85, 0xF8, 0x8B, 0xCF, 0x07,
+        0x86, 0xFC, 0x38, 0xFF, 0x03, 0x05, 0x87, 0xF3, 0x3F, 0xB0, 0xBF, 0x05, 0x88, 0xFB, 0x0B, 0x40,
+        0xFF, 0x07, 0x03, 0x90, 0xF7, 0x4F, 0x00, 0x80, 0xFF, 0x38, 0x83, 0xFF, 0x08, 0x04, 0x80, 0x09,
+        0x45, 0x80, 0x09, 0x06, 0x85, 0xD6, 0xFF, 0x6D, 0x03, 0x03, 0xAC, 0xE3, 0x0E, 0x00, 0xE3, 0xFF,
+        0x00, 0xE3, 0xFF, 0x0F, 0xE3, 0xCF, 0xFF, 0xE4, 0xCF, 0xF1, 0xAF, 0xCF, 0x01, 0xFF, 0x82, 0x01,
+        0xF0, 0x0F, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+        0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x81,
+        0xEE, 0x02, 0x87, 0x92, 0xFE, 0xEF, 0x29, 0x04, 0x80, 0x07, 0x47, 0x94, 0x08, 0x00, 0xF7, 0xCF,
+        0x36, 0x63, 0xFB, 0x8F, 0x20, 0xFF, 0x09, 0x05, 0x86, 0xF9, 0x2F, 0xF9, 0x0C, 0x07, 0x85, 0xFB,
+        0x89, 0x5F, 0x07, 0x82, 0xF6, 0x0E, 0x0A, 0x82, 0xF3, 0x0F, 0x0A, 0x82, 0xF3, 0x0F, 0x0A, 0x82,
+        0xF6, 0x0E, 0x09, 0x83, 0xC1, 0x9F, 0x08, 0x84, 0xC1, 0xFF, 0x02, 0x07, 0x84, 0xC1, 0xEF, 0x03,
+        0x07, 0x84, 0xC1, 0xEF, 0x03, 0x07, 0x84, 0xC1, 0xEF, 0x03, 0x07, 0x84, 0xC1, 0xEF, 0x03, 0x07,
+        0x84, 0xC1, 0xEF, 0x03, 0x07, 0x84, 0xC1, 0xEF, 0x03, 0x07, 0x84, 0xE3, 0xEF, 0x03, 0x07, 0x84,
+        0xE3, 0xEF, 0x03, 0x07, 0x84, 0xE3, 0xEF, 0x03, 0x08, 0x80, 0x0E, 0x4B, 0x81, 0xEE, 0x4B, 0x80,
+        0x0E, 0x02, 0x87, 0x92, 0xFE, 0xEF, 0x29, 0x04, 0x80, 0x06, 0x47, 0x94, 0x06, 0x00, 0xF6, 0xCF,
+        0x36, 0x63, 0xFC, 0x6F, 0x00, 0xFE, 0x09, 0x05, 0x87, 0xF9, 0x1E, 0x70, 0x19, 0x05, 0x83, 0xD1,
+        0x7F, 0x0A, 0x82, 0xF8, 0x0A, 0x0A, 0x82, 0xF8, 0x0B, 0x0A, 0x82, 0xFC, 0x08, 0x09, 0x83, 0xF5,
+        0x3F, 0x05, 0x86, 0x85, 0x75, 0xFF, 0x0A, 0x06, 0x44, 0x81, 0x1C, 0x06, 0x44, 0x81, 0x3E, 0x06,
+        0x87, 0x85, 0x55, 0xFD, 0x2E, 0x09, 0x83, 0xD1, 0x9F, 0x0A, 0x82, 0xF6, 0x0E, 0x0A, 0x82, 0xF2,
+        0x0F, 0x0A, 0x85, 0xF4, 0x1F, 0x69, 0x07, 0x86, 0xF8, 0x4C, 0xFF, 0x06, 0x05, 0x94, 0xF6, 0x6F,
+        0xA0, 0xFF, 0x5B, 0x33, 0xB5, 0xFF, 0x0A, 0x10, 0x09, 0x47, 0x81, 0x19, 0x03, 0x8A, 0xA4, 0xFE,
+        0xEF, 0x4A, 0x00, 0x00, 0x07, 0x82, 0xE1, 0x0E, 0x0A, 0x82, 0xF9, 0x0F, 0x09, 0x83, 0xF4, 0xFF,
+        0x08, 0x84, 0xD1, 0xFF, 0x0F, 0x08, 0x84, 0xF8, 0xFE, 0x0F, 0x07, 0x85, 0xF3, 0x7F, 0xFF, 0x07,
+        0x85, 0xFC, 0x0B, 0xFF, 0x06, 0x86, 0xF8, 0x2F, 0xF0, 0x0F, 0x05, 0x87, 0xF2, 0x8F, 0x00, 0xFF,
+        0x05, 0x87, 0xFB, 0x0C, 0x00, 0xFF, 0x04, 0x88, 0xF7, 0x3F, 0x00, 0xF0, 0x0F, 0x03, 0x83, 0xE2,
+        0x8F, 0x03, 0x41, 0x03, 0x83, 0xFA, 0x1D, 0x03, 0x41, 0x02, 0x83, 0xF5, 0x4F, 0x04, 0x41, 0x02,
+        0x80, 0x0E, 0x4B, 0x81, 0xEE, 0x4B, 0x80, 0x0E, 0x08, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x41,
+        0x0B, 0x41, 0x0B, 0x84, 0xEE, 0x00, 0x00, 0x00, 0x80, 0x0B, 0x49, 0x82, 0x2E, 0x00, 0x4A, 0x85,
+        0x2E, 0xF0, 0x4F, 0x0A, 0x41, 0x80, 0x04, 0x0A, 0x41, 0x80, 0x04, 0x0A, 0x41, 0x80, 0x02, 0x09,
+        0x82, 0xF1, 0x0F, 0x0A, 0x89, 0xF4, 0x0F, 0xA6, 0xDB, 0x6B, 0x03, 0x83, 0xF4, 0xDF, 0x45, 0x96,
+        0x3D, 0x00, 0xF4, 0xFF, 0x9E, 0x65, 0xE9, 0xEF, 0x03, 0xF4, 0xCF, 0x02, 0x03, 0x88, 0xC2, 0xDF,
+        0x40, 0xEF, 0x02, 0x05, 0x86, 0xE1, 0x7F, 0x70, 0x04, 0x07, 0x82, 0xF8, 0x0C, 0x0A, 0x82, 0xF4,
+        0x0F, 0x0A, 0x82, 0xF3, 0x0F, 0x0A, 0x85, 0xF4, 0x0F, 0x23, 0x07, 0x86, 0xF7, 0x3D, 0xDF, 0x01,
+        0x05, 0x88, 0xD1, 0x8F, 0xE2, 0x9F, 0x01, 0x03, 0x96, 0xA1, 0xEF, 0x01, 0xF5, 0xDF, 0x46, 0x63,
+        0xFD, 0x6F, 0x00, 0x60, 0x0E, 0x45, 0x81, 0x6E, 0x04, 0x8A, 0x92, 0xFD, 0xEF, 0x29, 0x00, 0x00,
+        0x03, 0x85, 0xD6, 0xFF, 0x6D, 0x06, 0x80, 0x09, 0x45, 0x80, 0x09, 0x04, 0x90, 0xF8, 0x8F, 0x33,
+        0xF8, 0x8F, 0x00, 0x40, 0xFF, 0x07, 0x03, 0x88, 0xF6, 0x0E, 0x00, 0xFB, 0x0B, 0x05, 0x87, 0x46,
+        0x00, 0xF3, 0x3F, 0x09, 0x82, 0xF8, 0x0C, 0x0A, 0x82, 0xFB, 0x08, 0x0A, 0x90, 0xFE, 0x25, 0xE9,
+        0xFF, 0x9E, 0x02, 0x00, 0xFF, 0x09, 0x47, 0x82, 0x07, 0x00, 0x43, 0x8D, 0x6C, 0x33, 0xC6, 0xFF,
+        0x07, 0xFF, 0x9F, 0x05, 0x86, 0xF9, 0x2F, 0xFF, 0x0C, 0x07, 0x85, 0xFC, 0xF9, 0x7F, 0x07, 0x85,
+        0xF6, 0xFE, 0x7F, 0x07, 0x80, 0x03, 0x43, 0x80, 0x04, 0x07, 0x85, 0xF3, 0xEF, 0x6F, 0x07, 0x85,
+        0xF6, 0x9E, 0xCF, 0x07, 0x86, 0xFC, 0x29, 0xFF, 0x09, 0x05, 0x94, 0xF9, 0x2F, 0x70, 0xFF, 0x6C,
+        0x33, 0xC6, 0xFF, 0x07, 0x00, 0x07, 0x47, 0x80, 0x07, 0x04, 0x8A, 0x92, 0xFE, 0xEF, 0x29, 0x00,
+        0x00, 0x80, 0x0E, 0x4B, 0x81, 0xEE, 0x4B, 0x80, 0x0E, 0x0A, 0x82, 0xFC, 0x09, 0x09, 0x83, 0xF3,
+        0x3F, 0x09, 0x82, 0xF9, 0x0C, 0x09, 0x83, 0xE1, 0x6F, 0x09, 0x83, 0xF6, 0x1E, 0x09, 0x82, 0xFC,
+        0x09, 0x09, 0x83, 0xF3, 0x3F, 0x09, 0x82, 0xF9, 0x0C, 0x09, 0x83, 0xE1, 0x6F, 0x09, 0x83, 0xF6,
+        0x1E, 0x09, 0x82, 0xFC, 0x09, 0x09, 0x83, 0xF3, 0x3F, 0x09, 0x82, 0xF9, 0x0C, 0x09, 0x83, 0xE1,
+        0x6F, 0x09, 0x83, 0xF6, 0x1E, 0x09, 0x82, 0xFC, 0x09, 0x09, 0x83, 0xF3, 0x3F, 0x09, 0x82, 0xF9,
+        0x0C, 0x0A, 0x82, 0xFE, 0x06, 0x0A, 0x82, 0xEE, 0x01, 0x06, 0x02, 0x87, 0x91, 0xFE, 0xEF, 0x19,
+        0x04, 0x81, 0xE3, 0x45, 0x96, 0x3E, 0x00, 0x20, 0xFE, 0x6D, 0x33, 0xD6, 0xEF, 0x02, 0x90, 0xDF,
+        0x01, 0x03, 0x88, 0xD1, 0x9F, 0x10, 0xFF, 0x05, 0x05, 0x86, 0xF5, 0x1F, 0xF4, 0x0F, 0x07, 0x41,
+        0x83, 0x44, 0xFF, 0x07, 0x41, 0x84, 0x34, 0xFF, 0x02, 0x05, 0x87, 0xF2, 0x3F, 0xD0, 0xAF, 0x05,
+        0x94, 0xFA, 0x0D, 0x50, 0xFF, 0x59, 0x88, 0x95, 0xFF, 0x05, 0x00, 0x0A, 0x47, 0x85, 0x0A, 0x00,
+        0xE3, 0x47, 0x94, 0x3E, 0x20, 0xFE, 0x4D, 0x85, 0x58, 0xD4, 0xEF, 0x92, 0xDF, 0x01, 0x05, 0x86,
+        0xD1, 0x9F, 0xFE, 0x06, 0x07, 0x85, 0xF6, 0xFE, 0x2F, 0x07, 0x80, 0x02, 0x43, 0x80, 0x04, 0x07,
+        0x85, 0xF4, 0xCF, 0x9F, 0x07, 0x86, 0xF9, 0x6C, 0xFF, 0x06, 0x05, 0x94, 0xF6, 0x6F, 0xB0, 0xFF,
+        0x5B, 0x22, 0xB5, 0xFF, 0x0B, 0x10, 0x0A, 0x47, 0x81, 0x1A, 0x03, 0x8A, 0xA4, 0xFE, 0xEF, 0x4A,
+        0x00, 0x00, 0x02, 0x87, 0x92, 0xFE, 0xEF, 0x29, 0x04, 0x80, 0x07, 0x47, 0x94, 0x07, 0x00, 0xF7,
+        0xCF, 0x36, 0x63, 0xFC, 0x7F, 0x20, 0xFF, 0x09, 0x05, 0x86, 0xF9, 0x2F, 0xF9, 0x0C, 0x07, 0x85,
+        0xFC, 0xE9, 0x6F, 0x07, 0x85, 0xF6, 0xFE, 0x3F, 0x07, 0x80, 0x04, 0x43, 0x80, 0x03, 0x07, 0x85,
+        0xF7, 0xEF, 0x6F, 0x07, 0x85, 0xF7, 0x9F, 0xCF, 0x07, 0x86, 0xFC, 0x2F, 0xFF, 0x09, 0x05, 0x8D,
+        0xF9, 0xFF, 0x70, 0xFF, 0x6C, 0x33, 0xC6, 0x43, 0x01, 0x80, 0x07, 0x47, 0x90, 0xF9, 0x0F, 0x00,
+        0x92, 0xFE, 0xEF, 0x29, 0xF5, 0x0E, 0x0A, 0x82, 0xF8, 0x0B, 0x0A, 0x82, 0xFC, 0x08, 0x09, 0x87,
+        0xF3, 0x3F, 0x00, 0x64, 0x05, 0x88, 0xFB, 0x0B, 0x00, 0xFE, 0x06, 0x03, 0x90, 0xF7, 0x4F, 0x00,
+        0x80, 0xFF, 0x38, 0x83, 0xFF, 0x08, 0x04, 0x80, 0x09, 0x45, 0x80, 0x09, 0x06, 0x85, 0xD6, 0xFF,
+        0x6D, 0x03, 0x83, 0xEE, 0xEE, 0x0F, 0x83, 0xEE, 0xEE, 0x03, 0x86, 0x91, 0xFE, 0x9F, 0x03, 0x04,
+        0x81, 0xE3, 0x44, 0xA1, 0x6E, 0x00, 0x10, 0xFE, 0x6E, 0x54, 0xFC, 0x3E, 0x00, 0xF9, 0x3E, 0x00,
+        0x10, 0xFC, 0x08, 0xF2, 0x5F, 0x04, 0x86, 0x71, 0x01, 0xF8, 0x0C, 0x09, 0x82, 0xFD, 0x07, 0x08,
+        0x83, 0xF2, 0x2F, 0x08, 0x82, 0xF4, 0x0E, 0x09, 0x82, 0xF8, 0x0B, 0x09, 0x82, 0xF8, 0x0B, 0x09,
+        0x82, 0xF8, 0x0B, 0x09, 0x82, 0xF8, 0x0B, 0x09, 0x82, 0xF4, 0x0E, 0x09, 0x83, 0xF2, 0x2F, 0x09,
+        0x82, 0xFD, 0x07, 0x09, 0x82, 0xF8, 0x0C, 0x09, 0x83, 0xF2, 0x5F, 0x04, 0xA1, 0x71, 0x01, 0x90,
+        0xEF, 0x03, 0x00, 0xC1, 0x8F, 0x00, 0xE1, 0xEF, 0x46, 0xC5, 0xEF, 0x03, 0x00, 0xE3, 0x44, 0x81,
+        0x6E, 0x04, 0x88, 0x91, 0xFE, 0x9F, 0x03, 0x00, 0x80, 0x0E, 0x49, 0x80, 0x0E, 0x4A, 0x82, 0xFE,
+        0x0F, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x89,
+        0x88, 0x88, 0x88, 0x58, 0x00, 0x49, 0x01, 0x41, 0x8B, 0xBB, 0xBB, 0xBB, 0x8B, 0x00, 0xFF, 0x09,
+        0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09,
+        0x81, 0xEE, 0x09, 0x00, 0x82, 0xEB, 0x02, 0x05, 0x87, 0xE2, 0x0B, 0xF0, 0x8F, 0x05, 0x87, 0xF8,
+        0x0F, 0xF0, 0xDF, 0x05, 0x88, 0xFD, 0x0F, 0xF0, 0xFF, 0x03, 0x03, 0x89, 0xF3, 0xFF, 0x00, 0xFF,
+        0x8F, 0x03, 0x89, 0xF8, 0xFF, 0x00, 0xFF, 0xDF, 0x03, 0x85, 0xFD, 0xFF, 0x00, 0x43, 0x83, 0x04,
+        0x40, 0x43, 0x01, 0x41, 0xBF, 0xFA, 0x09, 0x90, 0xAF, 0xFF, 0x20, 0xFF, 0xF6, 0x0E, 0xE0, 0x6F,
+        0xFF, 0x42, 0xFF, 0xF1, 0x5F, 0xF5, 0x1F, 0xFF, 0x44, 0xFF, 0xA0, 0x9F, 0xF9, 0x0A, 0xFF, 0x44,
+        0xFF, 0x60, 0xEF, 0xFE, 0x06, 0x87, 0xFF, 0x44, 0xFF, 0x10, 0x43, 0xB1, 0x01, 0xFF, 0x44, 0xFF,
+        0x00, 0xFA, 0xAF, 0x00, 0xFF, 0x44, 0xFF, 0x00, 0xF6, 0x6F, 0x00, 0xFF, 0x44, 0xCF, 0x00, 0xE0,
+        0x0E, 0x00, 0xFC, 0x54, 0xBF, 0x07, 0x85, 0xFB, 0x85, 0xBF, 0x07, 0x85, 0xFB, 0x88, 0xBF, 0x07,
+        0x85, 0xFB, 0x88, 0xBF, 0x07, 0x85, 0xFB, 0x88, 0xBF, 0x07, 0x85, 0xFB, 0x58, 0x8F, 0x07, 0x82,
+        0xF8, 0x05, 0x80, 0x0E, 0x46, 0x84, 0x4B, 0x00, 0x00, 0x49, 0x84, 0x08, 0xF0, 0x0F, 0x04, 0x87,
+        0xA4, 0xFF, 0x05, 0xFF, 0x06, 0x85, 0xF9, 0x0D, 0xFF, 0x06, 0x85, 0xF1, 0x4F, 0xFF, 0x07, 0x84,
+        0xFB, 0xF8, 0x0F, 0x07, 0x84, 0xFB, 0xF8, 0x0F, 0x07, 0x84, 0xFD, 0xF6, 0x0F, 0x06, 0x85, 0xF6,
+        0x2F, 0xFF, 0x05, 0x91, 0xE5, 0x9F, 0xF0, 0xBF, 0xBB, 0xBB, 0xFC, 0xCF, 0x01, 0x48, 0x8C, 0x1A,
+        0x00, 0xFF, 0x88, 0x88, 0x78, 0x02, 0x03, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41,
+        0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x81, 0xEE, 0x0A, 0x02, 0x87, 0x92, 0xFE, 0xEF, 0x29,
+        0x04, 0x81, 0xE6, 0x45, 0x96, 0x6E, 0x00, 0x40, 0xFF, 0x6D, 0x33, 0xD6, 0xFF, 0x04, 0xD0, 0xCF,
+        0x01, 0x03, 0x88, 0xC1, 0xBF, 0x40, 0xFF, 0x02, 0x05, 0x86, 0xA1, 0x05, 0xF8, 0x0B, 0x0A, 0x82,
+        0xF8, 0x0B, 0x0A, 0x82, 0xF6, 0x0E, 0x0A, 0x83, 0xE1, 0x7F, 0x0A, 0x88, 0xF8, 0x8F, 0x51, 0x58,
+        0x01, 0x05, 0x89, 0xF9, 0xEF, 0xFF, 0xEF, 0x18, 0x04, 0x89, 0xE8, 0xFF, 0xEF, 0xFF, 0x1C, 0x04,
+        0x88, 0x51, 0x58, 0x70, 0xFF, 0x0A, 0x0A, 0x83, 0xF5, 0x3F, 0x0A, 0x82, 0xFC, 0x08, 0x0A, 0x82,
+        0xF8, 0x0B, 0x0A, 0x86, 0xF8, 0x0A, 0x97, 0x01, 0x05, 0x87, 0xD1, 0x7F, 0xE0, 0x9F, 0x05, 0x94,
+        0xF9, 0x1E, 0x60, 0xFF, 0x6C, 0x33, 0xC6, 0xFF, 0x06, 0x00, 0x06, 0x47, 0x80, 0x06, 0x04, 0x8A,
+        0x92, 0xFE, 0xEF, 0x29, 0x00, 0x00, 0x81, 0xEE, 0x07, 0x83, 0xEE, 0xFF, 0x07, 0x43, 0x07, 0x43,
+        0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43,
+        0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x80, 0x02, 0x05, 0x80, 0x02, 0x43, 0x80, 0x05,
+        0x05, 0x85, 0xF5, 0xAF, 0x9F, 0x05, 0x86, 0xF9, 0x4A, 0xFF, 0x06, 0x03, 0x92, 0xF6, 0x4F, 0xA0,
+        0xFF, 0x38, 0x83, 0xFF, 0x0A, 0x10, 0x0C, 0x45, 0x81, 0x1C, 0x03, 0x88, 0xD8, 0xFF, 0x8D, 0x00,
+        0x00,
+    };
+
+    // code, w, h, x_off, y_off, advance, offset (sorted by code)
+    inline constexpr GlyphInfo stroke20_glyphs[] = {
+        {0x20,  0,  0,   0,   0, 10,     0},  //  
+        {0x25, 14, 22,   0,   1, 14,     0},  // %
+        {0x2D,  8,  2,   1,  12, 10,   146},  // -
+        {0x2E,  2,  2,   3,  20,  8,   154},  // .
+        {0x2F, 10, 22,   0,   1, 10,   157},  // /
+        {0x30, 14, 22,   0,   1, 14,   246},  // 0
+        {0x31,  7, 22,   2,   1, 14,   377},  // 1
+        {0x32, 14, 22,   0,   1, 14,   433},  // 2
+        {0x33, 14, 22,   0,   1, 14,   545},  // 3
+        {0x34, 14, 22,   0,   1, 14,   660},  // 4
+        {0x35, 14, 22,   0,   1, 14,   759},  // 5
+        {0x36, 14, 22,   0,   1, 14,   880},  // 6
+        {0x37, 14, 22,   0,   1, 14,  1009},  // 7
+        {0x38, 14, 22,   0,   1, 14,  1098},  // 8
+        {0x39, 14, 22,   0,   1, 14,  1234},  // 9
+        {0x3A,  2, 12,   3,   7,  8,  1362},  // :
+        {0x43, 13, 22,   0,   1, 14,  1369},  // C
+        {0x46, 12, 22,   1,   1, 14,  1480},  // F
+        {0x4D, 14, 22,   0,   1, 14,  1539},  // M
+        {0x50, 13, 22,   1,   1, 14,  1682},  // P
+        {0x53, 14, 22,   0,   1, 14,  1770},  // S
+        {0x55, 12, 22,   1,   1, 14,  1894},  // U
+    };
+
+    // left, right, adjust (sorted by left, right)
+    inline constexpr KernPair stroke20_kerning[] = {
+        {0x25, 0x2D, -4},  // %-
+        {0x25, 0x2E, -2},  // %.
+        {0x25, 0x3A, -2},  // %:
+        {0x2D, 0x25, -3},  // -%
+        {0x2D, 0x2D, -1},  // --
+        {0x2D, 0x2F, -2},  // -/
+        {0x2D, 0x46, -1},  // -F
+        {0x2D, 0x50, -1},  // -P
+        {0x2D, 0x53, -2},  // -S
+        {0x2D, 0x55, -1},  // -U
+        {0x2E, 0x25, -2},  // .%
+        {0x2E, 0x2E, -3},  // ..
+        {0x2E, 0x2F, -2},  // ./
+        {0x2E, 0x43, -3},  // .C
+        {0x2E, 0x46, -2},  // .F
+        {0x2E, 0x4D, -2},  // .M
+        {0x2E, 0x50, -2},  // .P
+        {0x2E, 0x53, -2},  // .S
+        {0x2E, 0x55, -2},  // .U
+        {0x2F, 0x2D, -2},  // /-
+        {0x2F, 0x2E, -5},  // /.
+        {0x2F, 0x2F, -4},  // //
+        {0x2F, 0x3A, -2},  // /:
+        {0x2F, 0x43, -1},  // /C
+        {0x3A, 0x25, -2},  // :%
+        {0x3A, 0x2F, -2},  // :/
+        {0x3A, 0x3A, -3},  // ::
+        {0x3A, 0x43, -2},  // :C
+        {0x3A, 0x46, -2},  // :F
+        {0x3A, 0x4D, -2},  // :M
+        {0x3A, 0x50, -2},  // :P
+        {0x3A, 0x53, -2},  // :S
+        {0x3A, 0x55, -2},  // :U
+        {0x43, 0x2D, -6},  // C-
+        {0x43, 0x2E, -2},  // C.
+        {0x43, 0x2F, -1},  // C/
+        {0x43, 0x3A, -2},  // C:
+        {0x43, 0x43, -2},  // CC
+        {0x43, 0x46, -1},  // CF
+        {0x43, 0x50, -1},  // CP
+        {0x43, 0x53, -1},  // CS
+        {0x43, 0x55, -1},  // CU
+        {0x46, 0x25, -1},  // F%
+        {0x46, 0x2D, -2},  // F-
+        {0x46, 0x2E, -7},  // F.
+        {0x46, 0x2F, -3},  // F/
+        {0x46, 0x3A, -7},  // F:
+        {0x46, 0x43, -2},  // FC
+        {0x46, 0x46, -1},  // FF
+        {0x46, 0x4D, -1},  // FM
+        {0x46, 0x50, -1},  // FP
+        {0x46, 0x53, -2},  // FS
+        {0x46, 0x55, -1},  // FU
+        {0x4D, 0x2E, -2},  // M.
+        {0x4D, 0x3A, -2},  // M:
+        {0x50, 0x2D, -2},  // P-
+        {0x50, 0x2E, -7},  // P.
+        {0x50, 0x2F, -2},  // P/
+        {0x50, 0x3A, -2},  // P:
+        {0x53, 0x2D, -1},  // S-
+        {0x53, 0x2E, -2},  // S.
+        {0x53, 0x3A, -2},  // S:
+        {0x55, 0x2D, -1},  // U-
+        {0x55, 0x2E, -2},  // U.
+        {0x55, 0x2F, -1},  // U/
+        {0x55, 0x3A, -2},  // U:
+        {0x55, 0x46, -1},  // UF
+        {0x55, 0x50, -1},  // UP
+        {0x55, 0x55, -1},  // UU
+    };
+
+    inline constexpr Font stroke20 = {
+        stroke20_glyphs, sizeof(stroke20_glyphs) / sizeof(GlyphInfo),
+        stroke20_rle,
+        stroke20_kerning, sizeof(stroke20_kerning) / sizeof(KernPair),
+        24,
+    };
+
+} // namespace gfx::fonts
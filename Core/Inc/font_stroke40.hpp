@@ -0,0 +1,242 @@
+/// @file    font_stroke40.hpp
+/// @brief   40 px anti-aliased glyph atlas (built-in stroke font, weight 1.00), 4 bpp run/literal coded
+/// @note    generated by tools/fontconv.py, do not edit: 11 glyphs, 3248 bytes coded (6022 bytes as plain 4 bpp)
+#pragma once
+#include "font.hpp"
+
+namespace gfx::fonts {
+
+    inline constexpr uint8_t stroke40_rle[] = {
+        0x09, 0x88, 0x72, 0xEB, 0xEF, 0x7B, 0x02, 0x11, 0x81, 0x81, 0x48, 0x81, 0x18, 0x0E, 0x81, 0xC3,
+        0x4A, 0x81, 0x3C, 0x0C, 0x81, 0xE3, 0x4C, 0x81, 0x3E, 0x0A, 0x81, 0xE2, 0x43, 0x86, 0x7D, 0x02,
+        0x72, 0x0D, 0x43, 0x81, 0x2E, 0x09, 0x80, 0x0C, 0x43, 0x81, 0x19, 0x04, 0x81, 0x91, 0x43, 0x80,
+        0x0C, 0x08, 0x80, 0x08, 0x43, 0x80, 0x09, 0x08, 0x80, 0x09, 0x43, 0x80, 0x08, 0x06, 0x85, 0xE1,
+        0xFF, 0xAF, 0x0A, 0x85, 0xFA, 0xFF, 0x1E, 0x05, 0x85, 0xF9, 0xFF, 0x1E, 0x0A, 0x85, 0xE1, 0xFF,
+        0x9F, 0x04, 0x80, 0x01, 0x43, 0x80, 0x06, 0x0C, 0x80, 0x06, 0x43, 0x80, 0x01, 0x03, 0x84, 0xF7,
+        0xFF, 0x0D, 0x0E, 0x84, 0xFD, 0xFF, 0x07, 0x03, 0x84, 0xFC, 0xFF, 0x07, 0x0E, 0x88, 0xF7, 0xFF,
+        0x0C, 0x00, 0x02, 0x43, 0x80, 0x01, 0x0E, 0x80, 0x01, 0x43, 0x87, 0x02, 0x70, 0xFF, 0xBF, 0x10,
+        0x8B, 0xFB, 0xFF, 0x07, 0xA0, 0xFF, 0x7F, 0x10, 0x8B, 0xF7, 0xFF, 0x0A, 0xD0, 0xFF, 0x4F, 0x10,
+        0x86, 0xF4, 0xFF, 0x0D, 0x00, 0x43, 0x12, 0x43, 0x00, 0x84, 0xF4, 0xFF, 0x0C, 0x12, 0x89, 0xFC,
+        0xFF, 0x44, 0xFF, 0xBF, 0x12, 0x89, 0xFB, 0xFF, 0x84, 0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88,
+        0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F,
+        0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89,
+        0xF8, 0xFF, 0x48, 0xFF, 0xBF, 0x12, 0x89, 0xFB, 0xFF, 0x44, 0xFF, 0xCF, 0x12, 0x85, 0xFC, 0xFF,
+        0x04, 0x43, 0x12, 0x43, 0x01, 0x84, 0xFD, 0xFF, 0x04, 0x10, 0x8B, 0xF4, 0xFF, 0x0D, 0xA0, 0xFF,
+        0x7F, 0x10, 0x8B, 0xF7, 0xFF, 0x0A, 0x70, 0xFF, 0xBF, 0x10, 0x87, 0xFB, 0xFF, 0x07, 0x20, 0x43,
+        0x80, 0x01, 0x0E, 0x80, 0x01, 0x43, 0x88, 0x02, 0x00, 0xFC, 0xFF, 0x07, 0x0E, 0x84, 0xF7, 0xFF,
+        0x0C, 0x03, 0x84, 0xF7, 0xFF, 0x0D, 0x0E, 0x84, 0xFD, 0xFF, 0x07, 0x03, 0x80, 0x01, 0x43, 0x80,
+        0x06, 0x0C, 0x80, 0x06, 0x43, 0x80, 0x01, 0x04, 0x85, 0xF9, 0xFF, 0x1E, 0x0A, 0x85, 0xE1, 0xFF,
+        0x9F, 0x05, 0x85, 0xE1, 0xFF, 0xAF, 0x0A, 0x85, 0xFA, 0xFF, 0x1E, 0x06, 0x80, 0x08, 0x43, 0x80,
+        0x09, 0x08, 0x80, 0x09, 0x43, 0x80, 0x08, 0x08, 0x80, 0x0C, 0x43, 0x81, 0x19, 0x04, 0x81, 0x91,
+        0x43, 0x80, 0x0C, 0x09, 0x81, 0xE2, 0x43, 0x86, 0x7D, 0x02, 0x72, 0x0D, 0x43, 0x81, 0x2E, 0x0A,
+        0x81, 0xE3, 0x4C, 0x81, 0x3E, 0x0C, 0x81, 0xC3, 0x4A, 0x81, 0x3C, 0x0E, 0x81, 0x81, 0x48, 0x81,
+        0x18, 0x11, 0x88, 0x72, 0xEB, 0xEF, 0x7B, 0x02, 0x09, 0x08, 0x84, 0xB1, 0xBF, 0x01, 0x07, 0x85,
+        0xC1, 0xFF, 0x7F, 0x06, 0x81, 0xC1, 0x43, 0x80, 0x08, 0x05, 0x81, 0xC1, 0x44, 0x80, 0x08, 0x04,
+        0x81, 0xD3, 0x45, 0x80, 0x08, 0x03, 0x81, 0xE3, 0x46, 0x85, 0x08, 0x00, 0xE3, 0x43, 0x88, 0xFE,
+        0xFF, 0x08, 0x30, 0x0E, 0x43, 0x88, 0x89, 0xFF, 0x8F, 0x30, 0x0E, 0x43, 0x88, 0x09, 0xF8, 0xFF,
+        0x38, 0x0E, 0x43, 0x88, 0x09, 0x80, 0xFF, 0x8F, 0x0A, 0x43, 0x8D, 0x08, 0x00, 0xF8, 0xFF, 0x88,
+        0xFF, 0x6F, 0x03, 0x88, 0xF8, 0xFF, 0x18, 0xB9, 0x05, 0x04, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84,
+        0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8,
+        0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF,
+        0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08,
+        0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08,
+        0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84,
+        0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8,
+        0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF,
+        0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08,
+        0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x08,
+        0x84, 0xF7, 0xFF, 0x07, 0x08, 0x84, 0xB1, 0xBF, 0x01, 0x08, 0x8A, 0x61, 0xCA, 0xFF, 0xCF, 0x79,
+        0x01, 0x0F, 0x81, 0x92, 0x4A, 0x81, 0x29, 0x0C, 0x80, 0x07, 0x4E, 0x80, 0x07, 0x09, 0x81, 0x91,
+        0x50, 0x81, 0x1A, 0x07, 0x80, 0x0B, 0x44, 0x88, 0x7D, 0x04, 0x00, 0x74, 0x0D, 0x44, 0x80, 0x0C,
+        0x06, 0x80, 0x09, 0x43, 0x81, 0x6E, 0x08, 0x81, 0xE6, 0x43, 0x80, 0x08, 0x04, 0x80, 0x04, 0x43,
+        0x81, 0x1C, 0x0A, 0x81, 0xC2, 0x43, 0x80, 0x05, 0x03, 0x85, 0xFD, 0xFF, 0x1C, 0x0C, 0x89, 0xD1,
+        0xFF, 0xDF, 0x00, 0x60, 0x43, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x43, 0x87, 0x06, 0xA0, 0xFF, 0x9F,
+        0x10, 0x8B, 0xF9, 0xFF, 0x0B, 0xA0, 0xFF, 0x2F, 0x10, 0x80, 0x02, 0x43, 0x01, 0x83, 0xA1, 0x6D,
+        0x12, 0x84, 0xFD, 0xFF, 0x04, 0x17, 0x84, 0xF9, 0xFF, 0x07, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17,
+        0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF9, 0xFF, 0x07, 0x17, 0x84, 0xFC, 0xFF, 0x04, 0x16, 0x80,
+        0x02, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x0A, 0x16, 0x80, 0x06, 0x43, 0x80, 0x06, 0x15,
+        0x80, 0x06, 0x43, 0x80, 0x0D, 0x15, 0x80, 0x06, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x08, 0x43, 0x81,
+        0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09,
+        0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14,
+        0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81,
+        0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09, 0x43, 0x81, 0x3E, 0x14, 0x80, 0x09,
+        0x43, 0x81, 0x3D, 0x14, 0x80, 0x09, 0x43, 0x81, 0x1C, 0x14, 0x80, 0x09, 0x43, 0x81, 0x1C, 0x13,
+        0x81, 0xB1, 0x43, 0x81, 0x1C, 0x13, 0x81, 0xC1, 0x43, 0x81, 0x1C, 0x13, 0x81, 0xC1, 0x43, 0x81,
+        0x1C, 0x13, 0x81, 0xC1, 0x43, 0x81, 0x1C, 0x13, 0x81, 0xC1, 0x58, 0x82, 0x1B, 0x07, 0x5A, 0x81,
+        0x77, 0x5A, 0x82, 0x17, 0x0B, 0x58, 0x81, 0x1B, 0x06, 0x8A, 0x61, 0xB9, 0xFF, 0xBF, 0x69, 0x01,
+        0x0D, 0x81, 0x92, 0x4A, 0x81, 0x29, 0x0A, 0x81, 0xE7, 0x4C, 0x81, 0x7E, 0x08, 0x80, 0x09, 0x50,
+        0x80, 0x09, 0x06, 0x80, 0x09, 0x44, 0x88, 0x8D, 0x04, 0x00, 0x84, 0x0D, 0x44, 0x80, 0x09, 0x04,
+        0x80, 0x07, 0x43, 0x81, 0x7E, 0x08, 0x81, 0xE7, 0x43, 0x84, 0x07, 0x00, 0x01, 0x43, 0x81, 0x3D,
+        0x0A, 0x81, 0xD3, 0x43, 0x88, 0x02, 0x30, 0xFF, 0xEF, 0x02, 0x0C, 0x8C, 0xE2, 0xFF, 0x9F, 0x00,
+        0x90, 0xFF, 0x05, 0x0E, 0x80, 0x06, 0x43, 0x03, 0x81, 0x13, 0x10, 0x84, 0xFD, 0xFF, 0x05, 0x15,
+        0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF7, 0xFF, 0x09, 0x15, 0x84, 0xF4, 0xFF, 0x0B, 0x15, 0x84,
+        0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF9, 0xFF, 0x08, 0x14, 0x85, 0xE1, 0xFF, 0x4F, 0x14, 0x84, 0xF8,
+        0xFF, 0x0E, 0x14, 0x80, 0x04, 0x43, 0x80, 0x08, 0x13, 0x86, 0xE4, 0xFF, 0xEF, 0x01, 0x0C, 0x86,
+        0xB8, 0xAB, 0x48, 0x08, 0x44, 0x80, 0x04, 0x0C, 0x80, 0x06, 0x4A, 0x80, 0x06, 0x0D, 0x80, 0x08,
+        0x49, 0x80, 0x07, 0x0E, 0x80, 0x08, 0x49, 0x81, 0x2C, 0x0D, 0x80, 0x06, 0x4A, 0x81, 0x3E, 0x0D,
+        0x87, 0xB8, 0xAB, 0x37, 0xD6, 0x43, 0x81, 0x1D, 0x13, 0x81, 0x91, 0x43, 0x80, 0x0A, 0x15, 0x80,
+        0x09, 0x43, 0x80, 0x04, 0x15, 0x84, 0xFC, 0xFF, 0x0A, 0x15, 0x80, 0x04, 0x43, 0x80, 0x01, 0x15,
+        0x84, 0xFD, 0xFF, 0x04, 0x15, 0x84, 0xF9, 0xFF, 0x07, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84,
+        0xF8, 0xFF, 0x08, 0x15, 0x87, 0xFC, 0xFF, 0x04, 0x32, 0x11, 0x80, 0x02, 0x43, 0x84, 0x61, 0xFF,
+        0x09, 0x10, 0x8A, 0xFA, 0xFF, 0x0C, 0xFD, 0xFF, 0x07, 0x0E, 0x80, 0x07, 0x43, 0x82, 0x05, 0x0A,
+        0x43, 0x80, 0x07, 0x0C, 0x80, 0x07, 0x43, 0x84, 0x0B, 0x30, 0x0E, 0x43, 0x81, 0x2B, 0x08, 0x81,
+        0xB2, 0x43, 0x85, 0x3E, 0x00, 0x50, 0x45, 0x88, 0x7B, 0x04, 0x00, 0x74, 0x0B, 0x45, 0x80, 0x05,
+        0x04, 0x81, 0xE3, 0x50, 0x81, 0x3E, 0x06, 0x81, 0xB2, 0x4E, 0x81, 0x2B, 0x09, 0x81, 0xB5, 0x4A,
+        0x81, 0x5B, 0x0D, 0x8A, 0x72, 0xCA, 0xFF, 0xCF, 0x7A, 0x02, 0x08, 0x11, 0x84, 0xB1, 0xBF, 0x01,
+        0x17, 0x84, 0xF8, 0xFF, 0x07, 0x16, 0x80, 0x03, 0x43, 0x80, 0x08, 0x16, 0x80, 0x0C, 0x43, 0x80,
+        0x08, 0x15, 0x80, 0x08, 0x44, 0x80, 0x08, 0x14, 0x80, 0x02, 0x45, 0x80, 0x08, 0x14, 0x80, 0x0B,
+        0x45, 0x80, 0x08, 0x13, 0x80, 0x07, 0x46, 0x80, 0x08, 0x12, 0x81, 0xE2, 0x46, 0x80, 0x08, 0x12,
+        0x89, 0xFA, 0xFF, 0x9E, 0xFF, 0x8F, 0x11, 0x80, 0x05, 0x43, 0x85, 0x87, 0xFF, 0x8F, 0x10, 0x8B,
+        0xE1, 0xFF, 0xBF, 0x80, 0xFF, 0x8F, 0x10, 0x80, 0x09, 0x43, 0x86, 0x02, 0xF8, 0xFF, 0x08, 0x0F,
+        0x80, 0x04, 0x43, 0x87, 0x08, 0x80, 0xFF, 0x8F, 0x0E, 0x8D, 0xD1, 0xFF, 0xCF, 0x00, 0x80, 0xFF,
+        0x8F, 0x0E, 0x80, 0x08, 0x43, 0x88, 0x03, 0x00, 0xF8, 0xFF, 0x08, 0x0D, 0x80, 0x03, 0x43, 0x80,
+        0x08, 0x03, 0x84, 0xF8, 0xFF, 0x08, 0x0D, 0x85, 0xFC, 0xFF, 0x1D, 0x03, 0x84, 0xF8, 0xFF, 0x08,
+        0x0C, 0x80, 0x08, 0x43, 0x80, 0x04, 0x04, 0x84, 0xF8, 0xFF, 0x08, 0x0B, 0x80, 0x02, 0x43, 0x80,
+        0x09, 0x05, 0x84, 0xF8, 0xFF, 0x08, 0x0B, 0x85, 0xFB, 0xFF, 0x1E, 0x05, 0x84, 0xF8, 0xFF, 0x08,
+        0x0A, 0x80, 0x07, 0x43, 0x80, 0x05, 0x06, 0x84, 0xF8, 0xFF, 0x08, 0x09, 0x85, 0xE2, 0xFF, 0xAF,
+        0x07, 0x84, 0xF8, 0xFF, 0x08, 0x09, 0x85, 0xFA, 0xFF, 0x2E, 0x07, 0x84, 0xF8, 0xFF, 0x08, 0x08,
+        0x80, 0x05, 0x43, 0x80, 0x07, 0x08, 0x84, 0xF8, 0xFF, 0x08, 0x07, 0x85, 0xE1, 0xFF, 0xBF, 0x09,
+        0x84, 0xF8, 0xFF, 0x08, 0x07, 0x80, 0x09, 0x43, 0x80, 0x02, 0x09, 0x84, 0xF8, 0xFF, 0x08, 0x06,
+        0x80, 0x04, 0x43, 0x80, 0x08, 0x0A, 0x84, 0xF8, 0xFF, 0x08, 0x05, 0x81, 0xD1, 0x58, 0x82, 0x1B,
+        0x07, 0x5A, 0x81, 0x77, 0x5A, 0x82, 0x17, 0x0B, 0x58, 0x81, 0x1B, 0x11, 0x84, 0xF8, 0xFF, 0x08,
+        0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17,
+        0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84,
+        0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF8, 0xFF, 0x08, 0x17, 0x84, 0xF7,
+        0xFF, 0x07, 0x17, 0x84, 0xB1, 0xBF, 0x01, 0x05, 0x00, 0x81, 0xE6, 0x53, 0x84, 0x3D, 0x00, 0x00,
+        0x56, 0x83, 0x0C, 0x20, 0x56, 0x83, 0x0C, 0x40, 0x55, 0x88, 0x3D, 0x00, 0xF4, 0xFF, 0x0B, 0x15,
+        0x84, 0xF4, 0xFF, 0x0B, 0x15, 0x84, 0xF4, 0xFF, 0x0B, 0x15, 0x84, 0xF4, 0xFF, 0x0B, 0x15, 0x84,
+        0xF4, 0xFF, 0x0B, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF8,
+        0xFF, 0x08, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84, 0xF8, 0xFF,
+        0x08, 0x03, 0x86, 0x83, 0x88, 0x68, 0x04, 0x0A, 0x88, 0xF9, 0xFF, 0x07, 0x92, 0x0D, 0x46, 0x82,
+        0x8E, 0x02, 0x07, 0x85, 0xFB, 0xFF, 0x85, 0x4C, 0x80, 0x08, 0x06, 0x84, 0xFB, 0xFF, 0x0E, 0x4E,
+        0x81, 0x3C, 0x04, 0x80, 0x0B, 0x47, 0x86, 0x9E, 0x88, 0xA8, 0x0E, 0x44, 0x81, 0x3E, 0x03, 0x80,
+        0x0B, 0x45, 0x81, 0x6D, 0x06, 0x81, 0xD6, 0x43, 0x85, 0x1E, 0x00, 0xB0, 0x44, 0x81, 0x19, 0x08,
+        0x81, 0x91, 0x43, 0x84, 0x0C, 0x00, 0x0B, 0x43, 0x80, 0x09, 0x0C, 0x80, 0x09, 0x43, 0x82, 0x06,
+        0x00, 0x43, 0x80, 0x0B, 0x0E, 0x8B, 0xFA, 0xFF, 0x1D, 0xA0, 0xFF, 0x2E, 0x0E, 0x80, 0x02, 0x43,
+        0x85, 0x06, 0xA3, 0x3B, 0x10, 0x84, 0xF8, 0xFF, 0x0A, 0x15, 0x80, 0x03, 0x43, 0x80, 0x01, 0x15,
+        0x84, 0xFD, 0xFF, 0x04, 0x15, 0x84, 0xFB, 0xFF, 0x04, 0x15, 0x84, 0xF8, 0xFF, 0x08, 0x15, 0x84,
+        0xF8, 0xFF, 0x08, 0x15, 0x84, 0xFA, 0xFF, 0x06, 0x15, 0x84, 0xFB, 0xFF, 0x04, 0x14, 0x80, 0x01,
+        0x43, 0x83, 0x02, 0x65, 0x11, 0x89, 0xF6, 0xFF, 0x0C, 0xF8, 0xBF, 0x10, 0x8A, 0xFD, 0xFF, 0x08,
+        0xFD, 0xFF, 0x08, 0x0E, 0x80, 0x07, 0x43, 0x82, 0x02, 0x09, 0x43, 0x80, 0x03, 0x0C, 0x80, 0x03,
+        0x43, 0x89, 0x09, 0x10, 0xFE, 0xFF, 0x3E, 0x0A, 0x8A, 0xE4, 0xFF, 0xEF, 0x01, 0x00, 0x05, 0x44,
+        0x81, 0x18, 0x06, 0x81, 0x81, 0x44, 0x80, 0x06, 0x04, 0x80, 0x08, 0x44, 0x88, 0x8D, 0x25, 0x20,
+        0x84, 0x0E, 0x44, 0x80, 0x06, 0x06, 0x80, 0x06, 0x50, 0x80, 0x08, 0x08, 0x81, 0xD5, 0x4C, 0x81,
+        0x4E, 0x0A, 0x82, 0x81, 0x0E, 0x48, 0x82, 0x8E, 0x01, 0x0E, 0x88, 0x95, 0xEB, 0xEF, 0x9B, 0x06,
+        0x09, 0x09, 0x88, 0x72, 0xFB, 0xEF, 0x7B, 0x02, 0x11, 0x81, 0x81, 0x48, 0x81, 0x18, 0x0E, 0x81,
+        0xC3, 0x4A, 0x81, 0x3C, 0x0C, 0x81, 0xE3, 0x4C, 0x81, 0x3E, 0x0A, 0x81, 0xE2, 0x43, 0x86, 0x6D,
+        0x02, 0x62, 0x0D, 0x43, 0x81, 0x2E, 0x09, 0x80, 0x0C, 0x43, 0x81, 0x19, 0x04, 0x81, 0x91, 0x43,
+        0x80, 0x0C, 0x08, 0x80, 0x08, 0x43, 0x80, 0x09, 0x08, 0x80, 0x09, 0x43, 0x80, 0x04, 0x06, 0x85,
+        0xE2, 0xFF, 0xAF, 0x0A, 0x84, 0xFA, 0xEF, 0x01, 0x06, 0x85, 0xF9, 0xFF, 0x1E, 0x0A, 0x83, 0x81,
+        0x3A, 0x06, 0x80, 0x01, 0x43, 0x80, 0x06, 0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFC, 0xFF,
+        0x07, 0x16, 0x80, 0x02, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF7, 0xFF, 0x0B, 0x17, 0x84, 0xFA, 0xFF,
+        0x07, 0x17, 0x84, 0xFD, 0xFF, 0x04, 0x17, 0x43, 0x03, 0x8A, 0x61, 0xCA, 0xFF, 0xCF, 0x6A, 0x01,
+        0x08, 0x88, 0xF4, 0xFF, 0x0C, 0x20, 0x09, 0x4A, 0x81, 0x29, 0x06, 0x86, 0xF4, 0xFF, 0x0B, 0x08,
+        0x4E, 0x80, 0x08, 0x05, 0x85, 0xF7, 0xFF, 0x9A, 0x50, 0x81, 0x19, 0x03, 0x80, 0x08, 0x48, 0x88,
+        0x7D, 0x04, 0x00, 0x74, 0x0D, 0x44, 0x80, 0x0B, 0x03, 0x80, 0x08, 0x46, 0x81, 0x6E, 0x08, 0x81,
+        0xE6, 0x43, 0x84, 0x09, 0x00, 0x08, 0x45, 0x81, 0x1C, 0x0A, 0x81, 0xC1, 0x43, 0x83, 0x05, 0x80,
+        0x44, 0x81, 0x1C, 0x0C, 0x88, 0xC1, 0xFF, 0xDF, 0x00, 0x08, 0x44, 0x80, 0x03, 0x0E, 0x80, 0x03,
+        0x43, 0x82, 0x06, 0x04, 0x43, 0x80, 0x09, 0x10, 0x86, 0xF9, 0xFF, 0x0A, 0x04, 0x43, 0x80, 0x02,
+        0x10, 0x80, 0x02, 0x43, 0x81, 0x41, 0x43, 0x12, 0x85, 0xFC, 0xFF, 0x74, 0x43, 0x80, 0x04, 0x11,
+        0x85, 0xF9, 0xFF, 0x87, 0x43, 0x80, 0x02, 0x11, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89,
+        0xF8, 0xFF, 0x78, 0xFF, 0x9F, 0x12, 0x89, 0xF9, 0xFF, 0x47, 0xFF, 0xCF, 0x12, 0x85, 0xFC, 0xFF,
+        0x14, 0x43, 0x80, 0x02, 0x10, 0x80, 0x02, 0x43, 0x86, 0x01, 0xFA, 0xFF, 0x09, 0x10, 0x87, 0xF9,
+        0xFF, 0x0A, 0x60, 0x43, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x43, 0x89, 0x06, 0x00, 0xFD, 0xFF, 0x1C,
+        0x0C, 0x85, 0xC1, 0xFF, 0xDF, 0x03, 0x80, 0x05, 0x43, 0x81, 0x1C, 0x0A, 0x81, 0xC1, 0x43, 0x80,
+        0x05, 0x04, 0x80, 0x09, 0x43, 0x81, 0x6E, 0x08, 0x81, 0xE6, 0x43, 0x80, 0x09, 0x06, 0x80, 0x0B,
+        0x44, 0x88, 0x7D, 0x04, 0x00, 0x74, 0x0D, 0x44, 0x80, 0x0B, 0x07, 0x81, 0x91, 0x50, 0x81, 0x19,
+        0x09, 0x80, 0x08, 0x4E, 0x80, 0x08, 0x0C, 0x81, 0x92, 0x4A, 0x81, 0x29, 0x0F, 0x8A, 0x61, 0xCA,
+        0xFF, 0xCF, 0x6A, 0x01, 0x08, 0x81, 0xB1, 0x58, 0x82, 0x1B, 0x07, 0x5A, 0x81, 0x77, 0x5A, 0x82,
+        0x17, 0x0B, 0x59, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43, 0x80, 0x04,
+        0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFD, 0xFF, 0x07, 0x16, 0x80, 0x04, 0x43, 0x80, 0x01,
+        0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43, 0x80, 0x04, 0x16, 0x84, 0xF7, 0xFF, 0x0D,
+        0x17, 0x84, 0xFD, 0xFF, 0x07, 0x16, 0x80, 0x04, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09,
+        0x16, 0x80, 0x01, 0x43, 0x80, 0x04, 0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFD, 0xFF, 0x07,
+        0x16, 0x80, 0x04, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43, 0x80,
+        0x04, 0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFD, 0xFF, 0x07, 0x16, 0x80, 0x04, 0x43, 0x80,
+        0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43, 0x80, 0x04, 0x16, 0x84, 0xF7, 0xFF,
+        0x0D, 0x17, 0x84, 0xFD, 0xFF, 0x07, 0x16, 0x80, 0x04, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF,
+        0x09, 0x16, 0x80, 0x01, 0x43, 0x80, 0x04, 0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFD, 0xFF,
+        0x07, 0x16, 0x80, 0x04, 0x43, 0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43,
+        0x80, 0x04, 0x16, 0x84, 0xF7, 0xFF, 0x0D, 0x17, 0x84, 0xFD, 0xFF, 0x07, 0x16, 0x80, 0x04, 0x43,
+        0x80, 0x01, 0x16, 0x84, 0xF9, 0xFF, 0x09, 0x16, 0x80, 0x01, 0x43, 0x80, 0x04, 0x16, 0x84, 0xF7,
+        0xFF, 0x0D, 0x17, 0x84, 0xF7, 0xFF, 0x07, 0x17, 0x84, 0xB1, 0xBF, 0x01, 0x0F, 0x09, 0x88, 0x95,
+        0xFC, 0xFF, 0x9C, 0x05, 0x11, 0x81, 0xD8, 0x48, 0x81, 0x8D, 0x0D, 0x81, 0xC3, 0x4C, 0x81, 0x3C,
+        0x0A, 0x81, 0xE3, 0x4E, 0x81, 0x3E, 0x08, 0x81, 0xE2, 0x43, 0x88, 0x8E, 0x14, 0x10, 0x84, 0x0E,
+        0x43, 0x81, 0x2E, 0x07, 0x80, 0x0B, 0x43, 0x81, 0x1A, 0x06, 0x81, 0xA1, 0x43, 0x80, 0x0B, 0x06,
+        0x80, 0x06, 0x43, 0x80, 0x09, 0x0A, 0x80, 0x09, 0x43, 0x80, 0x06, 0x05, 0x84, 0xFD, 0xFF, 0x0A,
+        0x0C, 0x84, 0xFA, 0xFF, 0x0D, 0x04, 0x80, 0x03, 0x43, 0x80, 0x02, 0x0C, 0x80, 0x02, 0x43, 0x80,
+        0x03, 0x03, 0x84, 0xF8, 0xFF, 0x09, 0x0E, 0x84, 0xF9, 0xFF, 0x08, 0x03, 0x84, 0xFB, 0xFF, 0x05,
+        0x0E, 0x84, 0xF5, 0xFF, 0x0B, 0x03, 0x84, 0xFB, 0xFF, 0x04, 0x0E, 0x84, 0xF4, 0xFF, 0x0B, 0x03,
+        0x84, 0xFE, 0xFF, 0x01, 0x0E, 0x84, 0xF1, 0xFF, 0x0E, 0x03, 0x84, 0xFB, 0xFF, 0x04, 0x0E, 0x84,
+        0xF4, 0xFF, 0x0B, 0x03, 0x84, 0xFB, 0xFF, 0x06, 0x0E, 0x84, 0xF6, 0xFF, 0x0B, 0x03, 0x84, 0xF8,
+        0xFF, 0x0A, 0x0E, 0x84, 0xFA, 0xFF, 0x08, 0x03, 0x80, 0x03, 0x43, 0x80, 0x03, 0x0C, 0x80, 0x03,
+        0x43, 0x80, 0x03, 0x04, 0x85, 0xFB, 0xFF, 0x1C, 0x0A, 0x85, 0xC1, 0xFF, 0xBF, 0x05, 0x80, 0x04,
+        0x43, 0x81, 0x1B, 0x08, 0x81, 0xB1, 0x43, 0x80, 0x04, 0x06, 0x80, 0x0A, 0x43, 0x8A, 0x6C, 0xA8,
+        0xBB, 0xAB, 0x68, 0x0C, 0x43, 0x80, 0x0A, 0x07, 0x81, 0xC1, 0x50, 0x81, 0x1C, 0x08, 0x81, 0xE2,
+        0x4E, 0x81, 0x2E, 0x08, 0x81, 0xC3, 0x50, 0x81, 0x3C, 0x06, 0x81, 0xE3, 0x52, 0x81, 0x3E, 0x04,
+        0x81, 0xD1, 0x43, 0x8C, 0x6D, 0x72, 0xB9, 0xBB, 0x79, 0x62, 0x0D, 0x43, 0x81, 0x1D, 0x03, 0x80,
+        0x0A, 0x43, 0x81, 0x19, 0x0A, 0x81, 0x91, 0x43, 0x84, 0x0A, 0x00, 0x04, 0x43, 0x80, 0x09, 0x0E,
+        0x80, 0x09, 0x43, 0x87, 0x04, 0xA0, 0xFF, 0xCF, 0x10, 0x86, 0xFC, 0xFF, 0x0A, 0x01, 0x43, 0x80,
+        0x04, 0x10, 0x80, 0x04, 0x43, 0x85, 0x41, 0xFF, 0xCF, 0x12, 0x89, 0xFC, 0xFF, 0x84, 0xFF, 0x8F,
+        0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF, 0x8F, 0x12, 0x89,
+        0xF8, 0xFF, 0x58, 0xFF, 0xCF, 0x12, 0x85, 0xFC, 0xFF, 0x15, 0x43, 0x80, 0x02, 0x10, 0x80, 0x02,
+        0x43, 0x86, 0x01, 0xFB, 0xFF, 0x0A, 0x10, 0x87, 0xFA, 0xFF, 0x0B, 0x60, 0x43, 0x80, 0x06, 0x0E,
+        0x80, 0x06, 0x43, 0x84, 0x06, 0x00, 0x0B, 0x43, 0x80, 0x07, 0x0C, 0x80, 0x07, 0x43, 0x80, 0x0B,
+        0x03, 0x81, 0xE3, 0x43, 0x81, 0x2B, 0x08, 0x81, 0xB2, 0x43, 0x81, 0x3E, 0x04, 0x80, 0x06, 0x45,
+        0x88, 0x6A, 0x04, 0x00, 0x64, 0x0A, 0x45, 0x80, 0x06, 0x06, 0x81, 0xE5, 0x50, 0x81, 0x5E, 0x08,
+        0x81, 0xB2, 0x4E, 0x81, 0x2B, 0x0B, 0x81, 0xB5, 0x4A, 0x81, 0x5B, 0x0F, 0x8A, 0x73, 0xDB, 0xFF,
+        0xDF, 0x7B, 0x03, 0x08, 0x08, 0x8A, 0x61, 0xCA, 0xFF, 0xCF, 0x6A, 0x01, 0x0F, 0x81, 0x92, 0x4A,
+        0x81, 0x29, 0x0C, 0x80, 0x08, 0x4E, 0x80, 0x08, 0x09, 0x81, 0x91, 0x50, 0x81, 0x19, 0x07, 0x80,
+        0x0B, 0x44, 0x88, 0x7D, 0x04, 0x00, 0x74, 0x0D, 0x44, 0x80, 0x0B, 0x06, 0x80, 0x09, 0x43, 0x81,
+        0x6E, 0x08, 0x81, 0xE6, 0x43, 0x80, 0x09, 0x04, 0x80, 0x05, 0x43, 0x81, 0x1C, 0x0A, 0x81, 0xC1,
+        0x43, 0x80, 0x05, 0x03, 0x85, 0xFD, 0xFF, 0x1C, 0x0C, 0x89, 0xC1, 0xFF, 0xDF, 0x00, 0x60, 0x43,
+        0x80, 0x03, 0x0E, 0x80, 0x03, 0x43, 0x87, 0x06, 0xA0, 0xFF, 0x9F, 0x10, 0x86, 0xF9, 0xFF, 0x0A,
+        0x01, 0x43, 0x80, 0x02, 0x10, 0x80, 0x02, 0x43, 0x85, 0x41, 0xFF, 0xCF, 0x12, 0x89, 0xFC, 0xFF,
+        0x74, 0xFF, 0x9F, 0x12, 0x89, 0xF9, 0xFF, 0x87, 0xFF, 0x8F, 0x12, 0x89, 0xF8, 0xFF, 0x88, 0xFF,
+        0x8F, 0x11, 0x80, 0x02, 0x43, 0x85, 0x78, 0xFF, 0x9F, 0x11, 0x80, 0x04, 0x43, 0x85, 0x47, 0xFF,
+        0xCF, 0x12, 0x43, 0x81, 0x14, 0x43, 0x80, 0x02, 0x10, 0x80, 0x02, 0x43, 0x86, 0x04, 0xFA, 0xFF,
+        0x09, 0x10, 0x80, 0x09, 0x43, 0x82, 0x04, 0x06, 0x43, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x44, 0x88,
+        0x08, 0xD0, 0xFF, 0xCF, 0x01, 0x0C, 0x81, 0xC1, 0x44, 0x83, 0x08, 0x50, 0x43, 0x81, 0x1C, 0x0A,
+        0x81, 0xC1, 0x45, 0x84, 0x08, 0x00, 0x09, 0x43, 0x81, 0x6E, 0x08, 0x81, 0xE6, 0x46, 0x80, 0x08,
+        0x03, 0x80, 0x0B, 0x44, 0x88, 0x7D, 0x04, 0x00, 0x74, 0x0D, 0x48, 0x80, 0x08, 0x03, 0x81, 0x91,
+        0x50, 0x85, 0xA9, 0xFF, 0x7F, 0x05, 0x80, 0x08, 0x4E, 0x86, 0x08, 0xFB, 0xFF, 0x04, 0x06, 0x81,
+        0x92, 0x4A, 0x88, 0x29, 0x00, 0xFC, 0xFF, 0x04, 0x08, 0x8A, 0x61, 0xCA, 0xFF, 0xCF, 0x6A, 0x01,
+        0x03, 0x43, 0x17, 0x84, 0xF4, 0xFF, 0x0D, 0x17, 0x84, 0xF7, 0xFF, 0x0A, 0x17, 0x84, 0xFB, 0xFF,
+        0x07, 0x16, 0x80, 0x01, 0x43, 0x80, 0x02, 0x16, 0x84, 0xF7, 0xFF, 0x0C, 0x17, 0x84, 0xFD, 0xFF,
+        0x07, 0x16, 0x80, 0x06, 0x43, 0x80, 0x01, 0x06, 0x83, 0xA3, 0x18, 0x0A, 0x85, 0xE1, 0xFF, 0x9F,
+        0x06, 0x84, 0xE1, 0xFF, 0x0A, 0x0A, 0x85, 0xFA, 0xFF, 0x2E, 0x06, 0x80, 0x04, 0x43, 0x80, 0x09,
+        0x08, 0x80, 0x09, 0x43, 0x80, 0x08, 0x08, 0x80, 0x0C, 0x43, 0x81, 0x19, 0x04, 0x81, 0x91, 0x43,
+        0x80, 0x0C, 0x09, 0x81, 0xE2, 0x43, 0x86, 0x6D, 0x02, 0x62, 0x0D, 0x43, 0x81, 0x2E, 0x0A, 0x81,
+        0xE3, 0x4C, 0x81, 0x3E, 0x0C, 0x81, 0xC3, 0x4A, 0x81, 0x3C, 0x0E, 0x81, 0x81, 0x48, 0x81, 0x18,
+        0x11, 0x88, 0x72, 0xEB, 0xFF, 0x7B, 0x02, 0x09, 0x93, 0xB1, 0xBF, 0x71, 0xFF, 0x7F, 0xF7, 0xFF,
+        0x17, 0xFB, 0x1B, 0x3F, 0x0F, 0x93, 0xB1, 0xBF, 0x71, 0xFF, 0x7F, 0xF7, 0xFF, 0x17, 0xFB, 0x1B,
+    };
+
+    // code, w, h, x_off, y_off, advance, offset (sorted by code)
+    inline constexpr GlyphInfo stroke40_glyphs[] = {
+        {0x30, 29, 44,   0,   2, 29,     0},  // 0
+        {0x31, 14, 44,   5,   2, 29,   377},  // 1
+        {0x32, 29, 44,   0,   2, 29,   617},  // 2
+        {0x33, 27, 44,   2,   2, 29,   904},  // 3
+        {0x34, 29, 44,   0,   2, 29,  1211},  // 4
+        {0x35, 27, 44,   2,   2, 29,  1528},  // 5
+        {0x36, 29, 44,   0,   2, 29,  1841},  // 6
+        {0x37, 29, 44,   0,   2, 29,  2213},  // 7
+        {0x38, 29, 44,   0,   2, 29,  2445},  // 8
+        {0x39, 29, 44,   0,   2, 29,  2852},  // 9
+        {0x3A,  5, 24,   6,  14, 17,  3224},  // :
+    };
+
+    // left, right, adjust (sorted by left, right)
+    inline constexpr KernPair stroke40_kerning[] = {
+        {0x3A, 0x3A, -6},  // ::
+    };
+
+    inline constexpr Font stroke40 = {
+        stroke40_glyphs, sizeof(stroke40_glyphs) / sizeof(GlyphInfo),
+        stroke40_rle,
+        stroke40_kerning, sizeof(stroke40_kerning) / sizeof(KernPair),
+        48,
+    };
+
+} // namespace gfx::fonts
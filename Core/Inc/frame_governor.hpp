@@ -0,0 +1,55 @@
+/// @file    frame_governor.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+/// @brief  keeps frames inside a time budget by stepping a quality level
+/// @note   level 0 is full quality, higher levels are cheaper; the caller decides what
+///         each level drops. A frame costs the larger of its render and transfer time:
+///         with double buffering the two overlap and the slower one sets the frame rate.
+///         DOWN_FRAMES misses in a row step down one level, UP_FRAMES frames in a row
+///         under UP_PERCENT of the budget step back up, so a level is not left on a
+///         single spike nor re-entered right after leaving it.
+class FrameGovernor {
+    public:
+        static constexpr uint8_t DOWN_FRAMES {3};
+        static constexpr uint16_t UP_FRAMES {100};
+        static constexpr uint8_t UP_PERCENT {70};
+
+        /// @param budget_us frame period to hold
+        /// @param levels    number of quality levels (at least 1)
+        FrameGovernor(uint32_t budget_us, uint8_t levels);
+
+        /// @brief  account one presented frame
+        /// @return true when the level changed
+        bool report(uint32_t render_us, uint32_t transfer_us);
+
+        uint8_t level() const { return level_; }
+        uint32_t budget_us() const { return budget_us_; }
+
+        /// @brief frames over budget since construction
+        uint32_t misses() const { return misses_; }
+        /// @brief frames reported since construction
+        uint32_t frames() const { return frames_; }
+        /// @brief level changes since construction
+        uint32_t changes() const { return changes_; }
+
+        /// @brief frames over budget since the last reset_window()
+        uint32_t window_misses() const { return window_misses_; }
+        /// @brief slowest frame cost since the last reset_window()
+        uint32_t window_worst_us() const { return window_worst_us_; }
+        /// @brief start a new telemetry window
+        void reset_window();
+
+    private:
+        uint32_t budget_us_;
+        uint8_t levels_;
+        uint8_t level_;
+        uint8_t over_run_;      // consecutive misses
+        uint16_t under_run_;    // consecutive frames with headroom
+        uint32_t misses_;
+        uint32_t frames_;
+        uint32_t changes_;
+        uint32_t window_misses_;
+        uint32_t window_worst_us_;
+};
@@ -0,0 +1,107 @@
+/// @file    frame_pacer.hpp
+#pragma once
+#include "main.hpp"
+#include "panel.hpp"
+#include "timebase.hpp"
+#include <cstdint>
+
+/// @brief  times display transfers against the panel's refresh scan so the scan never
+///         crosses rows while they are being written (tear-free updates)
+/// @note   the refresh phase comes from the panel's TE output (V-blank mode, rising edge at
+///         the start of each blank) on an EXTI line. Without an edge for TE_TIMEOUT periods
+///         the pacer keeps extrapolating from the last edge with the measured (or, before
+///         any edge, the descriptor's nominal) period: frames stay locked to the refresh
+///         rate, but before the first edge the phase is a guess.
+///         A transfer of rows y0..y1 taking D starts once the scan has left those rows, and
+///         only if it ends before the next scan reaches them. When D is longer than that
+///         window it starts right behind the scan instead and is counted as a tear risk.
+///         D is predicted from the measured cost of earlier transfers (record_transfer()).
+class FramePacer {
+    public:
+        static constexpr uint8_t MAX_PACERS {2};
+        static constexpr uint8_t TE_TIMEOUT {3};        // refreshes without an edge before falling back
+
+        /// @brief telemetry since the last reset_window()
+        struct Stats {
+            uint32_t presents;      // scheduled transfers
+            uint32_t te_edges;
+            uint32_t missed;        // refreshes that began without the app taking them (take_refresh())
+            uint32_t tear_risks;    // transfers too long for a tear-free window
+            uint32_t phase_us_sum;  // start time after the refresh began
+            uint32_t latency_us_sum;    // content sample -> rows scanned out with the new content
+            uint32_t latency_us_max;
+        };
+
+        explicit FramePacer(const lcd::Panel& panel);
+
+        /// @brief  take the panel TE signal on an EXTI pin (rising edge, pulled down when unwired)
+        /// @param  pin a single pin on EXTI lines 5..15 (shared vectors), port clock already on
+        /// @return false for a pin on another line or when all slots are taken
+        bool attach_te(GPIO_TypeDef* port, uint16_t pin);
+        /// @brief route an EXTI callback to the pacer that owns the pin
+        static void dispatch_te(uint16_t pin);
+        /// @brief TE edge, interrupt context
+        void on_te();
+
+        /// @brief TE edges arrived within the last TE_TIMEOUT refreshes (as seen by take_refresh())
+        bool synced() const;
+        uint32_t period_us() const { return (uint32_t)timebase::to_us(period_); }
+
+        /// @brief  refreshes begun since the last call; more than one means the ones in between
+        ///         were missed and are counted. Call from the main loop at least once a refresh.
+        uint32_t take_refresh();
+
+        /// @brief  when to start a transfer
+        /// @param  y0, y1 visible rows touched, inclusive
+        /// @param  input  timebase::cycles() the content was sampled, for the latency figure
+        /// @return timebase::cycles() value, pass to timebase::wait_until()
+        uint64_t schedule(uint16_t y0, uint16_t y1, uint32_t pixels, uint8_t elements, uint64_t input);
+
+        /// @brief  time the scan will be halfway through the rows of a transfer shaped like
+        ///         the last scheduled one, if that transfer is ready at `ready`
+        /// @note   for sampling animation time ahead (late latching); no statistics
+        uint64_t predict_scanout(uint64_t ready) const;
+        /// @brief same midpoint for the last scheduled transfer
+        uint64_t last_scanout() const { return last_scanout_; }
+
+        /// @brief feed the measured time of a completed transfer into the duration estimate
+        /// @param gap_cycles time the DMA sat idle (window commands, element switches)
+        void record_transfer(uint32_t pixels, uint8_t elements, uint32_t total_cycles, uint32_t gap_cycles);
+
+        const Stats& window() const { return window_; }
+        void reset_window();
+
+    private:
+        /// @brief where a transfer goes (see the class note)
+        struct Placement {
+            uint64_t start;     // time to start
+            uint64_t scanout;   // time the scan is halfway through the rows with the new content
+            uint64_t refresh;   // start of the refresh that start falls in
+            uint32_t period;
+            bool tear_risk;
+        };
+
+        void snapshot(uint64_t& te, uint32_t& index, uint32_t& period) const;
+        Placement place(uint64_t ready, uint16_t y0, uint16_t y1, uint32_t pixels, uint8_t elements) const;
+
+        static FramePacer* instances_[MAX_PACERS];
+        static uint16_t pins_[MAX_PACERS];
+        static uint8_t instance_count_;
+
+        const lcd::Panel& panel_;
+        volatile uint64_t te_cycles_;   // last edge, timebase::cycles()
+        volatile uint32_t te_index_;    // refresh number at te_cycles_
+        volatile uint32_t period_;      // cycles per refresh
+        volatile uint32_t edges_;
+        uint32_t seen_edges_;           // edges_ at the last take_refresh()
+        uint32_t quiet_refreshes_;      // refreshes taken without an edge, saturates at TE_TIMEOUT
+        uint32_t taken_index_;
+        uint32_t pixel_cost_q8_;        // cycles per pixel, 8 fractional bits
+        uint32_t element_cost_;         // cycles per element
+        uint16_t last_y0_;              // shape of the last scheduled transfer
+        uint16_t last_y1_;
+        uint32_t last_pixels_;
+        uint8_t last_elements_;
+        uint64_t last_scanout_;
+        Stats window_;
+};
@@ -0,0 +1,64 @@
+/// @file    image.hpp
+#pragma once
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief  losslessly compressed RGB565 image generated by tools/imgconv.py
+    /// @note   Q565 stream in raster order: index / diff / luma ops against the previous
+    ///         pixel and a 64 entry colour table, short and long runs, raw pixels.
+    ///         The format is documented in tools/imgconv.py.
+    struct Image {
+        uint16_t width;
+        uint16_t height;
+        const uint8_t* data;
+        uint32_t size;          // coded bytes
+        uint32_t checksum;      // FNV-1a over the decoded pixels (little endian)
+    };
+
+    /// @brief  streaming Q565 decoder
+    /// @note   decodes in raster order into any number of calls, so an image can be
+    ///         expanded into a framebuffer region in one go or band by band through a
+    ///         small buffer. The state (colour table, pending run) is ~140 bytes;
+    ///         runs are written with fastmem::fill16.
+    class ImageDecoder {
+        public:
+            explicit ImageDecoder(const Image& image);
+
+            /// @brief restart from the first pixel
+            void rewind();
+
+            /// @brief  decode the next count pixels into contiguous memory
+            /// @return pixels written, less than count at the end of the image or on error
+            uint32_t read(uint16_t* dst, uint32_t count);
+
+            /// @brief  decode the next rows into a strided surface (width pixels each)
+            /// @return rows written
+            uint16_t read_rows(uint16_t* dst, uint32_t stride, uint16_t rows);
+
+            /// @brief next row to be decoded
+            uint16_t row() const { return (uint16_t)(decoded_ / image_->width); }
+            bool done() const { return decoded_ == total_; }
+            /// @brief the stream ended early or overran the image
+            bool error() const { return error_; }
+
+        private:
+            const Image* image_;
+            const uint8_t* pos_;
+            const uint8_t* end_;
+            uint32_t total_;
+            uint32_t decoded_;
+            uint16_t prev_;
+            uint16_t run_;          // repeats of prev_ still to emit
+            bool error_;
+            uint16_t index_[64];
+    };
+
+    /// @brief  decode a whole image into a width x height region of a strided surface
+    /// @return false on a corrupt stream
+    bool decode_image(const Image& image, uint16_t* dst, uint32_t stride);
+
+    /// @brief FNV-1a of a width x height region, comparable with Image::checksum
+    uint32_t image_checksum(const uint16_t* pixels, uint16_t width, uint16_t height, uint32_t stride);
+
+} // namespace gfx
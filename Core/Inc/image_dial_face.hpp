@@ -0,0 +1,532 @@
+/// @file    image_dial_face.hpp
+/// @brief   240x280 RGB565 image (dial_face.png), Q565 coded
+/// @note    generated by tools/imgconv.py, do not edit: 8281 bytes coded (134400 bytes raw)
+#pragma once
+#include "image.hpp"
+
+namespace gfx::images {
+
+    inline constexpr uint8_t dial_face_q565[] = {
+        0xA3, 0x88, 0xFE, 0xFF, 0xE4, 0xC8, 0x7E, 0xA5, 0x98, 0xA5, 0x98, 0xA5, 0x97, 0xA4, 0x88, 0xA3,
+        0x98, 0xA4, 0x87, 0xA2, 0x98, 0xA3, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x7F, 0x6E, 0xC1, 0x01,
+        0x32, 0x2A, 0x16, 0x02, 0x26, 0x0F, 0x2E, 0x12, 0x9C, 0x88, 0x9B, 0x8A, 0x11, 0x21, 0x19, 0xE0,
+        0xAB, 0x6E, 0xA7, 0xA8, 0x2A, 0xA6, 0x98, 0x26, 0xA6, 0x97, 0x06, 0xDB, 0x1E, 0x26, 0x29, 0x2A,
+        0x25, 0x99, 0x79, 0x19, 0xE0, 0xA1, 0xA6, 0x87, 0xA9, 0xA7, 0xA9, 0xA7, 0x02, 0x06, 0xD1, 0x76,
+        0x66, 0x04, 0x06, 0xD1, 0x02, 0x36, 0x22, 0x0E, 0x19, 0xE0, 0x99, 0xA4, 0x87, 0x22, 0xAA, 0x97,
+        0xAA, 0xA6, 0x06, 0xC8, 0x66, 0x9B, 0x79, 0x9B, 0x89, 0x36, 0x9B, 0x8A, 0x2A, 0x9C, 0x79, 0x9D,
+        0x99, 0x41, 0x9D, 0x99, 0x46, 0x21, 0xA8, 0xA8, 0xFF, 0xB0, 0xDC, 0xC1, 0x37, 0x21, 0x32, 0x3D,
+        0x16, 0x2D, 0x06, 0x2A, 0x0D, 0x36, 0x1E, 0x0E, 0x01, 0x6E, 0xC8, 0x9C, 0x88, 0x02, 0x22, 0x95,
+        0x7A, 0x19, 0xE0, 0x92, 0x25, 0x12, 0xAB, 0xA7, 0x06, 0xC7, 0x99, 0x89, 0x99, 0x7A, 0x99, 0x89,
+        0x99, 0x8A, 0x9A, 0x79, 0x19, 0xC1, 0xAC, 0xA7, 0xA8, 0x97, 0x8F, 0x6A, 0x19, 0xC4, 0xB1, 0xD7,
+        0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x35, 0x1C, 0x10, 0x19, 0xC1, 0x09, 0x01, 0x3E, 0x02, 0xA7,
+        0xA7, 0xA7, 0x98, 0xC7, 0x98, 0x79, 0x12, 0x25, 0x19, 0xE0, 0x8C, 0x25, 0xAD, 0xA6, 0xAC, 0xA7,
+        0x06, 0xC5, 0x9D, 0x89, 0x0F, 0x3E, 0x01, 0x16, 0x19, 0xC6, 0xAF, 0xB7, 0xA7, 0x98, 0x90, 0x69,
+        0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x11, 0x30, 0x2C, 0x19, 0xC6, 0x16,
+        0x01, 0x3E, 0x0F, 0x2A, 0xA3, 0x98, 0xC5, 0x9A, 0x89, 0x1A, 0x25, 0x19, 0xE0, 0x86, 0xA4, 0x87,
+        0x3E, 0x02, 0x06, 0xC5, 0x95, 0x7A, 0x95, 0x8A, 0x16, 0x19, 0xC1, 0x0D, 0x30, 0x8C, 0x5A, 0x19,
+        0xC3, 0x35, 0x16, 0xAA, 0xA8, 0x30, 0x9D, 0x78, 0xC0, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x87, 0x6F,
+        0xA2, 0x87, 0xA3, 0xDA, 0xA3, 0xB9, 0xC1, 0x11, 0x1B, 0x0E, 0x02, 0x35, 0x21, 0x0A, 0xC0, 0x30,
+        0x00, 0x16, 0x9C, 0x89, 0x19, 0xC3, 0x2D, 0x30, 0x0D, 0x19, 0xC1, 0x16, 0x39, 0x1E, 0x06, 0xC5,
+        0x99, 0x89, 0x3E, 0x92, 0x6A, 0x19, 0xE0, 0x81, 0xAC, 0x96, 0xAE, 0xA6, 0xAD, 0xA7, 0xC4, 0x9D,
+        0x99, 0x36, 0x94, 0x7A, 0x95, 0x6A, 0x19, 0xC4, 0x2C, 0x30, 0x93, 0x79, 0x5A, 0xA5, 0x98, 0xA5,
+        0x98, 0xA5, 0x98, 0xA4, 0x98, 0x6E, 0xC0, 0x9C, 0x89, 0x30, 0x09, 0x2A, 0xC4, 0x11, 0xA3, 0xB9,
+        0xC1, 0x11, 0x2A, 0xC4, 0x09, 0x30, 0x09, 0x2A, 0xC0, 0x25, 0x9C, 0x78, 0x0A, 0x1A, 0x9B, 0x89,
+        0x2D, 0x30, 0x2C, 0x19, 0xC4, 0x1E, 0xAB, 0xB7, 0x36, 0xAC, 0xA7, 0x06, 0xC4, 0x93, 0x7A, 0x92,
+        0x6A, 0x19, 0xE0, 0x7C, 0x7E, 0x39, 0xB0, 0x96, 0xA6, 0x97, 0xC3, 0x51, 0x36, 0x01, 0x51, 0xA5,
+        0x99, 0x19, 0xC4, 0xA6, 0x87, 0xA7, 0xA8, 0xA8, 0x87, 0x30, 0xA3, 0x88, 0xA4, 0x87, 0xC3, 0x9D,
+        0x89, 0x9C, 0x88, 0x9D, 0x9A, 0x30, 0x9C, 0x78, 0x97, 0x79, 0x16, 0x52, 0x35, 0x55, 0x56, 0xB0,
+        0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x1E, 0x26, 0x35, 0x09, 0x16, 0x2A, 0x05, 0x30, 0x14, 0xA3, 0x87,
+        0x0E, 0xA3, 0x98, 0xC3, 0x9C, 0x89, 0x30, 0x45, 0x15, 0x99, 0x79, 0x19, 0xC4, 0x24, 0x2D, 0x01,
+        0x36, 0x32, 0xA2, 0x88, 0xC3, 0x9A, 0x79, 0x39, 0x21, 0x19, 0xE0, 0x77, 0xA4, 0x87, 0xB1, 0xB6,
+        0x32, 0x06, 0xC3, 0x95, 0x7A, 0x92, 0x7A, 0x19, 0xC1, 0xB0, 0xA6, 0x30, 0x91, 0x6A, 0x19, 0x3A,
+        0xA8, 0x97, 0x12, 0x1B, 0x2A, 0xC0, 0x51, 0x30, 0x6E, 0x41, 0x9A, 0x89, 0x9B, 0x89, 0x9B, 0x89,
+        0x9C, 0x78, 0x19, 0xC0, 0xA6, 0x97, 0x30, 0x31, 0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06,
+        0x19, 0xC4, 0x31, 0x30, 0x11, 0x19, 0xC0, 0x1E, 0x09, 0x39, 0x29, 0xA6, 0x87, 0x35, 0x30, 0x16,
+        0x2A, 0xC0, 0x1B, 0x12, 0x98, 0x79, 0x98, 0x79, 0x19, 0x1D, 0x30, 0x31, 0x19, 0xC1, 0xAE, 0xA6,
+        0xAE, 0x96, 0xAB, 0xA7, 0xC3, 0x32, 0x1A, 0x3A, 0x19, 0xE0, 0x73, 0xA5, 0x97, 0xB1, 0xB7, 0x06,
+        0xC3, 0x9D, 0x89, 0x1A, 0x91, 0x6B, 0x19, 0xC3, 0xA9, 0xA8, 0x30, 0x14, 0xA5, 0x87, 0xA5, 0x98,
+        0xC2, 0x3A, 0x99, 0x89, 0x9A, 0x79, 0x30, 0x55, 0x19, 0xC5, 0xA3, 0x98, 0x30, 0x05, 0x19, 0xC4,
+        0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x05, 0x30, 0x35, 0x19, 0xC5, 0x21, 0x30, 0x3E,
+        0x36, 0xA7, 0x98, 0x2A, 0xC2, 0x3A, 0x14, 0x30, 0x34, 0x19, 0xC3, 0x0E, 0x1A, 0xAF, 0xA7, 0xA3,
+        0x98, 0xC3, 0x29, 0x02, 0x19, 0xE0, 0x6F, 0xA4, 0x87, 0x29, 0x06, 0xC3, 0x98, 0x79, 0x22, 0x19,
+        0xC4, 0x09, 0xAA, 0x97, 0xA9, 0xA7, 0x30, 0xC0, 0xA7, 0x87, 0x16, 0x05, 0x39, 0x99, 0x79, 0x19,
+        0xC1, 0x0D, 0x30, 0x8E, 0x59, 0x19, 0xC5, 0x14, 0x2C, 0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1,
+        0x06, 0x19, 0xC4, 0x2C, 0x14, 0x19, 0xC5, 0xA4, 0x87, 0x30, 0x0D, 0x19, 0xC1, 0x32, 0x39, 0x05,
+        0x16, 0x2A, 0x30, 0xC0, 0x3D, 0x29, 0x09, 0x19, 0xC4, 0x22, 0xB0, 0xA6, 0xA8, 0x97, 0xC3, 0x8F,
+        0x7B, 0x8E, 0x5A, 0x19, 0xE0, 0x6B, 0x7E, 0xB3, 0xB6, 0x06, 0xC3, 0x96, 0x79, 0x8F, 0x6B, 0x09,
+        0x30, 0x01, 0x19, 0xC0, 0x21, 0x06, 0xAB, 0x97, 0x2A, 0xC1, 0x30, 0xC0, 0x01, 0x19, 0xC5, 0x1D,
+        0x30, 0x92, 0x69, 0x19, 0xCD, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xCD, 0x25, 0x30, 0x1D,
+        0x19, 0xC5, 0x01, 0x30, 0xC0, 0x2A, 0xC1, 0x2B, 0x95, 0x8A, 0x21, 0x19, 0xC0, 0x01, 0x30, 0x09,
+        0x06, 0x26, 0xAA, 0x97, 0xC3, 0x15, 0x21, 0x19, 0xE0, 0x68, 0x31, 0xB4, 0xA5, 0x06, 0xC2, 0x95,
+        0x8A, 0x3E, 0x19, 0xC0, 0x09, 0x30, 0x1C, 0x0E, 0xAC, 0x96, 0xAB, 0xA8, 0xC1, 0x16, 0x36, 0x96,
+        0x79, 0x39, 0x30, 0x97, 0x79, 0x19, 0xC5, 0xA4, 0x87, 0x01, 0x19, 0xCE, 0xB1, 0xD7, 0xB1, 0xD8,
+        0xC1, 0x06, 0x19, 0xCE, 0x01, 0x99, 0x79, 0x19, 0xC5, 0x15, 0x30, 0x39, 0x16, 0x36, 0xAA, 0x97,
+        0x2A, 0xC1, 0x3B, 0x0E, 0x1C, 0x30, 0x09, 0x19, 0xC0, 0x3E, 0x21, 0xAB, 0x97, 0xC2, 0x9D, 0x89,
+        0x31, 0x19, 0xE0, 0x65, 0xAA, 0x96, 0xB4, 0xB6, 0x06, 0xC2, 0x97, 0x79, 0x01, 0x19, 0xC3, 0xB2,
+        0xB6, 0x30, 0xA4, 0x87, 0xA3, 0x88, 0xC0, 0x12, 0x95, 0x7A, 0x19, 0xC1, 0xA3, 0x98, 0x30, 0x1C,
+        0x19, 0xD7, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xD7, 0x1C, 0x30, 0x35, 0x19, 0xC1, 0x2A,
+        0x12, 0xA9, 0x98, 0xC0, 0x11, 0x30, 0x08, 0x19, 0xC3, 0x01, 0x2B, 0xA9, 0xA8, 0xC2, 0x97, 0x8A,
+        0x32, 0x19, 0xE0, 0x61, 0xA2, 0x88, 0x2E, 0x06, 0xC1, 0x04, 0x9B, 0x8A, 0x36, 0x19, 0xC3, 0x3E,
+        0xAD, 0xA7, 0x16, 0x30, 0x6E, 0x98, 0x79, 0x95, 0x79, 0x19, 0xC4, 0x31, 0x08, 0x19, 0xD7, 0xB1,
+        0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xD7, 0x08, 0x31, 0x19, 0xC4, 0xA4, 0x87, 0x29, 0x35, 0x30,
+        0x16, 0x9D, 0x89, 0x3E, 0x19, 0xC3, 0x36, 0x1B, 0x04, 0x5E, 0xC1, 0x2E, 0x2D, 0x19, 0xE0, 0x5E,
+        0x1D, 0xB6, 0xA5, 0x06, 0xC1, 0x3F, 0x9D, 0xBB, 0xC1, 0xFF, 0x24, 0x31, 0x19, 0xC0, 0x3E, 0xAD,
+        0xA7, 0xA5, 0x98, 0xC0, 0x3A, 0x1C, 0x30, 0x91, 0x69, 0x19, 0xE0, 0x00, 0xB1, 0xD7, 0xB1, 0xD8,
+        0xC1, 0x06, 0x19, 0xE0, 0x00, 0x16, 0x30, 0x1C, 0xA4, 0x77, 0x2A, 0xC0, 0x3A, 0x3E, 0x19, 0xC0,
+        0x1B, 0xFF, 0xB0, 0xDC, 0xC1, 0x3F, 0xA2, 0x67, 0xC1, 0x9D, 0x89, 0x1D, 0x19, 0xE0, 0x5B, 0xA3,
+        0x98, 0xB6, 0xB5, 0x06, 0xC2, 0x92, 0x6A, 0x9A, 0xAA, 0x3A, 0xC1, 0x96, 0x58, 0x32, 0xAE, 0x97,
+        0xA5, 0x98, 0xC0, 0x9A, 0x89, 0x39, 0x19, 0x34, 0x30, 0x31, 0x19, 0xE0, 0x00, 0xB1, 0xD7, 0xB1,
+        0xD8, 0xC1, 0x06, 0x19, 0xE0, 0x00, 0x31, 0x30, 0x34, 0x19, 0x39, 0x35, 0x2A, 0xC0, 0x9B, 0x89,
+        0x32, 0x0D, 0xAA, 0xB8, 0xC1, 0x1A, 0x02, 0xAE, 0xA6, 0xC2, 0x05, 0x8A, 0x5B, 0x19, 0xE0, 0x58,
+        0x15, 0xB7, 0xB5, 0x06, 0xC1, 0x9A, 0x89, 0x8B, 0x5B, 0x19, 0xAA, 0xB7, 0x3A, 0xC2, 0x9D, 0x47,
+        0x9E, 0x68, 0x9B, 0x89, 0x39, 0x19, 0xC2, 0xB5, 0xB6, 0x30, 0x8B, 0x6A, 0x19, 0xDF, 0x37, 0xFF,
+        0xB0, 0xDC, 0xC1, 0x37, 0x19, 0xDF, 0x21, 0x30, 0x55, 0x19, 0xC2, 0x39, 0xAE, 0x96, 0x2A, 0x04,
+        0xA3, 0xDA, 0xC2, 0x3F, 0x19, 0x06, 0x11, 0xA6, 0x87, 0xC1, 0x9D, 0x89, 0x15, 0x19, 0xE0, 0x56,
+        0xB6, 0xB5, 0x06, 0xC2, 0x29, 0x19, 0xC2, 0xFF, 0x6C, 0x9B, 0x3A, 0xC1, 0x45, 0xFF, 0xE5, 0x41,
+        0x19, 0xC4, 0xA6, 0x97, 0x25, 0x19, 0xE0, 0x01, 0x37, 0xA8, 0xA7, 0x37, 0x19, 0xE0, 0x01, 0x25,
+        0x11, 0x19, 0xC4, 0xAC, 0x96, 0x28, 0x3A, 0xC1, 0x14, 0x19, 0xC2, 0x29, 0xB1, 0xA6, 0xC2, 0x29,
+        0x19, 0xE0, 0x53, 0x16, 0xB8, 0xB5, 0x06, 0xC1, 0x9B, 0x89, 0x01, 0x19, 0xC2, 0xAC, 0x96, 0xB1,
+        0xB7, 0xA5, 0xEA, 0xC2, 0x8E, 0x39, 0x19, 0xE0, 0x37, 0x3E, 0x3A, 0xC2, 0x2D, 0x06, 0x19, 0xC2,
+        0x01, 0x16, 0xA5, 0x98, 0xC1, 0x98, 0x79, 0x88, 0x5B, 0x19, 0xE0, 0x50, 0x22, 0x06, 0xC2, 0x91,
+        0x7A, 0x89, 0x6C, 0x19, 0xC1, 0x09, 0xB0, 0xA6, 0xA8, 0x87, 0xC0, 0x9E, 0xC9, 0xA7, 0xB9, 0xC1,
+        0x56, 0x35, 0x19, 0xE0, 0x35, 0x35, 0x32, 0x3A, 0xC1, 0x29, 0x2A, 0xC0, 0x21, 0x09, 0x19, 0xC1,
+        0x7E, 0x36, 0x06, 0xC2, 0x22, 0x19, 0xE0, 0x4E, 0xB5, 0xB5, 0x06, 0xC2, 0x22, 0x6B, 0x10, 0x19,
+        0xC0, 0xAE, 0x96, 0x2A, 0xC0, 0x02, 0x90, 0x6A, 0x99, 0x89, 0xFF, 0x6F, 0xCC, 0x3A, 0xC1, 0x92,
+        0x59, 0x19, 0xE0, 0x35, 0x2C, 0x3A, 0xC1, 0x23, 0x26, 0x2A, 0x02, 0xA4, 0x88, 0xC0, 0x1A, 0x19,
+        0xC0, 0x10, 0x29, 0x22, 0x06, 0xC2, 0x8E, 0x6A, 0x19, 0xE0, 0x4B, 0x26, 0xFF, 0xCA, 0x93, 0x06,
+        0xC1, 0x98, 0x79, 0x16, 0x21, 0x30, 0xC0, 0x39, 0xAB, 0x97, 0x2A, 0xC0, 0x94, 0x79, 0x19, 0xC1,
+        0xAE, 0xC7, 0xB4, 0xD7, 0xC2, 0xFF, 0x64, 0x39, 0x19, 0xE0, 0x33, 0x28, 0x3A, 0xC2, 0x2A, 0x19,
+        0xC1, 0x36, 0xAC, 0x97, 0xC0, 0x1E, 0x39, 0x30, 0xC0, 0x21, 0x16, 0xB8, 0xB5, 0x06, 0xC1, 0x12,
+        0x26, 0x19, 0xE0, 0x48, 0x11, 0xFF, 0x6C, 0xAC, 0x06, 0xC1, 0x92, 0x6A, 0x19, 0xC1, 0xA9, 0xA7,
+        0x30, 0xC0, 0xA6, 0x87, 0x02, 0x8F, 0x7B, 0x19, 0xC3, 0xFF, 0xCD, 0xB3, 0xA7, 0xA8, 0xC1, 0x97,
+        0x69, 0x19, 0xE0, 0x33, 0x1C, 0x3A, 0xC1, 0x33, 0x19, 0xC3, 0x25, 0x02, 0xA3, 0x99, 0x30, 0xC0,
+        0x2D, 0x19, 0xC1, 0x02, 0x06, 0xC1, 0x99, 0x89, 0x11, 0x19, 0xE0, 0x46, 0xAA, 0x96, 0xFF, 0xEE,
+        0xC4, 0x06, 0xC1, 0x8C, 0x6A, 0x19, 0xC2, 0x36, 0xA7, 0xA9, 0x30, 0x55, 0x8C, 0x5A, 0x19, 0xC4,
+        0xAA, 0xA7, 0x3A, 0xC2, 0xFF, 0xE6, 0x51, 0x19, 0xE0, 0x31, 0x13, 0x3A, 0xC2, 0x3C, 0x19, 0xC4,
+        0x1E, 0x21, 0x30, 0x04, 0x36, 0x19, 0xC2, 0x06, 0xB4, 0xA6, 0xC1, 0x2D, 0x32, 0x19, 0xE0, 0x44,
+        0x15, 0x06, 0xC2, 0x87, 0x5C, 0x19, 0xC1, 0xA4, 0x87, 0xB3, 0xA6, 0x2A, 0xC0, 0x97, 0x9A, 0x30,
+        0x01, 0x19, 0xC5, 0xFF, 0x2B, 0x93, 0xAC, 0xB7, 0xC1, 0x9C, 0x78, 0x19, 0xE0, 0x31, 0x0F, 0x3A,
+        0xC1, 0x00, 0x19, 0xC5, 0x01, 0x30, 0x1C, 0x2A, 0xC0, 0x2B, 0x8D, 0x7B, 0x19, 0xC1, 0x1A, 0x06,
+        0xC2, 0x15, 0x19, 0xE0, 0x42, 0xB0, 0xA5, 0x06, 0xC1, 0x9C, 0x88, 0x86, 0x5C, 0x19, 0xC1, 0xA9,
+        0x97, 0xB3, 0xA6, 0x7F, 0x9A, 0x89, 0x09, 0x11, 0x30, 0xC0, 0x11, 0x19, 0xC4, 0xA5, 0xA8, 0xFF,
+        0xB0, 0xDC, 0xC2, 0x8F, 0x49, 0x19, 0xE0, 0x2F, 0x06, 0x3A, 0xC2, 0x0C, 0x19, 0xC4, 0x11, 0x30,
+        0xC0, 0x11, 0x09, 0x35, 0x2A, 0x1B, 0x8D, 0x7B, 0x19, 0xC1, 0x2D, 0x1E, 0xA4, 0x88, 0xC1, 0x89,
+        0x6B, 0x19, 0xE0, 0x40, 0xB1, 0xB6, 0x06, 0xC1, 0x02, 0x8A, 0x4B, 0x9A, 0x89, 0x19, 0xC0, 0x15,
+        0xB0, 0x96, 0xC0, 0x95, 0x8A, 0x19, 0xC1, 0x01, 0x30, 0x91, 0x6A, 0x19, 0xC5, 0xB2, 0xD7, 0xB0,
+        0xC7, 0xC1, 0x51, 0x19, 0xE0, 0x2F, 0x26, 0x3A, 0xC1, 0x15, 0x19, 0xC5, 0x1D, 0x30, 0x01, 0x19,
+        0xC1, 0x05, 0x2A, 0xC0, 0x90, 0x7A, 0x19, 0xC0, 0xA4, 0x87, 0x2F, 0x02, 0x06, 0xC1, 0x39, 0x19,
+        0xE0, 0x3E, 0xB2, 0xA5, 0x06, 0xC1, 0x97, 0x79, 0x3A, 0x30, 0x21, 0x8F, 0x7A, 0x31, 0x2A, 0xC0,
+        0x1A, 0x19, 0xC3, 0x6E, 0x19, 0xC7, 0x0F, 0xA4, 0x98, 0xC0, 0x0F, 0x19, 0xE0, 0x2F, 0x0F, 0x3A,
+        0xC0, 0x0F, 0x19, 0xC7, 0x1E, 0x19, 0xC3, 0x1A, 0x2A, 0xC0, 0x31, 0x3D, 0x21, 0x30, 0x8E, 0x59,
+        0x2B, 0x06, 0xC1, 0x3E, 0x19, 0xE0, 0x3C, 0x3E, 0x06, 0xC1, 0x95, 0x7A, 0xFF, 0x81, 0x08, 0x19,
+        0xAD, 0xB7, 0x30, 0x66, 0x25, 0x2A, 0x8D, 0x7B, 0x19, 0xCE, 0x3C, 0xB2, 0xD7, 0xC0, 0x3C, 0x19,
+        0xE0, 0x2F, 0x3C, 0x38, 0xC0, 0x3C, 0x19, 0xCE, 0x39, 0x2A, 0x25, 0x2B, 0x30, 0x18, 0x19, 0x1E,
+        0xFF, 0xEB, 0x93, 0x06, 0xC1, 0x3E, 0x19, 0xE0, 0x3A, 0xB1, 0xB6, 0x06, 0xC1, 0x94, 0x7A, 0xFF,
+        0x61, 0x08, 0xC1, 0x7E, 0xB4, 0xA6, 0x30, 0x35, 0x91, 0x69, 0x19, 0xE0, 0x59, 0x1B, 0x35, 0x30,
+        0x21, 0x8C, 0x6A, 0x19, 0xC1, 0xFF, 0xCB, 0x93, 0x06, 0xC1, 0x39, 0x8F, 0x6B, 0xE0, 0x38, 0xB0,
+        0xA5, 0x06, 0xC1, 0x94, 0x7A, 0xFF, 0x61, 0x08, 0xC1, 0xA3, 0x88, 0xB4, 0xA5, 0xA6, 0x98, 0x30,
+        0xC0, 0x31, 0x19, 0xE0, 0x59, 0x31, 0x30, 0xC0, 0x2A, 0x2B, 0x32, 0x19, 0xC1, 0xFF, 0xCB, 0x93,
+        0x06, 0xC1, 0x89, 0x6B, 0x90, 0x6B, 0xE0, 0x36, 0x15, 0x06, 0xC1, 0x1E, 0x19, 0xC1, 0xA3, 0x98,
+        0xB5, 0xA6, 0xA5, 0x98, 0x9A, 0x79, 0x8E, 0x69, 0x08, 0x30, 0x24, 0x19, 0xE0, 0x57, 0x24, 0x30,
+        0x08, 0x3F, 0x32, 0x2A, 0x3A, 0x35, 0x19, 0xC1, 0x1E, 0x06, 0xC1, 0x15, 0x19, 0xE0, 0x34, 0xAA,
+        0x96, 0x06, 0xC1, 0x97, 0x79, 0xFF, 0x81, 0x08, 0x19, 0xC0, 0x35, 0x3A, 0x2A, 0x99, 0x89, 0x21,
+        0x19, 0xA4, 0x87, 0x1C, 0x05, 0x19, 0xE0, 0x57, 0x05, 0x1C, 0x3A, 0x19, 0x21, 0x26, 0x2A, 0x9B,
+        0x89, 0x35, 0x19, 0xC0, 0x1E, 0x2B, 0x06, 0xC1, 0x32, 0x19, 0xE0, 0x32, 0x11, 0xFF, 0xEE, 0xC4,
+        0x06, 0xC0, 0x02, 0xFF, 0xE2, 0x18, 0x19, 0xC0, 0xA3, 0x88, 0xB5, 0xB6, 0x2A, 0x26, 0x1E, 0x19,
+        0xC1, 0x1E, 0x19, 0xE0, 0x59, 0x1E, 0x19, 0xC1, 0x1E, 0x26, 0x2A, 0x3A, 0x32, 0x19, 0xC0, 0xA4,
+        0x87, 0x02, 0x06, 0xC0, 0x2D, 0x11, 0x19, 0xE0, 0x30, 0xA2, 0x87, 0x02, 0x06, 0xC0, 0x9C, 0x88,
+        0x2F, 0x30, 0x18, 0x21, 0xB6, 0x95, 0x2A, 0x99, 0x89, 0x8B, 0x6B, 0x19, 0xE0, 0x63, 0x1E, 0x26,
+        0x2A, 0x2B, 0x21, 0x18, 0x30, 0x2F, 0xFF, 0xCD, 0xBC, 0x06, 0xC0, 0x02, 0xFF, 0xA1, 0x10, 0x19,
+        0xE0, 0x2F, 0x12, 0x06, 0xC1, 0xFF, 0x84, 0x39, 0x3A, 0xB1, 0xB7, 0x30, 0x21, 0x2A, 0x9A, 0x79,
+        0x8A, 0x7A, 0x19, 0xE0, 0x65, 0x21, 0x32, 0x2A, 0x98, 0x89, 0x30, 0x21, 0x3A, 0x2D, 0x06, 0xC1,
+        0x12, 0x19, 0xE0, 0x2E, 0xB5, 0xB5, 0x06, 0xC1, 0x87, 0x5C, 0x19, 0xC0, 0x3D, 0xB1, 0xB8, 0x30,
+        0xC0, 0x3F, 0x19, 0xE0, 0x67, 0x3F, 0x30, 0xC0, 0x2B, 0x3D, 0x19, 0xC0, 0x1A, 0x06, 0xC1, 0x8E,
+        0x6A, 0x19, 0xE0, 0x2C, 0x22, 0x06, 0xC1, 0x8C, 0x6A, 0x19, 0xC1, 0x31, 0x25, 0x9B, 0x89, 0x30,
+        0x08, 0x3A, 0x19, 0xE0, 0x65, 0x3A, 0x08, 0x30, 0x35, 0x25, 0x31, 0x19, 0xC1, 0x06, 0xB4, 0xA6,
+        0xC1, 0x22, 0x19, 0xE0, 0x2A, 0x16, 0x06, 0xC1, 0x92, 0x6A, 0x19, 0xC1, 0x15, 0x2A, 0xC0, 0x1B,
+        0x31, 0x30, 0x1C, 0x8D, 0x5A, 0x19, 0xE0, 0x63, 0x1E, 0x1C, 0x30, 0x31, 0x1B, 0x2A, 0xC0, 0x15,
+        0x19, 0xC1, 0x02, 0x06, 0xC1, 0x16, 0x19, 0xE0, 0x29, 0xFF, 0x4C, 0xA4, 0x06, 0xC0, 0x3A, 0x19,
+        0xC1, 0xA9, 0x97, 0xB4, 0xA6, 0xC0, 0x8D, 0x7B, 0x19, 0xC0, 0x24, 0x05, 0x19, 0xE0, 0x65, 0x05,
+        0x24, 0x19, 0xC0, 0x39, 0x2A, 0xC0, 0x8C, 0x6A, 0x19, 0xC1, 0x3A, 0x06, 0xC0, 0x3A, 0x19, 0xE0,
+        0x28, 0xB6, 0xB5, 0x06, 0xC1, 0x16, 0x19, 0xC0, 0xA4, 0x87, 0xB8, 0xA5, 0x7F, 0x91, 0x7A, 0x19,
+        0xE0, 0x6F, 0x1A, 0x2A, 0x1B, 0x3A, 0x19, 0xC0, 0x16, 0x06, 0xC1, 0x29, 0x19, 0xE0, 0x26, 0x15,
+        0x06, 0xC1, 0x22, 0x92, 0x7A, 0x19, 0xC0, 0xB7, 0xA5, 0x2A, 0x05, 0x19, 0xE0, 0x71, 0x05, 0x2A,
+        0x2B, 0x19, 0xC0, 0x21, 0x22, 0x06, 0xC1, 0x15, 0x19, 0xE0, 0x24, 0xA3, 0x98, 0xFF, 0xEE, 0xBC,
+        0x06, 0xC0, 0x91, 0x7A, 0x97, 0x7B, 0x30, 0x2D, 0xA8, 0x87, 0xAC, 0x97, 0x9A, 0x89, 0x19, 0xE0,
+        0x73, 0x35, 0x2A, 0x36, 0x2D, 0x30, 0x29, 0xA9, 0xA6, 0x06, 0xC0, 0x9D, 0x89, 0xFF, 0xC2, 0x18,
+        0x19, 0xE0, 0x23, 0xFF, 0x8A, 0x8B, 0x06, 0xC0, 0x9B, 0x89, 0x21, 0x10, 0x30, 0xC0, 0x04, 0xA5,
+        0x87, 0x09, 0x19, 0xE0, 0x73, 0x09, 0x2A, 0x04, 0x30, 0xC0, 0x10, 0x21, 0x16, 0x06, 0xC0, 0x05,
+        0x19, 0xE0, 0x22, 0xAE, 0xA6, 0x06, 0xC1, 0x01, 0x19, 0xC0, 0x39, 0x30, 0xC0, 0x1C, 0x11, 0x19,
+        0xE0, 0x73, 0x11, 0x1C, 0x30, 0xC0, 0x39, 0x19, 0xC0, 0x01, 0x06, 0xC1, 0x1D, 0x19, 0xE0, 0x20,
+        0xA2, 0x88, 0xFF, 0xEE, 0xBC, 0x06, 0xC0, 0x8F, 0x7B, 0x19, 0xC1, 0xB5, 0xA6, 0x25, 0x99, 0x89,
+        0x30, 0xC0, 0x01, 0x19, 0xE0, 0x71, 0x01, 0x30, 0xC0, 0x21, 0x25, 0x1E, 0x19, 0xC1, 0x29, 0x06,
+        0xC0, 0x2A, 0x2D, 0x19, 0xE0, 0x1F, 0x2E, 0x06, 0xC0, 0x9A, 0x89, 0x19, 0xC1, 0x1A, 0xAF, 0xA7,
+        0x02, 0x88, 0x5B, 0x01, 0x30, 0xC0, 0x1E, 0x19, 0xE0, 0x6F, 0x1E, 0x30, 0xC0, 0x01, 0x1E, 0x02,
+        0x2A, 0x1A, 0x19, 0xC1, 0x11, 0x06, 0xC0, 0x2E, 0x19, 0xE0, 0x1E, 0xAA, 0x96, 0x06, 0xC1, 0xFF,
+        0xE5, 0x41, 0x19, 0xC0, 0x09, 0x2A, 0xC0, 0x8B, 0x7B, 0x19, 0xC0, 0xA6, 0x97, 0x6F, 0x19, 0xE0,
+        0x71, 0x1D, 0x11, 0x19, 0xC0, 0x25, 0x2A, 0xC0, 0x09, 0x19, 0xC0, 0x06, 0xFF, 0x4F, 0xCD, 0xC1,
+        0x32, 0x19, 0xE0, 0x1D, 0xFF, 0x2C, 0xA4, 0x06, 0xC0, 0x02, 0x19, 0xC1, 0x21, 0x2A, 0x94, 0x79,
+        0x19, 0xE0, 0x7B, 0x36, 0x2A, 0x21, 0x19, 0xC1, 0x02, 0x06, 0xC0, 0x35, 0x19, 0xE0, 0x1C, 0x31,
+        0x06, 0xC0, 0x72, 0x8E, 0x6B, 0x97, 0x79, 0x19, 0xAC, 0x96, 0x2A, 0x02, 0x19, 0xE0, 0x7D, 0x02,
+        0x2A, 0x06, 0x19, 0x3F, 0x1A, 0xB2, 0xA5, 0xA2, 0x67, 0xC0, 0x31, 0x19, 0xE0, 0x1A, 0x7E, 0xFF,
+        0xEE, 0xBC, 0x06, 0x76, 0x9C, 0xBB, 0xC1, 0x14, 0xA5, 0x66, 0x5A, 0x8C, 0x6A, 0x19, 0xE0, 0x7D,
+        0x2A, 0xB4, 0xA6, 0x2D, 0x14, 0x3A, 0xC1, 0x04, 0x06, 0x9D, 0x89, 0x21, 0x19, 0xE0, 0x19, 0xB4,
+        0xB5, 0x06, 0xC0, 0x9A, 0x9A, 0x3A, 0xC3, 0x99, 0x68, 0x26, 0x19, 0xE0, 0x7D, 0x26, 0x29, 0x3A,
+        0xC3, 0x1B, 0x06, 0xC0, 0x15, 0x19, 0xE0, 0x18, 0xA4, 0x87, 0x06, 0xC1, 0x36, 0xFF, 0xB0, 0xDC,
+        0xC4, 0x23, 0x8E, 0x49, 0x19, 0xE0, 0x7B, 0x2A, 0x23, 0x3A, 0xC4, 0x36, 0x06, 0xC1, 0xFF, 0xE2,
+        0x18, 0x19, 0xE0, 0x17, 0xB6, 0xB5, 0x06, 0xC0, 0x97, 0x79, 0x19, 0xA6, 0xA8, 0x0D, 0xAA, 0xB8,
+        0xC4, 0x33, 0x3C, 0x19, 0xE0, 0x77, 0x3C, 0x33, 0x3A, 0xC4, 0x0D, 0x1B, 0x19, 0x2B, 0x06, 0xC0,
+        0x29, 0x19, 0xE0, 0x16, 0xA5, 0x97, 0x06, 0xC1, 0x01, 0x19, 0xC0, 0x32, 0xB5, 0xC7, 0xA2, 0xB9,
+        0x3A, 0xC4, 0x00, 0x0C, 0x19, 0xE0, 0x73, 0x0C, 0x00, 0x3A, 0xC4, 0x28, 0x04, 0x32, 0x19, 0xC0,
+        0x01, 0x06, 0xC1, 0x02, 0x19, 0xE0, 0x15, 0x29, 0x06, 0xC0, 0x95, 0x8A, 0x19, 0xC1, 0xB8, 0xA5,
+        0xA5, 0x98, 0x8F, 0x7A, 0xA4, 0xB9, 0xB1, 0xD8, 0x7E, 0xC4, 0x90, 0x49, 0x19, 0xE0, 0x71, 0x15,
+        0x3A, 0xC4, 0x32, 0x3E, 0x06, 0x2A, 0x9B, 0x89, 0x19, 0xC1, 0x21, 0xAB, 0x97, 0xC0, 0x29, 0x19,
+        0xE0, 0x14, 0xA4, 0x87, 0x06, 0xC1, 0xFF, 0xC5, 0x39, 0x19, 0xC0, 0x3E, 0x2A, 0x9B, 0x89, 0x19,
+        0xC0, 0xA3, 0x98, 0x2C, 0xAE, 0xB7, 0xC4, 0x0F, 0x3C, 0x19, 0xE0, 0x6D, 0x3C, 0x0F, 0x3A, 0xC4,
+        0x2C, 0x35, 0x19, 0xC0, 0xB8, 0xA5, 0x2A, 0x3E, 0x19, 0xC0, 0x3E, 0x06, 0xC1, 0xFF, 0xE2, 0x18,
+        0x19, 0xE0, 0x13, 0xB5, 0xB5, 0x06, 0xC0, 0x96, 0x79, 0x19, 0xC1, 0xB8, 0xA5, 0x2A, 0x39, 0x19,
+        0xC2, 0xA8, 0xA7, 0xB1, 0xD8, 0xA9, 0xB8, 0xC3, 0x38, 0x19, 0xE0, 0x6D, 0x38, 0x3A, 0xC3, 0x1C,
+        0x28, 0x19, 0xC2, 0x39, 0x2A, 0x9B, 0x89, 0x19, 0xC1, 0x26, 0x06, 0xC0, 0x1A, 0x19, 0xE0, 0x12,
+        0x7E, 0xFF, 0x0E, 0xC5, 0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xC0, 0x3E, 0x2A, 0x9A, 0x89, 0x19,
+        0xC5, 0x13, 0x0F, 0xA4, 0x98, 0xC1, 0x38, 0x19, 0xE0, 0x6D, 0x38, 0x3A, 0xC1, 0x0F, 0x13, 0x19,
+        0xC5, 0x35, 0x2A, 0x3E, 0x19, 0xC0, 0x06, 0xFF, 0x4F, 0xCD, 0xC0, 0x32, 0x21, 0x19, 0xE0, 0x11,
+        0xB1, 0xB6, 0x06, 0xC0, 0x98, 0x79, 0x09, 0xC0, 0x19, 0xB8, 0xA5, 0x2A, 0x8D, 0x7B, 0x19, 0xC7,
+        0xB1, 0xD7, 0xAF, 0xD8, 0x0F, 0x3C, 0x19, 0xE0, 0x6D, 0x3C, 0x0F, 0x26, 0x06, 0x19, 0xC7, 0x39,
+        0x2A, 0x3A, 0x19, 0x09, 0xC0, 0xFF, 0x4C, 0xA4, 0xA8, 0x97, 0xC0, 0x8A, 0x6B, 0x19, 0xE0, 0x11,
+        0xFF, 0x8D, 0xAC, 0x06, 0xC0, 0x22, 0x30, 0xC0, 0x08, 0xA9, 0x87, 0x9D, 0x89, 0x19, 0xE0, 0x89,
+        0x3A, 0x16, 0x08, 0x30, 0xC0, 0x22, 0x06, 0xC0, 0x0E, 0x19, 0xE0, 0x10, 0xAC, 0x96, 0xFF, 0x4F,
+        0xCD, 0xC0, 0x9D, 0x89, 0x19, 0x01, 0xA9, 0xA8, 0x30, 0xC0, 0x1C, 0x34, 0x19, 0xE0, 0x87, 0x34,
+        0x1C, 0x30, 0xC0, 0x1C, 0x01, 0x19, 0x2A, 0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xE0, 0x0F, 0x0A,
+        0xAD, 0xA7, 0xC0, 0x1A, 0x19, 0xC0, 0xA6, 0x87, 0xB4, 0xB6, 0x35, 0x30, 0xC0, 0x55, 0x91, 0x7A,
+        0x19, 0xE0, 0x83, 0x11, 0x21, 0x30, 0xC0, 0x35, 0xA3, 0x98, 0x0E, 0x19, 0xC0, 0x1A, 0x06, 0xC0,
+        0x0A, 0x19, 0xE0, 0x0E, 0xA4, 0x87, 0x06, 0xC1, 0x0E, 0x19, 0xC0, 0x3B, 0xAB, 0xA8, 0x92, 0x7A,
+        0x98, 0x78, 0x31, 0x30, 0x25, 0x19, 0xE0, 0x83, 0x25, 0x30, 0x31, 0x16, 0x29, 0x2A, 0x3B, 0x19,
+        0xC0, 0x0E, 0x06, 0xC1, 0x3A, 0x19, 0xE0, 0x0D, 0xB2, 0xA5, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0,
+        0x7E, 0x2A, 0xC0, 0x3A, 0x19, 0xC0, 0x21, 0x19, 0xE0, 0x85, 0x21, 0x19, 0xC0, 0x3A, 0x2A, 0xC0,
+        0x21, 0x19, 0xC0, 0x1E, 0x06, 0xC0, 0x3E, 0x19, 0xE0, 0x0D, 0xFF, 0x6C, 0xAC, 0x06, 0xC0, 0x87,
+        0x6C, 0x19, 0xC0, 0xAC, 0x96, 0x2A, 0x97, 0x89, 0x19, 0xE0, 0x8D, 0x12, 0x2A, 0x06, 0x19, 0xC0,
+        0x1D, 0xB9, 0xB5, 0xC0, 0x02, 0x19, 0xE0, 0x0C, 0x25, 0x06, 0xC0, 0x32, 0x19, 0xC1, 0xB7, 0xA5,
+        0x2A, 0x8C, 0x6A, 0x19, 0xE0, 0x8D, 0x2A, 0xB4, 0xA6, 0x2B, 0x19, 0xC1, 0x32, 0x06, 0xC0, 0x25,
+        0x19, 0xE0, 0x0B, 0x1A, 0x06, 0xC0, 0x91, 0x7A, 0x19, 0xC0, 0x09, 0x2A, 0x51, 0x19, 0xE0, 0x8F,
+        0x16, 0x2A, 0x09, 0x19, 0xC0, 0x36, 0x06, 0xC0, 0x1A, 0x19, 0xE0, 0x0B, 0xFF, 0x8D, 0xB4, 0x06,
+        0xC0, 0x01, 0x19, 0xC0, 0x29, 0x2A, 0x94, 0x79, 0x19, 0xE0, 0x8F, 0x36, 0x2A, 0x29, 0x19, 0xC0,
+        0x01, 0x06, 0xC0, 0x11, 0x19, 0xE0, 0x0A, 0x25, 0x06, 0xC0, 0x9D, 0x99, 0xFF, 0x84, 0x39, 0x31,
+        0x34, 0xAF, 0xA6, 0x2A, 0x8A, 0x6A, 0x19, 0xE0, 0x8F, 0x16, 0x2A, 0x3D, 0x34, 0x31, 0x2D, 0xFF,
+        0xEE, 0xC4, 0x06, 0xC0, 0x25, 0x19, 0xE0, 0x09, 0x12, 0x06, 0xC0, 0x91, 0x7A, 0x24, 0x30, 0xC2,
+        0x94, 0x69, 0x99, 0x89, 0x19, 0xE0, 0x8D, 0x35, 0x39, 0x30, 0xC2, 0x24, 0x36, 0x06, 0xC0, 0x12,
+        0x19, 0xE0, 0x09, 0xFF, 0x4C, 0xA4, 0x06, 0xC0, 0x85, 0x6C, 0x19, 0xA7, 0x98, 0xAC, 0xA7, 0x30,
+        0xC2, 0x31, 0x19, 0xE0, 0x8B, 0x31, 0x30, 0xC2, 0x14, 0x1D, 0x19, 0x09, 0x06, 0xC0, 0x3A, 0x19,
+        0xE0, 0x08, 0xA4, 0x87, 0x06, 0xC1, 0xFF, 0x81, 0x08, 0x19, 0xC0, 0xB8, 0xA5, 0x2A, 0x01, 0xA2,
+        0x88, 0x1C, 0x08, 0x19, 0xE0, 0x8B, 0x08, 0x1C, 0x15, 0x01, 0x2A, 0x3A, 0x19, 0xC0, 0x1E, 0x06,
+        0xC1, 0xFF, 0xE2, 0x18, 0x19, 0xE0, 0x07, 0x22, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0, 0x3A, 0x2A,
+        0x51, 0x19, 0xE0, 0x93, 0x16, 0x2A, 0x3A, 0x19, 0xC0, 0x1E, 0x06, 0xC0, 0x22, 0x19, 0xE0, 0x07,
+        0xB9, 0xB5, 0x06, 0xC0, 0x8A, 0x6B, 0x19, 0xC0, 0xAC, 0x96, 0x2A, 0x95, 0x8A, 0x19, 0xE0, 0x93,
+        0x05, 0x2A, 0x06, 0x19, 0xC0, 0x39, 0xB6, 0xA5, 0xC0, 0x02, 0x19, 0xE0, 0x07, 0xFF, 0xCD, 0xBC,
+        0x06, 0xC0, 0xFF, 0x43, 0x29, 0x19, 0xC0, 0x12, 0x2A, 0x8D, 0x7B, 0x19, 0xE0, 0x93, 0x39, 0x2A,
+        0x12, 0x19, 0xC0, 0x16, 0x06, 0xC0, 0x1E, 0x19, 0xE0, 0x06, 0x0E, 0x06, 0xC0, 0x9D, 0x89, 0x19,
+        0xC1, 0xFF, 0xEB, 0x8B, 0x7F, 0x86, 0x5B, 0x19, 0xE0, 0x93, 0x32, 0x2A, 0x1B, 0x19, 0xC1, 0xFF,
+        0xEE, 0xBC, 0x06, 0xC0, 0x0E, 0x19, 0xE0, 0x05, 0x22, 0x06, 0xC0, 0x94, 0x69, 0x19, 0xC0, 0x0E,
+        0xB7, 0xB6, 0x9B, 0x89, 0x19, 0xE0, 0x95, 0x3A, 0x2A, 0x0E, 0x19, 0xC0, 0x0F, 0x06, 0xC0, 0x22,
+        0x19, 0xE0, 0x05, 0x36, 0x06, 0xC0, 0x3E, 0x19, 0xC0, 0x15, 0x2A, 0x94, 0x79, 0x19, 0xE0, 0x95,
+        0x36, 0x2A, 0x15, 0x19, 0xC0, 0x3E, 0x06, 0xC0, 0x91, 0x7A, 0x19, 0xE0, 0x05, 0xFF, 0x6C, 0xAC,
+        0x06, 0xC0, 0x01, 0xA8, 0x97, 0x9C, 0x89, 0xA6, 0x77, 0xA6, 0x97, 0x90, 0x6A, 0x19, 0xE0, 0x95,
+        0x3E, 0x16, 0x1E, 0x2C, 0x0D, 0x01, 0x06, 0xC0, 0x02, 0x19, 0xE0, 0x04, 0x6E, 0x06, 0xC1, 0xFF,
+        0x43, 0x29, 0x30, 0xC3, 0x0D, 0x9B, 0x89, 0x96, 0x69, 0x19, 0xE0, 0x8F, 0x3A, 0x1D, 0x0D, 0x30,
+        0xC3, 0x16, 0x06, 0xC1, 0x1E, 0x19, 0xE0, 0x03, 0x25, 0x06, 0xC0, 0x02, 0x19, 0xA2, 0x88, 0xA7,
+        0xA7, 0xB0, 0x97, 0x51, 0x51, 0x30, 0xC0, 0x01, 0x19, 0xE0, 0x8F, 0x01, 0x30, 0xC0, 0x21, 0x35,
+        0x09, 0x2D, 0x99, 0x7A, 0x19, 0x02, 0x06, 0xC0, 0x25, 0x19, 0xE0, 0x03, 0xB0, 0xA5, 0x06, 0xC0,
+        0x92, 0x6A, 0x19, 0xC0, 0xA9, 0x97, 0xB4, 0xA6, 0x98, 0x79, 0x19, 0x3A, 0x25, 0x19, 0xE0, 0x91,
+        0x25, 0x3A, 0x19, 0x1E, 0x2A, 0x8C, 0x6A, 0x19, 0xC0, 0x02, 0x06, 0xC0, 0x89, 0x6B, 0x19, 0xE0,
+        0x03, 0xB6, 0xB5, 0x06, 0xC0, 0x8B, 0x6B, 0x19, 0xC0, 0xAE, 0x96, 0xAF, 0xA7, 0x92, 0x7A, 0x19,
+        0xE0, 0x97, 0x29, 0x2A, 0x1A, 0x19, 0xC0, 0x3E, 0x06, 0xC0, 0x8F, 0x7B, 0x19, 0xE0, 0x03, 0xFF,
+        0x0B, 0x9C, 0x06, 0xC0, 0x01, 0x19, 0xC0, 0xB3, 0xA6, 0x2A, 0x39, 0x19, 0xE0, 0x97, 0x39, 0x2A,
+        0x0A, 0x19, 0xC0, 0x01, 0x06, 0xC0, 0x26, 0x19, 0xE0, 0x03, 0xFF, 0xCD, 0xBC, 0x06, 0xC0, 0xFF,
+        0x03, 0x21, 0x19, 0xC0, 0xB8, 0xA5, 0x2A, 0x09, 0x19, 0xE0, 0x97, 0x09, 0x2A, 0x3A, 0x19, 0xC0,
+        0x09, 0x06, 0xC0, 0x1E, 0x19, 0xE0, 0x02, 0x7E, 0x06, 0xC0, 0x66, 0x19, 0xC1, 0xFF, 0xEC, 0x93,
+        0x2A, 0xFF, 0x81, 0x08, 0x19, 0xE0, 0x97, 0x1E, 0x2A, 0x25, 0x19, 0xC1, 0x01, 0x06, 0xC0, 0x21,
+        0x19, 0xE0, 0x01, 0xA6, 0x97, 0x06, 0xC0, 0x9A, 0x79, 0x19, 0xC0, 0xA3, 0x98, 0x2A, 0x9D, 0x89,
+        0x19, 0xE0, 0x99, 0x0E, 0x2A, 0x35, 0x19, 0xC0, 0xFF, 0x8D, 0xAC, 0x06, 0xC0, 0x11, 0x19, 0xE0,
+        0x01, 0xAB, 0xA7, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0, 0x16, 0x2A, 0x99, 0x89, 0x19, 0xE0, 0x99,
+        0x26, 0x2A, 0x16, 0x19, 0xC0, 0x1E, 0x06, 0xC0, 0x01, 0x19, 0xE0, 0x01, 0xB0, 0xA5, 0x06, 0xC0,
+        0x36, 0x10, 0x2C, 0xA2, 0x88, 0xA8, 0x87, 0x14, 0x11, 0x35, 0x19, 0xE0, 0x95, 0x35, 0x11, 0x14,
+        0x09, 0x00, 0x2C, 0x10, 0x36, 0x06, 0xC0, 0x2A, 0x19, 0xE0, 0x01, 0x12, 0x06, 0xC0, 0x0D, 0x1C,
+        0x30, 0xC4, 0x14, 0x19, 0xE0, 0x93, 0x14, 0x30, 0xC4, 0x1C, 0x0D, 0x06, 0xC0, 0x12, 0x19, 0xE0,
+        0x01, 0x2E, 0x06, 0xC0, 0x2A, 0x35, 0x11, 0x0A, 0x09, 0x05, 0x31, 0x05, 0x2C, 0x19, 0xE0, 0x93,
+        0x2C, 0x05, 0x31, 0x05, 0x09, 0x0A, 0x11, 0x35, 0x2A, 0x06, 0xC0, 0x2E, 0x19, 0xE0, 0x01, 0x0F,
+        0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xC0, 0x0A, 0xAA, 0x97, 0x8C, 0x6A, 0x19, 0xE0, 0x99, 0x2A,
+        0xB4, 0xA6, 0x0A, 0x19, 0xC0, 0x06, 0xFF, 0x4F, 0xCD, 0xC0, 0x0F, 0x19, 0xE0, 0x01, 0xFF, 0x0B,
+        0x9C, 0x06, 0xC0, 0xFF, 0x84, 0x39, 0x19, 0xC0, 0xB5, 0xB6, 0x2A, 0x16, 0x19, 0xE0, 0x99, 0x16,
+        0x2A, 0x21, 0x19, 0xC0, 0x2D, 0x06, 0xC0, 0x26, 0x19, 0xE0, 0x01, 0xFF, 0x6C, 0xAC, 0x06, 0xC0,
+        0x16, 0x19, 0xC0, 0xB7, 0xB6, 0x2A, 0x88, 0x6B, 0x19, 0xE0, 0x99, 0x09, 0x2A, 0x35, 0x19, 0xC0,
+        0x16, 0x06, 0xC0, 0x02, 0x19, 0xE0, 0x01, 0xFF, 0xAD, 0xB4, 0x06, 0xC0, 0xFF, 0xE2, 0x20, 0x19,
+        0xC0, 0xB9, 0xB5, 0x2A, 0x86, 0x6B, 0x19, 0xE0, 0x99, 0x35, 0x2A, 0x02, 0x19, 0xC0, 0x3D, 0x06,
+        0xC0, 0x16, 0x19, 0xE0, 0x01, 0xFF, 0xEE, 0xBC, 0x06, 0xC0, 0x32, 0x19, 0xC0, 0xBA, 0xA5, 0xA3,
+        0x98, 0x85, 0x6B, 0x19, 0xE0, 0x99, 0x26, 0x2A, 0x0E, 0x19, 0xC0, 0x32, 0x06, 0xC0, 0x9D, 0x89,
+        0x19, 0xE0, 0x01, 0xFF, 0x0E, 0xC5, 0x06, 0xC0, 0xFF, 0x81, 0x10, 0x19, 0xC0, 0x1B, 0x7F, 0xFF,
+        0x81, 0x08, 0x19, 0xE0, 0x99, 0x1E, 0x2A, 0x1B, 0x19, 0xC0, 0x21, 0x06, 0xC0, 0x32, 0x19, 0xE0,
+        0x01, 0xFF, 0x2F, 0xCD, 0x06, 0xC0, 0x37, 0xA8, 0xA7, 0xC0, 0xAE, 0xA7, 0xC0, 0x06, 0xC8, 0x37,
+        0x19, 0xE0, 0x85, 0x37, 0x06, 0xC8, 0x11, 0xC0, 0x06, 0xC0, 0x37, 0xFF, 0x4F, 0xCD, 0xC0, 0x01,
+        0x19, 0xE0, 0x01, 0x06, 0xC0, 0x76, 0x9C, 0xBB, 0xCE, 0x37, 0x19, 0xE0, 0x83, 0x37, 0x3A, 0xCE,
+        0x04, 0x06, 0xC0, 0x19, 0xE0, 0x01, 0x06, 0xC0, 0x3F, 0x3A, 0xCE, 0x8F, 0x49, 0x19, 0xE0, 0x83,
+        0x06, 0x3A, 0xCE, 0x3F, 0xA2, 0x67, 0xC0, 0x19, 0xE0, 0x01, 0x06, 0xC0, 0x04, 0x3A, 0xCE, 0x37,
+        0x19, 0xE0, 0x83, 0x37, 0x3A, 0xCE, 0x04, 0x06, 0xC0, 0x19, 0xE0, 0x01, 0x01, 0x06, 0xC0, 0x37,
+        0xA8, 0xA7, 0xC0, 0x11, 0xC0, 0x06, 0xC8, 0x37, 0x19, 0xE0, 0x85, 0x37, 0x06, 0xC8, 0x11, 0xC0,
+        0x06, 0xC0, 0x37, 0xFF, 0x4F, 0xCD, 0xC0, 0x01, 0x19, 0xE0, 0x01, 0x32, 0x06, 0xC0, 0x21, 0x19,
+        0xC0, 0x1B, 0x2A, 0x1E, 0x19, 0xE0, 0x99, 0x1E, 0x2A, 0x1B, 0x19, 0xC0, 0x21, 0x06, 0xC0, 0x32,
+        0x19, 0xE0, 0x01, 0xFF, 0xEE, 0xBC, 0x06, 0xC0, 0xFF, 0xC2, 0x10, 0x19, 0xC0, 0x0E, 0xA3, 0x98,
+        0x26, 0x19, 0xE0, 0x99, 0x26, 0x2A, 0x0E, 0x19, 0xC0, 0x32, 0x06, 0xC0, 0x9D, 0x89, 0x19, 0xE0,
+        0x01, 0x16, 0x06, 0xC0, 0x3D, 0x19, 0xC0, 0x02, 0xA4, 0x88, 0x35, 0x19, 0xE0, 0x99, 0x35, 0x2A,
+        0x02, 0x19, 0xC0, 0x3D, 0x06, 0xC0, 0x16, 0x19, 0xE0, 0x01, 0xFF, 0x6C, 0xAC, 0x06, 0xC0, 0xFF,
+        0x43, 0x29, 0x19, 0xC0, 0xB7, 0xB6, 0x2A, 0x09, 0x19, 0xE0, 0x99, 0x09, 0x2A, 0x35, 0x19, 0xC0,
+        0x16, 0x06, 0xC0, 0x02, 0x19, 0xE0, 0x01, 0xFF, 0x0B, 0x9C, 0x06, 0xC0, 0x2D, 0x19, 0xC0, 0xB5,
+        0xB6, 0x2A, 0x16, 0x19, 0xE0, 0x99, 0x16, 0x2A, 0x21, 0x19, 0xC0, 0x2D, 0x06, 0xC0, 0x26, 0x19,
+        0xE0, 0x01, 0x0F, 0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xC0, 0x0A, 0x2A, 0x8C, 0x6A, 0x19, 0xE0,
+        0x99, 0x2A, 0xB4, 0xA6, 0x0A, 0x19, 0xC0, 0x06, 0xFF, 0x4F, 0xCD, 0xC0, 0x0F, 0x19, 0xE0, 0x01,
+        0x2E, 0x06, 0xC0, 0x89, 0x6B, 0x93, 0x7B, 0xA3, 0x98, 0x0A, 0xA6, 0x98, 0x05, 0x31, 0x05, 0x2C,
+        0x19, 0xE0, 0x93, 0x2C, 0x05, 0x31, 0x05, 0x09, 0x0A, 0x11, 0x35, 0x2A, 0x06, 0xC0, 0x2E, 0x19,
+        0xE0, 0x01, 0x12, 0x06, 0xC0, 0x0D, 0x1C, 0x30, 0xC4, 0x14, 0x19, 0xE0, 0x93, 0x14, 0x30, 0xC4,
+        0x1C, 0x0D, 0x06, 0xC0, 0x12, 0x19, 0xE0, 0x01, 0x2A, 0x06, 0xC0, 0x36, 0x10, 0x2C, 0x00, 0x09,
+        0x14, 0x11, 0x35, 0x19, 0xE0, 0x95, 0x35, 0x11, 0x14, 0x09, 0x00, 0x2C, 0x10, 0x36, 0x06, 0xC0,
+        0x2A, 0x19, 0xE0, 0x01, 0xAB, 0xA7, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0, 0x16, 0xB6, 0xA6, 0x99,
+        0x89, 0x19, 0xE0, 0x99, 0x26, 0x2A, 0x16, 0x19, 0xC0, 0x1E, 0x06, 0xC0, 0x01, 0x19, 0xE0, 0x01,
+        0x11, 0x06, 0xC0, 0x9A, 0x79, 0x19, 0xC0, 0x35, 0x2A, 0x9D, 0x89, 0x19, 0xE0, 0x99, 0x0E, 0x2A,
+        0x35, 0x19, 0xC0, 0xFF, 0x8D, 0xAC, 0x06, 0xC0, 0x11, 0x19, 0xE0, 0x01, 0x7E, 0x06, 0xC0, 0x66,
+        0x19, 0xC1, 0x25, 0x2A, 0xFF, 0x81, 0x08, 0x19, 0xE0, 0x97, 0x1E, 0x2A, 0x25, 0x19, 0xC1, 0x01,
+        0x06, 0xC0, 0x21, 0x19, 0xE0, 0x02, 0xFF, 0xCD, 0xBC, 0x06, 0xC0, 0xFF, 0x03, 0x21, 0x19, 0xC0,
+        0xB8, 0xA5, 0x2A, 0x09, 0x19, 0xE0, 0x97, 0x09, 0x2A, 0x3A, 0x19, 0xC0, 0x09, 0x06, 0xC0, 0x1E,
+        0x19, 0xE0, 0x03, 0xFF, 0x0B, 0x9C, 0x06, 0xC0, 0xFF, 0xC5, 0x41, 0x19, 0xC0, 0x0A, 0x2A, 0x39,
+        0x19, 0xE0, 0x97, 0x39, 0x2A, 0x0A, 0x19, 0xC0, 0x01, 0x06, 0xC0, 0x26, 0x19, 0xE0, 0x03, 0x29,
+        0x06, 0xC0, 0x3E, 0x19, 0xC0, 0x1A, 0x2A, 0x92, 0x7A, 0x19, 0xE0, 0x97, 0x29, 0x2A, 0x1A, 0x19,
+        0xC0, 0x3E, 0x06, 0xC0, 0x8F, 0x7B, 0x19, 0xE0, 0x03, 0xB0, 0xA5, 0x06, 0xC0, 0x92, 0x6A, 0x19,
+        0xC0, 0xA9, 0x97, 0xB4, 0xA6, 0x98, 0x79, 0x19, 0xA4, 0x87, 0xA4, 0x98, 0x19, 0xE0, 0x91, 0x25,
+        0x3A, 0x19, 0x1E, 0x2A, 0x8C, 0x6A, 0x19, 0xC0, 0x02, 0x06, 0xC0, 0x89, 0x6B, 0x19, 0xE0, 0x03,
+        0x25, 0x06, 0xC0, 0x99, 0x89, 0x19, 0xA2, 0x88, 0xA7, 0xA7, 0xB0, 0x97, 0x51, 0x51, 0x30, 0xC0,
+        0x01, 0x19, 0xE0, 0x8F, 0x01, 0x30, 0xC0, 0x21, 0x35, 0x09, 0x2D, 0x99, 0x7A, 0x19, 0x02, 0x06,
+        0xC0, 0x25, 0x19, 0xE0, 0x03, 0x6E, 0x06, 0xC1, 0x16, 0x30, 0xC3, 0x0D, 0x1D, 0x3A, 0x19, 0xE0,
+        0x8F, 0x3A, 0x1D, 0x0D, 0x30, 0xC3, 0x16, 0x06, 0xC1, 0x1E, 0x19, 0xE0, 0x04, 0x02, 0x06, 0xC0,
+        0x01, 0x0D, 0x2C, 0xA6, 0x77, 0xA6, 0x97, 0x90, 0x6A, 0x19, 0xE0, 0x95, 0x3E, 0x16, 0x1E, 0x2C,
+        0x0D, 0x01, 0x06, 0xC0, 0x02, 0x19, 0xE0, 0x05, 0x36, 0x06, 0xC0, 0x8B, 0x6B, 0x19, 0xC0, 0x15,
+        0xB0, 0x96, 0x94, 0x79, 0x19, 0xE0, 0x95, 0x36, 0x2A, 0x15, 0x19, 0xC0, 0x3E, 0x06, 0xC0, 0x91,
+        0x7A, 0x19, 0xE0, 0x05, 0x22, 0x06, 0xC0, 0x0F, 0x19, 0xC0, 0xA6, 0x87, 0x2A, 0x9B, 0x89, 0x19,
+        0xE0, 0x95, 0x3A, 0x2A, 0x0E, 0x19, 0xC0, 0x0F, 0x06, 0xC0, 0x22, 0x19, 0xE0, 0x05, 0x0E, 0x06,
+        0xC0, 0x9D, 0x89, 0x19, 0xC1, 0x1B, 0x7F, 0x32, 0x19, 0xE0, 0x93, 0x32, 0x2A, 0x1B, 0x19, 0xC1,
+        0xFF, 0xEE, 0xBC, 0x06, 0xC0, 0x0E, 0x19, 0xE0, 0x06, 0xFF, 0xCD, 0xBC, 0x06, 0xC0, 0xFF, 0x43,
+        0x29, 0x19, 0xC0, 0x12, 0xA9, 0x98, 0x39, 0x19, 0xE0, 0x93, 0x39, 0x2A, 0x12, 0x19, 0xC0, 0x16,
+        0x06, 0xC0, 0x1E, 0x19, 0xE0, 0x07, 0xB9, 0xB5, 0x06, 0xC0, 0x8A, 0x6B, 0x19, 0xC0, 0xAC, 0x96,
+        0x2A, 0x05, 0x19, 0xE0, 0x93, 0x05, 0x2A, 0x06, 0x19, 0xC0, 0x39, 0xB6, 0xA5, 0xC0, 0x02, 0x19,
+        0xE0, 0x07, 0x22, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0, 0xA4, 0x87, 0x2A, 0x51, 0x19, 0xE0, 0x93,
+        0x16, 0x2A, 0x3A, 0x19, 0xC0, 0x1E, 0x06, 0xC0, 0x22, 0x19, 0xE0, 0x07, 0x3A, 0x06, 0xC1, 0xFF,
+        0x81, 0x08, 0x19, 0xC0, 0xB8, 0xA5, 0x2A, 0x01, 0x15, 0x1C, 0x08, 0x19, 0xE0, 0x8B, 0x08, 0x1C,
+        0x15, 0x01, 0x2A, 0x3A, 0x19, 0xC0, 0x1E, 0x06, 0xC1, 0xFF, 0xE2, 0x18, 0x19, 0xE0, 0x08, 0xFF,
+        0x4C, 0xA4, 0x06, 0xC0, 0x85, 0x6C, 0x19, 0xA7, 0x98, 0x14, 0x30, 0xC2, 0x31, 0x19, 0xE0, 0x8B,
+        0x31, 0x30, 0xC2, 0x14, 0x1D, 0x19, 0x09, 0x06, 0xC0, 0x3A, 0x19, 0xE0, 0x09, 0x12, 0x06, 0xC0,
+        0x36, 0x24, 0x30, 0xC2, 0x94, 0x69, 0x99, 0x89, 0x19, 0xE0, 0x8D, 0x35, 0x39, 0x30, 0xC2, 0x24,
+        0x36, 0x06, 0xC0, 0x12, 0x19, 0xE0, 0x09, 0x25, 0x06, 0xC0, 0x9D, 0x99, 0xFF, 0x84, 0x39, 0x31,
+        0x34, 0xAF, 0xA6, 0x2A, 0x8A, 0x6A, 0x19, 0xE0, 0x8F, 0x16, 0x2A, 0x3D, 0x34, 0x31, 0x2D, 0xFF,
+        0xEE, 0xC4, 0x06, 0xC0, 0x25, 0x19, 0xE0, 0x0A, 0xFF, 0x8D, 0xB4, 0x06, 0xC0, 0x01, 0x19, 0xC0,
+        0xAF, 0xA7, 0x2A, 0x94, 0x79, 0x19, 0xE0, 0x8F, 0x36, 0x2A, 0x29, 0x19, 0xC0, 0x01, 0x06, 0xC0,
+        0x11, 0x19, 0xE0, 0x0B, 0xB5, 0xB5, 0x06, 0xC0, 0x91, 0x7A, 0x19, 0xC0, 0xA5, 0x98, 0x2A, 0x51,
+        0x19, 0xE0, 0x8F, 0x16, 0x2A, 0x09, 0x19, 0xC0, 0x36, 0x06, 0xC0, 0x1A, 0x19, 0xE0, 0x0B, 0x25,
+        0x06, 0xC0, 0x51, 0x19, 0xC1, 0x2B, 0x2A, 0x8C, 0x6A, 0x19, 0xE0, 0x8D, 0x2A, 0xB4, 0xA6, 0x2B,
+        0x19, 0xC1, 0x32, 0x06, 0xC0, 0x25, 0x19, 0xE0, 0x0C, 0xFF, 0x6C, 0xAC, 0x06, 0xC0, 0x87, 0x6C,
+        0x19, 0xC0, 0xAC, 0x96, 0x2A, 0x12, 0x19, 0xE0, 0x8D, 0x12, 0x2A, 0x06, 0x19, 0xC0, 0x1D, 0xB9,
+        0xB5, 0xC0, 0x02, 0x19, 0xE0, 0x0D, 0x3E, 0x06, 0xC0, 0x95, 0x7A, 0x19, 0xC0, 0x7E, 0x2A, 0xC0,
+        0x87, 0x6B, 0x19, 0xC0, 0x21, 0x19, 0xE0, 0x85, 0x21, 0x19, 0xC0, 0x3A, 0x2A, 0xC0, 0x21, 0x19,
+        0xC0, 0x1E, 0x06, 0xC0, 0x3E, 0x19, 0xE0, 0x0D, 0x3A, 0x06, 0xC1, 0x0E, 0x19, 0xC0, 0x3B, 0x2A,
+        0x29, 0x98, 0x78, 0x31, 0x30, 0x25, 0x19, 0xE0, 0x83, 0x25, 0x30, 0x31, 0x16, 0x29, 0x2A, 0x3B,
+        0x19, 0xC0, 0x0E, 0x06, 0xC1, 0x3A, 0x19, 0xE0, 0x0E, 0xFF, 0xAA, 0x8B, 0x06, 0xC0, 0x1A, 0x19,
+        0xC0, 0x0E, 0xB4, 0xB6, 0x9D, 0x89, 0x30, 0xC0, 0x55, 0x91, 0x7A, 0x19, 0xE0, 0x83, 0x11, 0x21,
+        0x30, 0xC0, 0x35, 0xA3, 0x98, 0x0E, 0x19, 0xC0, 0x1A, 0x06, 0xC0, 0x0A, 0x19, 0xE0, 0x0F, 0xAC,
+        0x96, 0xFF, 0x4F, 0xCD, 0xC0, 0x9D, 0x89, 0x19, 0x01, 0x1C, 0x30, 0xC0, 0x1C, 0x34, 0x19, 0xE0,
+        0x87, 0x34, 0x1C, 0x30, 0xC0, 0x1C, 0x01, 0x19, 0x2A, 0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xE0,
+        0x10, 0xFF, 0x8D, 0xAC, 0xA6, 0x97, 0xC0, 0x22, 0x30, 0xC0, 0x08, 0xA9, 0x87, 0x9D, 0x89, 0x19,
+        0xE0, 0x89, 0x3A, 0x16, 0x08, 0x30, 0xC0, 0x22, 0x06, 0xC0, 0x0E, 0x19, 0xE0, 0x11, 0xB1, 0xB6,
+        0x06, 0xC0, 0x98, 0x79, 0x09, 0xC0, 0x19, 0xB8, 0xA5, 0xA5, 0x98, 0x8D, 0x7B, 0x19, 0xC7, 0xB1,
+        0xD7, 0xAF, 0xD8, 0x41, 0x3C, 0x19, 0xE0, 0x6D, 0x3C, 0x0F, 0x26, 0x06, 0x19, 0xC7, 0x39, 0x2A,
+        0x3A, 0x19, 0x09, 0xC0, 0xFF, 0x4C, 0xA4, 0xA8, 0x97, 0xC0, 0x8A, 0x6B, 0x19, 0xE0, 0x11, 0x7E,
+        0x32, 0x06, 0xC0, 0xFF, 0xE5, 0x41, 0x19, 0xC0, 0xAB, 0x97, 0x2A, 0x35, 0x19, 0xC5, 0x13, 0x0F,
+        0xA4, 0x98, 0xC1, 0x38, 0x19, 0xE0, 0x6D, 0x38, 0x3A, 0xC1, 0x0F, 0x13, 0x19, 0xC5, 0x35, 0x2A,
+        0x3E, 0x19, 0xC0, 0x06, 0xFF, 0x4F, 0xCD, 0xC0, 0x32, 0x21, 0x19, 0xE0, 0x12, 0x1A, 0x06, 0xC0,
+        0x96, 0x79, 0x19, 0xC1, 0xB8, 0xA5, 0x2A, 0x8D, 0x7B, 0x19, 0xC2, 0x28, 0xB1, 0xD8, 0xA9, 0xB8,
+        0xC3, 0x38, 0x19, 0xE0, 0x6D, 0x38, 0x3A, 0xC3, 0x1C, 0x28, 0x19, 0xC2, 0x39, 0x2A, 0x9B, 0x89,
+        0x19, 0xC1, 0x26, 0x06, 0xC0, 0x1A, 0x19, 0xE0, 0x13, 0xA4, 0x87, 0x06, 0xC1, 0x3E, 0x19, 0xC0,
+        0x3E, 0x2A, 0x9B, 0x89, 0x19, 0xC0, 0xA3, 0x98, 0xB1, 0xE8, 0xAE, 0xB7, 0xC4, 0x0F, 0x3C, 0x19,
+        0xE0, 0x6D, 0x3C, 0x0F, 0x3A, 0xC4, 0x2C, 0x35, 0x19, 0xC0, 0xB8, 0xA5, 0x2A, 0x3E, 0x19, 0xC0,
+        0x3E, 0x06, 0xC1, 0xFF, 0xE2, 0x18, 0x19, 0xE0, 0x14, 0xB6, 0xB5, 0x06, 0xC0, 0x95, 0x8A, 0x19,
+        0xC1, 0xB8, 0xA5, 0x2A, 0x8F, 0x7A, 0xA4, 0xB9, 0xB1, 0xD8, 0x7E, 0xC4, 0x90, 0x49, 0x19, 0xE0,
+        0x71, 0x15, 0x3A, 0xC4, 0x32, 0x3E, 0x06, 0x2A, 0x9B, 0x89, 0x19, 0xC1, 0x21, 0xAB, 0x97, 0xC0,
+        0x29, 0x19, 0xE0, 0x15, 0xA5, 0x97, 0x06, 0xC1, 0x01, 0x19, 0xC0, 0xAA, 0x96, 0xB5, 0xC7, 0xA2,
+        0xB9, 0xA1, 0xA9, 0xC4, 0x94, 0x59, 0x0C, 0x19, 0xE0, 0x73, 0x0C, 0x00, 0x3A, 0xC4, 0x28, 0x04,
+        0x32, 0x19, 0xC0, 0x01, 0x06, 0xC1, 0x02, 0x19, 0xE0, 0x16, 0x29, 0x06, 0xC0, 0x97, 0x79, 0x19,
+        0xA6, 0xA8, 0xB2, 0xC6, 0x3A, 0xC4, 0x33, 0x3C, 0x19, 0xE0, 0x77, 0x3C, 0x33, 0x3A, 0xC4, 0x0D,
+        0x1B, 0x19, 0x2B, 0x06, 0xC0, 0x29, 0x19, 0xE0, 0x17, 0xA4, 0x87, 0x06, 0xC1, 0x8A, 0x5B, 0xFF,
+        0xB0, 0xDC, 0xC4, 0x23, 0x8E, 0x49, 0x19, 0xE0, 0x7B, 0x2A, 0x23, 0x3A, 0xC4, 0x36, 0x06, 0xC1,
+        0xFF, 0xE2, 0x18, 0x19, 0xE0, 0x18, 0xB4, 0xB5, 0x06, 0xC0, 0x9A, 0x9A, 0xA1, 0xCA, 0xC3, 0x99,
+        0x68, 0xFF, 0xA1, 0x10, 0x19, 0xE0, 0x7D, 0x26, 0x29, 0x3A, 0xC3, 0x1B, 0x06, 0xC0, 0x15, 0x19,
+        0xE0, 0x19, 0x7E, 0xFF, 0xEE, 0xBC, 0x06, 0x76, 0x3A, 0xC1, 0x96, 0x59, 0xA5, 0x66, 0x5A, 0x8C,
+        0x6A, 0x19, 0xE0, 0x7D, 0x2A, 0xB4, 0xA6, 0x2D, 0x14, 0x3A, 0xC1, 0x04, 0x06, 0x9D, 0x89, 0x21,
+        0x19, 0xE0, 0x1A, 0x31, 0x06, 0xC0, 0x3F, 0x8E, 0x6B, 0x97, 0x79, 0x19, 0xAC, 0x96, 0xB1, 0xA7,
+        0x9C, 0x88, 0x19, 0xE0, 0x7D, 0x02, 0x2A, 0x06, 0x19, 0x3F, 0x1A, 0xB2, 0xA5, 0xA2, 0x67, 0xC0,
+        0x31, 0x19, 0xE0, 0x1C, 0xFF, 0x2C, 0xA4, 0x06, 0xC0, 0x02, 0x19, 0xC1, 0xB5, 0xB6, 0x2A, 0x36,
+        0x19, 0xE0, 0x7B, 0x36, 0x2A, 0x21, 0x19, 0xC1, 0x02, 0x06, 0xC0, 0x35, 0x19, 0xE0, 0x1D, 0x32,
+        0x06, 0xC1, 0xFF, 0xE5, 0x41, 0x19, 0xC0, 0x09, 0x2A, 0xC0, 0x25, 0x19, 0xC0, 0xA6, 0x97, 0x6F,
+        0x19, 0xE0, 0x71, 0x1D, 0x11, 0x19, 0xC0, 0x25, 0x2A, 0xC0, 0x09, 0x19, 0xC0, 0x06, 0xFF, 0x4F,
+        0xCD, 0xC1, 0x32, 0x19, 0xE0, 0x1E, 0x2E, 0x06, 0xC0, 0x9A, 0x89, 0x19, 0xC1, 0xAE, 0x96, 0x2A,
+        0x02, 0x88, 0x5B, 0x01, 0x30, 0xC0, 0x1E, 0x19, 0xE0, 0x6F, 0x1E, 0x30, 0xC0, 0x01, 0x1E, 0x02,
+        0x2A, 0x1A, 0x19, 0xC1, 0x11, 0x06, 0xC0, 0x2E, 0x19, 0xE0, 0x1F, 0xA2, 0x88, 0xFF, 0xEE, 0xBC,
+        0x06, 0xC0, 0x8F, 0x7B, 0x19, 0xC1, 0xB5, 0xA6, 0xA7, 0xA8, 0x21, 0x30, 0xC0, 0x01, 0x19, 0xE0,
+        0x71, 0x01, 0x30, 0xC0, 0x21, 0x25, 0x1E, 0x19, 0xC1, 0x29, 0x06, 0xC0, 0x2A, 0x2D, 0x19, 0xE0,
+        0x20, 0xAE, 0xA6, 0x06, 0xC1, 0x01, 0x19, 0xC0, 0x39, 0x30, 0xC0, 0x51, 0x92, 0x69, 0x19, 0xE0,
+        0x73, 0x11, 0x1C, 0x30, 0xC0, 0x39, 0x19, 0xC0, 0x01, 0x06, 0xC1, 0x1D, 0x19, 0xE0, 0x22, 0xFF,
+        0x8A, 0x8B, 0x06, 0xC0, 0x9B, 0x89, 0xFF, 0x81, 0x10, 0x10, 0x30, 0xC0, 0xA2, 0x88, 0xA5, 0x87,
+        0x09, 0x19, 0xE0, 0x73, 0x09, 0x2A, 0x04, 0x30, 0xC0, 0x10, 0x21, 0x16, 0x06, 0xC0, 0x05, 0x19,
+        0xE0, 0x23, 0xA3, 0x98, 0xFF, 0xEE, 0xBC, 0x06, 0xC0, 0x91, 0x7A, 0x97, 0x7B, 0x30, 0x93, 0x79,
+        0xA8, 0x87, 0xAC, 0x97, 0x9A, 0x89, 0x19, 0xE0, 0x73, 0x35, 0x2A, 0x36, 0x2D, 0x30, 0x29, 0xA9,
+        0xA6, 0x06, 0xC0, 0x9D, 0x89, 0xFF, 0xC2, 0x18, 0x19, 0xE0, 0x24, 0xAD, 0xA7, 0x06, 0xC1, 0x22,
+        0x21, 0x19, 0xC0, 0xB7, 0xA5, 0xA6, 0x98, 0x95, 0x8A, 0x19, 0xE0, 0x71, 0x05, 0x2A, 0x2B, 0x19,
+        0xC0, 0x21, 0x22, 0x06, 0xC1, 0x15, 0x19, 0xE0, 0x26, 0xB6, 0xB5, 0x06, 0xC1, 0xFF, 0x43, 0x29,
+        0x19, 0xC0, 0xA4, 0x87, 0xB8, 0xA5, 0x2A, 0x1A, 0x19, 0xE0, 0x6F, 0x1A, 0x2A, 0x1B, 0x3A, 0x19,
+        0xC0, 0x16, 0x06, 0xC1, 0x29, 0x19, 0xE0, 0x28, 0xFF, 0x4C, 0xA4, 0x06, 0xC0, 0x3A, 0x19, 0xC1,
+        0xA9, 0x97, 0xB4, 0xA6, 0xC0, 0x39, 0x19, 0xC0, 0x24, 0x05, 0x19, 0xE0, 0x65, 0x05, 0x24, 0x19,
+        0xC0, 0x39, 0x2A, 0xC0, 0x8C, 0x6A, 0x19, 0xC1, 0x3A, 0x06, 0xC0, 0x3A, 0x19, 0xE0, 0x29, 0x16,
+        0x06, 0xC1, 0x02, 0x19, 0xC1, 0x15, 0xB0, 0x96, 0xC0, 0x8B, 0x6A, 0x31, 0x30, 0x1C, 0x8D, 0x5A,
+        0x19, 0xE0, 0x63, 0x1E, 0x1C, 0x30, 0x31, 0x1B, 0x2A, 0xC0, 0x15, 0x19, 0xC1, 0x02, 0x06, 0xC1,
+        0x16, 0x19, 0xE0, 0x2A, 0x22, 0x06, 0xC1, 0x8C, 0x6A, 0x19, 0xC1, 0x31, 0x25, 0x9B, 0x89, 0x30,
+        0x08, 0x92, 0x59, 0x19, 0xE0, 0x65, 0x3A, 0x08, 0x30, 0x35, 0x25, 0x31, 0x19, 0xC1, 0x06, 0xB4,
+        0xA6, 0xC1, 0x22, 0x19, 0xE0, 0x2C, 0xB5, 0xB5, 0x06, 0xC1, 0x87, 0x5C, 0x19, 0xC0, 0xA4, 0x97,
+        0xB1, 0xB8, 0x30, 0xC0, 0x8F, 0x59, 0x19, 0xE0, 0x67, 0x3F, 0x30, 0xC0, 0x2B, 0x3D, 0x19, 0xC0,
+        0x1A, 0x06, 0xC1, 0x8E, 0x6A, 0x19, 0xE0, 0x2E, 0xFF, 0xCA, 0x93, 0x06, 0xC1, 0x2D, 0x3A, 0xB1,
+        0xB7, 0x30, 0x21, 0x2A, 0x9A, 0x79, 0x8A, 0x7A, 0x19, 0xE0, 0x65, 0x21, 0x32, 0x2A, 0x98, 0x89,
+        0x30, 0x21, 0x3A, 0x2D, 0x06, 0xC1, 0x12, 0x19, 0xE0, 0x2F, 0x26, 0xFF, 0x6C, 0xAC, 0x06, 0xC0,
+        0x9C, 0x88, 0x2F, 0x30, 0x18, 0x94, 0x69, 0xB6, 0x95, 0x2A, 0x99, 0x89, 0x8B, 0x6B, 0x19, 0xE0,
+        0x63, 0x1E, 0x26, 0x2A, 0x2B, 0x21, 0x18, 0x30, 0x2F, 0xFF, 0xCD, 0xBC, 0x06, 0xC0, 0x02, 0xFF,
+        0xA1, 0x10, 0x19, 0xE0, 0x30, 0x11, 0xFF, 0xEE, 0xC4, 0x06, 0xC0, 0x02, 0x3A, 0x19, 0xC0, 0xA3,
+        0x88, 0xB5, 0xB6, 0x2A, 0x99, 0x89, 0x8B, 0x6B, 0x19, 0xC1, 0x1E, 0x19, 0xE0, 0x59, 0x1E, 0x19,
+        0xC1, 0x1E, 0x26, 0x2A, 0x3A, 0x32, 0x19, 0xC0, 0xA4, 0x87, 0x02, 0x06, 0xC0, 0x2D, 0x11, 0x19,
+        0xE0, 0x32, 0xAA, 0x96, 0x06, 0xC1, 0x97, 0x79, 0x1E, 0x19, 0xC0, 0xA3, 0x98, 0xB5, 0xA6, 0x2A,
+        0x26, 0x21, 0x19, 0xA4, 0x87, 0x1C, 0x05, 0x19, 0xE0, 0x57, 0x05, 0x1C, 0x3A, 0x19, 0x21, 0x26,
+        0x2A, 0x9B, 0x89, 0x35, 0x19, 0xC0, 0x1E, 0x2B, 0x06, 0xC1, 0x32, 0x19, 0xE0, 0x34, 0x15, 0x06,
+        0xC1, 0x95, 0x7A, 0x19, 0xC1, 0x35, 0x3A, 0x2A, 0x9A, 0x79, 0x3F, 0x08, 0x30, 0x24, 0x19, 0xE0,
+        0x57, 0x24, 0x30, 0x08, 0x3F, 0x32, 0x2A, 0x3A, 0x35, 0x19, 0xC1, 0x1E, 0x06, 0xC1, 0x15, 0x19,
+        0xE0, 0x36, 0xB0, 0xA5, 0x06, 0xC1, 0x94, 0x7A, 0xFF, 0x61, 0x08, 0xC1, 0xA3, 0x88, 0xB4, 0xA5,
+        0xA6, 0x98, 0x30, 0xC0, 0x31, 0x19, 0xE0, 0x59, 0x31, 0x30, 0xC0, 0x2A, 0x2B, 0x32, 0x19, 0xC1,
+        0xFF, 0xCB, 0x93, 0x06, 0xC1, 0x89, 0x6B, 0x90, 0x6B, 0xE0, 0x38, 0xB1, 0xB6, 0x06, 0xC1, 0x94,
+        0x7A, 0xFF, 0x61, 0x08, 0xC1, 0x21, 0xB4, 0xA6, 0x30, 0x6E, 0x1B, 0x19, 0xE0, 0x59, 0x1B, 0x35,
+        0x30, 0x21, 0x8C, 0x6A, 0x19, 0xC1, 0xFF, 0xCB, 0x93, 0x06, 0xC1, 0x39, 0x8F, 0x6B, 0xE0, 0x3A,
+        0xB2, 0xA5, 0x06, 0xC1, 0x1E, 0xFF, 0x81, 0x08, 0x19, 0x18, 0x30, 0x66, 0x25, 0x6E, 0x8D, 0x7B,
+        0x19, 0xCE, 0x3C, 0x38, 0xC0, 0x3C, 0x19, 0xE0, 0x2F, 0x3C, 0x38, 0xC0, 0x3C, 0x19, 0xCE, 0x39,
+        0x2A, 0x25, 0x2B, 0x30, 0x18, 0x19, 0x1E, 0xFF, 0xEB, 0x93, 0x06, 0xC1, 0x3E, 0x19, 0xE0, 0x3C,
+        0x3E, 0x06, 0xC1, 0x97, 0x79, 0x86, 0x5C, 0x30, 0x55, 0x3D, 0x31, 0x2A, 0xC0, 0x91, 0x7A, 0x19,
+        0xC3, 0x6E, 0x19, 0xC7, 0x0F, 0xA4, 0x98, 0xC0, 0x0F, 0x19, 0xE0, 0x2F, 0x0F, 0x3A, 0xC0, 0x0F,
+        0x19, 0xC7, 0x1E, 0x19, 0xC3, 0x1A, 0x2A, 0xC0, 0x31, 0x3D, 0x21, 0x30, 0x8E, 0x59, 0x2B, 0x06,
+        0xC1, 0x3E, 0x19, 0xE0, 0x3E, 0xB1, 0xB6, 0x06, 0xC1, 0x02, 0x2F, 0x3A, 0x19, 0xC0, 0x15, 0x2A,
+        0xC0, 0x05, 0x19, 0xC1, 0x01, 0x30, 0x91, 0x6A, 0x19, 0xC5, 0xB2, 0xD7, 0xB0, 0xC7, 0xC1, 0x51,
+        0x19, 0xE0, 0x2F, 0x26, 0x3A, 0xC1, 0x15, 0x19, 0xC5, 0x1D, 0x30, 0x01, 0x19, 0xC1, 0x05, 0x2A,
+        0xC0, 0x90, 0x7A, 0x19, 0xC0, 0xA4, 0x87, 0x2F, 0x02, 0x06, 0xC1, 0x39, 0x19, 0xE0, 0x40, 0xB0,
+        0xA5, 0x06, 0xC1, 0x9C, 0x88, 0x86, 0x5C, 0x19, 0xC1, 0xA9, 0x97, 0xB3, 0xA6, 0x7F, 0x35, 0x09,
+        0x11, 0x30, 0xC0, 0x11, 0x19, 0xC4, 0x0C, 0xFF, 0xB0, 0xDC, 0xC2, 0x8F, 0x49, 0x19, 0xE0, 0x2F,
+        0x06, 0x3A, 0xC2, 0x0C, 0x19, 0xC4, 0x11, 0x30, 0xC0, 0x11, 0x09, 0x35, 0x2A, 0x1B, 0x8D, 0x7B,
+        0x19, 0xC1, 0x2D, 0x1E, 0xA4, 0x88, 0xC1, 0x89, 0x6B, 0x19, 0xE0, 0x42, 0x15, 0x06, 0xC2, 0x1A,
+        0x19, 0xC1, 0xA4, 0x87, 0xB3, 0xA6, 0xA6, 0x98, 0xC0, 0x1C, 0x30, 0x01, 0x19, 0xC5, 0x00, 0xAC,
+        0xB7, 0xC1, 0x0F, 0x19, 0xE0, 0x31, 0x0F, 0x3A, 0xC1, 0x00, 0x19, 0xC5, 0x01, 0x30, 0x1C, 0x2A,
+        0xC0, 0x2B, 0x8D, 0x7B, 0x19, 0xC1, 0x1A, 0x06, 0xC2, 0x15, 0x19, 0xE0, 0x44, 0xAA, 0x96, 0xFF,
+        0xEE, 0xC4, 0x06, 0xC1, 0x8C, 0x6A, 0x19, 0xC2, 0xB1, 0xA6, 0x04, 0x30, 0x21, 0x8C, 0x5A, 0x19,
+        0xC4, 0x3C, 0xFF, 0xB0, 0xDC, 0xC2, 0x13, 0x19, 0xE0, 0x31, 0x13, 0x3A, 0xC2, 0x3C, 0x19, 0xC4,
+        0x1E, 0x21, 0x30, 0x04, 0x36, 0x19, 0xC2, 0x06, 0xB4, 0xA6, 0xC1, 0x2D, 0x32, 0x19, 0xE0, 0x46,
+        0x11, 0x02, 0x06, 0xC1, 0x92, 0x6A, 0x19, 0xC1, 0xA9, 0xA7, 0x30, 0xC0, 0x25, 0x02, 0x8F, 0x7B,
+        0x19, 0xC3, 0x33, 0x3A, 0xC1, 0x97, 0x69, 0x19, 0xE0, 0x33, 0x1C, 0x3A, 0xC1, 0x33, 0x19, 0xC3,
+        0x25, 0x02, 0xA3, 0x99, 0x30, 0xC0, 0x2D, 0x19, 0xC1, 0x02, 0x06, 0xC1, 0x99, 0x89, 0x11, 0x19,
+        0xE0, 0x48, 0xA2, 0x87, 0x12, 0x06, 0xC1, 0x98, 0x79, 0x16, 0x9A, 0x89, 0x30, 0xC0, 0x94, 0x69,
+        0xAB, 0x97, 0x2A, 0xC0, 0x36, 0x19, 0xC1, 0xAE, 0xC7, 0xB4, 0xD7, 0xC2, 0xFF, 0x64, 0x39, 0x19,
+        0xE0, 0x33, 0x28, 0x3A, 0xC2, 0x2A, 0x19, 0xC1, 0x36, 0xAC, 0x97, 0xC0, 0x1E, 0x39, 0x30, 0xC0,
+        0x21, 0x16, 0xB8, 0xB5, 0x06, 0xC1, 0x12, 0x26, 0x19, 0xE0, 0x4B, 0xB5, 0xB5, 0x06, 0xC2, 0x22,
+        0x6B, 0x10, 0x19, 0xC0, 0xAE, 0x96, 0x2A, 0xC0, 0x9C, 0x88, 0x90, 0x6A, 0x26, 0x23, 0xA2, 0x98,
+        0xC1, 0x2C, 0x19, 0xE0, 0x35, 0x2C, 0x3A, 0xC1, 0x23, 0x26, 0x2A, 0x02, 0xA4, 0x88, 0xC0, 0x1A,
+        0x19, 0xC0, 0x10, 0x29, 0x22, 0x06, 0xC2, 0x8E, 0x6A, 0x19, 0xE0, 0x4E, 0x22, 0x06, 0xC2, 0x91,
+        0x7A, 0x21, 0x19, 0xC1, 0x09, 0xB0, 0xA6, 0x2A, 0xC0, 0x9E, 0xC9, 0x3A, 0xC1, 0x56, 0xFF, 0xC2,
+        0x18, 0x19, 0xE0, 0x35, 0x35, 0x32, 0x3A, 0xC1, 0x29, 0x2A, 0xC0, 0x21, 0x09, 0x19, 0xC1, 0x7E,
+        0x36, 0x06, 0xC2, 0x22, 0x19, 0xE0, 0x50, 0x16, 0xB8, 0xB5, 0x06, 0xC1, 0x9B, 0x89, 0x01, 0x19,
+        0xC2, 0xAC, 0x96, 0xB1, 0xB7, 0xA5, 0xEA, 0xC2, 0x8E, 0x39, 0x19, 0xE0, 0x37, 0x3E, 0x3A, 0xC2,
+        0x2D, 0x06, 0x19, 0xC2, 0x01, 0x16, 0xA5, 0x98, 0xC1, 0x98, 0x79, 0x88, 0x5B, 0x19, 0xE0, 0x53,
+        0xB6, 0xB5, 0x06, 0xC2, 0x29, 0x19, 0xC2, 0x14, 0xAA, 0xB7, 0xC1, 0x45, 0xFF, 0xE5, 0x41, 0x19,
+        0xC4, 0x11, 0xA2, 0x88, 0x19, 0xE0, 0x01, 0x37, 0xA8, 0xA7, 0x37, 0x19, 0xE0, 0x01, 0x25, 0x11,
+        0x19, 0xC4, 0xAC, 0x96, 0x28, 0x3A, 0xC1, 0x14, 0x19, 0xC2, 0x29, 0xB1, 0xA6, 0xC2, 0x29, 0x19,
+        0xE0, 0x56, 0x15, 0xB7, 0xB5, 0x06, 0xC1, 0x9A, 0x89, 0x8B, 0x5B, 0x19, 0xAA, 0xB7, 0x3A, 0xC2,
+        0x9D, 0x47, 0x9E, 0x68, 0x9B, 0x89, 0x39, 0x19, 0xC2, 0xB5, 0xB6, 0x30, 0x8B, 0x6A, 0x19, 0xDF,
+        0x37, 0xFF, 0xB0, 0xDC, 0xC1, 0x37, 0x19, 0xDF, 0x21, 0x30, 0x55, 0x19, 0xC2, 0x39, 0xAE, 0x96,
+        0x2A, 0x04, 0xA3, 0xDA, 0xC2, 0x3F, 0x19, 0x06, 0x11, 0xA6, 0x87, 0xC1, 0x9D, 0x89, 0x15, 0x19,
+        0xE0, 0x58, 0x35, 0xB6, 0xB5, 0x06, 0xC2, 0x02, 0x9A, 0xAA, 0x3A, 0xC1, 0x0D, 0x92, 0x38, 0xAE,
+        0x97, 0xA5, 0x98, 0xC0, 0x9A, 0x89, 0x39, 0x19, 0x34, 0x30, 0x31, 0x19, 0xE0, 0x00, 0xB1, 0xD7,
+        0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xE0, 0x00, 0x31, 0x30, 0x34, 0x19, 0x39, 0x35, 0x2A, 0xC0, 0x9B,
+        0x89, 0x32, 0x0D, 0xAA, 0xB8, 0xC1, 0x1A, 0x02, 0xAE, 0xA6, 0xC2, 0x05, 0x8A, 0x5B, 0x19, 0xE0,
+        0x5B, 0xAE, 0xA6, 0xB6, 0xA5, 0x06, 0xC1, 0x72, 0x3A, 0xC1, 0xFF, 0x24, 0x31, 0x19, 0xC0, 0xAB,
+        0x97, 0xAD, 0xA7, 0xA5, 0x98, 0xC0, 0x3A, 0x9C, 0x99, 0x30, 0x16, 0x19, 0xE0, 0x00, 0xB1, 0xD7,
+        0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xE0, 0x00, 0x16, 0x30, 0x1C, 0xA4, 0x77, 0x2A, 0xC0, 0x3A, 0x3E,
+        0x19, 0xC0, 0x1B, 0xFF, 0xB0, 0xDC, 0xC1, 0x3F, 0xA2, 0x67, 0xC1, 0x9D, 0x89, 0x1D, 0x19, 0xE0,
+        0x5E, 0xA2, 0x88, 0x2E, 0x06, 0xC1, 0x76, 0x9B, 0x8A, 0x90, 0x49, 0x19, 0xC3, 0x3E, 0xAD, 0xA7,
+        0xA3, 0x98, 0x30, 0x6E, 0x98, 0x79, 0x95, 0x79, 0x19, 0xC4, 0x31, 0x08, 0x19, 0xD7, 0xB1, 0xD7,
+        0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xD7, 0x08, 0x31, 0x19, 0xC4, 0xA4, 0x87, 0x29, 0x35, 0x30, 0x16,
+        0x9D, 0x89, 0x3E, 0x19, 0xC3, 0x36, 0x1B, 0x04, 0x5E, 0xC1, 0x2E, 0x2D, 0x19, 0xE0, 0x61, 0x32,
+        0xB4, 0xB6, 0x06, 0xC2, 0x97, 0x79, 0x01, 0x19, 0xC3, 0x08, 0x30, 0xA4, 0x87, 0xA3, 0x88, 0xC0,
+        0x97, 0x89, 0x95, 0x7A, 0x19, 0xC1, 0xA3, 0x98, 0x30, 0x1C, 0x19, 0xD7, 0xB1, 0xD7, 0xB1, 0xD8,
+        0xC1, 0x06, 0x19, 0xD7, 0x1C, 0x30, 0x35, 0x19, 0xC1, 0x2A, 0x12, 0xA9, 0x98, 0xC0, 0x11, 0x30,
+        0x08, 0x19, 0xC3, 0x01, 0x2B, 0xA9, 0xA8, 0xC2, 0x97, 0x8A, 0x32, 0x19, 0xE0, 0x65, 0x31, 0xB4,
+        0xA5, 0x06, 0xC2, 0x95, 0x8A, 0x3E, 0x19, 0xC0, 0x09, 0x30, 0x1C, 0x92, 0x59, 0x3B, 0xAB, 0xA8,
+        0xC1, 0x16, 0x36, 0x96, 0x79, 0x39, 0x30, 0x15, 0x19, 0xC5, 0xA4, 0x87, 0x01, 0x19, 0xCE, 0xB1,
+        0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xCE, 0x01, 0x99, 0x79, 0x19, 0xC5, 0x15, 0x30, 0x39, 0x16,
+        0x36, 0xAA, 0x97, 0x2A, 0xC1, 0x3B, 0x0E, 0x1C, 0x30, 0x09, 0x19, 0xC0, 0x3E, 0x21, 0xAB, 0x97,
+        0xC2, 0x9D, 0x89, 0x31, 0x19, 0xE0, 0x68, 0x7E, 0xB3, 0xB6, 0x06, 0xC3, 0x96, 0x79, 0x8F, 0x6B,
+        0x09, 0x30, 0x01, 0x19, 0xC0, 0x21, 0x06, 0xAB, 0x97, 0xA6, 0x98, 0xC1, 0x30, 0xC0, 0x01, 0x19,
+        0xC5, 0x1D, 0x30, 0x25, 0x19, 0xCD, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xCD, 0x25, 0x30,
+        0x1D, 0x19, 0xC5, 0x01, 0x30, 0xC0, 0x2A, 0xC1, 0x2B, 0x95, 0x8A, 0x21, 0x19, 0xC0, 0x01, 0x30,
+        0x09, 0x06, 0x26, 0xAA, 0x97, 0xC3, 0x15, 0x21, 0x19, 0xE0, 0x6B, 0xA4, 0x87, 0xB2, 0xB6, 0x06,
+        0xC3, 0x98, 0x79, 0x22, 0x19, 0xC4, 0x09, 0xAA, 0x97, 0xA9, 0xA7, 0x30, 0xC0, 0x2A, 0x16, 0x97,
+        0x8A, 0x39, 0x99, 0x79, 0x19, 0xC1, 0xB3, 0xB6, 0x30, 0x8E, 0x59, 0x19, 0xC5, 0xB3, 0xB7, 0x9C,
+        0x88, 0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x2C, 0x14, 0x19, 0xC5, 0xA4,
+        0x87, 0x30, 0x0D, 0x19, 0xC1, 0x32, 0x39, 0x05, 0x16, 0x2A, 0x30, 0xC0, 0x3D, 0x29, 0x09, 0x19,
+        0xC4, 0x22, 0xB0, 0xA6, 0xA8, 0x97, 0xC3, 0x8F, 0x7B, 0x8E, 0x5A, 0x19, 0xE0, 0x6F, 0xA5, 0x97,
+        0x29, 0x06, 0xC3, 0x9D, 0x89, 0x91, 0x7A, 0x0E, 0x19, 0xC3, 0x34, 0x30, 0x14, 0xA5, 0x87, 0xA5,
+        0x98, 0xC2, 0x3A, 0x36, 0x3E, 0x30, 0x55, 0x19, 0xC5, 0xA3, 0x98, 0x30, 0x05, 0x19, 0xC4, 0xB1,
+        0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x05, 0x30, 0x35, 0x19, 0xC5, 0x21, 0x30, 0x3E, 0x36,
+        0xA7, 0x98, 0x2A, 0xC2, 0x3A, 0x14, 0x30, 0x34, 0x19, 0xC3, 0x0E, 0x1A, 0xAF, 0xA7, 0xA3, 0x98,
+        0xC3, 0x29, 0x02, 0x19, 0xE0, 0x73, 0xA4, 0x87, 0x1A, 0xB0, 0xA6, 0x06, 0xC3, 0x95, 0x7A, 0x1D,
+        0x19, 0xC1, 0x31, 0x30, 0x91, 0x6A, 0x19, 0x3A, 0xA8, 0x97, 0x12, 0xA8, 0x87, 0x7F, 0xC0, 0x16,
+        0x30, 0x6E, 0x41, 0x9A, 0x89, 0x39, 0x09, 0x9C, 0x78, 0x19, 0xC0, 0xA6, 0x97, 0x30, 0x31, 0x19,
+        0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x31, 0x30, 0x11, 0x19, 0xC0, 0x1E, 0x09,
+        0x39, 0x29, 0xA6, 0x87, 0x35, 0x30, 0x16, 0x2A, 0xC0, 0x1B, 0x12, 0x98, 0x79, 0x98, 0x79, 0x19,
+        0x1D, 0x30, 0x31, 0x19, 0xC1, 0xAE, 0xA6, 0xAE, 0x96, 0xAB, 0xA7, 0xC3, 0x32, 0x1A, 0x3A, 0x19,
+        0xE0, 0x77, 0x7E, 0xB0, 0xA6, 0xB0, 0x96, 0x06, 0xC3, 0x32, 0x93, 0x7A, 0x01, 0x51, 0x24, 0x19,
+        0xC4, 0xA6, 0x87, 0xA7, 0xA8, 0xA8, 0x87, 0x30, 0xA3, 0x88, 0x2A, 0xC3, 0x9D, 0x89, 0x9C, 0x88,
+        0x14, 0x30, 0x05, 0x97, 0x79, 0x51, 0x52, 0x51, 0x55, 0x56, 0xB0, 0xD7, 0xB1, 0xD8, 0xC1, 0x06,
+        0x1E, 0x26, 0x35, 0x09, 0x16, 0x2A, 0x05, 0x30, 0x14, 0xA3, 0x87, 0x0E, 0xA3, 0x98, 0xC3, 0x9C,
+        0x89, 0x30, 0x45, 0x15, 0x99, 0x79, 0x19, 0xC4, 0x24, 0x2D, 0x01, 0x36, 0x32, 0xA2, 0x88, 0xC3,
+        0x9A, 0x79, 0x39, 0x21, 0x19, 0xE0, 0x7C, 0xAC, 0x96, 0x0A, 0xAD, 0xA7, 0xC4, 0x9D, 0x99, 0x36,
+        0x94, 0x7A, 0x95, 0x6A, 0x19, 0xC4, 0x2C, 0x30, 0x93, 0x79, 0x5A, 0xA5, 0x98, 0xA5, 0x98, 0xA5,
+        0x98, 0xA4, 0x98, 0x6E, 0xC0, 0x9C, 0x89, 0x30, 0x09, 0x2A, 0xC4, 0xA2, 0xC9, 0xA3, 0xB9, 0xC1,
+        0x11, 0x2A, 0xC4, 0x09, 0x30, 0x09, 0x2A, 0xC0, 0x25, 0x9C, 0x78, 0x0A, 0x1A, 0x9B, 0x89, 0x2D,
+        0x30, 0x2C, 0x19, 0xC4, 0x1E, 0xAB, 0xB7, 0x36, 0xAC, 0xA7, 0x06, 0xC4, 0x93, 0x7A, 0x92, 0x6A,
+        0x19, 0xE0, 0x81, 0xA4, 0x87, 0xAE, 0xA6, 0xAE, 0xA6, 0xA7, 0x98, 0xC5, 0x95, 0x7A, 0x39, 0x16,
+        0x19, 0xC1, 0x0D, 0x30, 0x8C, 0x5A, 0x19, 0xC3, 0x35, 0x16, 0xAA, 0xA8, 0x30, 0x9D, 0x78, 0xC0,
+        0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0x1B, 0x11, 0xA3, 0xB9, 0xC1, 0x11, 0x1B, 0x0E, 0x02,
+        0x35, 0x21, 0x0A, 0xC0, 0x30, 0x00, 0x16, 0x9C, 0x89, 0x19, 0xC3, 0x2D, 0x30, 0x0D, 0x19, 0xC1,
+        0x16, 0x39, 0x1E, 0x06, 0xC5, 0x99, 0x89, 0x3E, 0x92, 0x6A, 0x19, 0xE0, 0x86, 0xA8, 0x97, 0xAD,
+        0xA6, 0xAC, 0xA7, 0x06, 0xC5, 0x9D, 0x89, 0x97, 0x79, 0x3E, 0x01, 0x16, 0x19, 0xC6, 0x2C, 0x30,
+        0x90, 0x69, 0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x11, 0x30, 0x2C, 0x19,
+        0xC6, 0x16, 0x01, 0x3E, 0x0F, 0x2A, 0xA3, 0x98, 0xC5, 0x9A, 0x89, 0x1A, 0x25, 0x19, 0xE0, 0x8C,
+        0x25, 0x12, 0xAB, 0xA7, 0x06, 0xC7, 0x02, 0x99, 0x7A, 0x3E, 0x01, 0x9A, 0x79, 0x19, 0xC1, 0x10,
+        0x1C, 0x35, 0x19, 0xC4, 0xB1, 0xD7, 0xB1, 0xD8, 0xC1, 0x06, 0x19, 0xC4, 0x35, 0x1C, 0x10, 0x19,
+        0xC1, 0x09, 0x01, 0x3E, 0x02, 0xA7, 0xA7, 0xA7, 0x98, 0xC7, 0x98, 0x79, 0x12, 0x25, 0x19, 0xE0,
+        0x92, 0xA4, 0x87, 0x22, 0xAA, 0x97, 0xAA, 0xA6, 0x06, 0xC8, 0x66, 0x9B, 0x79, 0x9B, 0x89, 0x36,
+        0x0D, 0x9D, 0x88, 0x9C, 0x79, 0x9D, 0x99, 0x16, 0x9D, 0x99, 0x46, 0x61, 0x37, 0xFF, 0xB0, 0xDC,
+        0xC1, 0x37, 0x21, 0x32, 0x3D, 0x16, 0x2D, 0x06, 0x2A, 0x0D, 0x36, 0x1E, 0x0E, 0x01, 0x6E, 0xC8,
+        0x9C, 0x88, 0x02, 0x22, 0x95, 0x7A, 0x19, 0xE0, 0x99, 0xA6, 0x87, 0x22, 0x36, 0xA8, 0x97, 0x06,
+        0xD1, 0x04, 0x3F, 0x04, 0x06, 0xD1, 0x02, 0x36, 0x22, 0x0E, 0x19, 0xE0, 0xA1, 0x6E, 0x25, 0x2A,
+        0xA6, 0x98, 0xA7, 0x97, 0xA6, 0x97, 0x06, 0xDB, 0x1E, 0x26, 0x29, 0x2A, 0x25, 0x99, 0x79, 0x19,
+        0xE0, 0xAB, 0x21, 0xA5, 0x98, 0xA5, 0x98, 0x2A, 0x12, 0x2E, 0x0F, 0x26, 0x02, 0xA2, 0x88, 0xA2,
+        0x88, 0x7E, 0x7F, 0x06, 0xC1, 0x01, 0x32, 0x2A, 0x16, 0x02, 0x26, 0x0F, 0x2E, 0x12, 0x9C, 0x88,
+        0x9B, 0x8A, 0x11, 0x21, 0x19, 0xFE, 0xFF, 0xE3, 0xD7,
+    };
+
+    inline constexpr Image dial_face = {240, 280, dial_face_q565, sizeof(dial_face_q565), 0x9D7653C5};
+
+} // namespace gfx::images
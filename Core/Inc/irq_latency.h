@@ -0,0 +1,42 @@
+/// @file    irq_latency.h
+/// @brief   interrupt entry-to-callback latency probes (DWT cycle counter)
+#ifndef __IRQ_LATENCY_H__
+#define __IRQ_LATENCY_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief place a function in ITCM when built with -DISR_IN_ITCM=ON
+#if defined(ISR_IN_ITCM)
+#define ITCM_FUNC __attribute__((section(".itcm_text"), noinline))
+#else
+#define ITCM_FUNC
+#endif
+
+typedef enum {
+    IRQ_PROBE_DMA1_STREAM0 = 0,     // handler entry -> HAL_DMA_IRQHandler return
+    IRQ_PROBE_SPI5,                 // handler entry -> HAL_SPI_TxCpltCallback
+    IRQ_PROBE_USART1,               // handler entry -> HAL_UART_RxCpltCallback
+    IRQ_PROBE_TIM6,                 // handler entry -> HAL_TIM_PeriodElapsedCallback
+    IRQ_PROBE_TIM7,                 // handler entry -> HAL_TIM_PeriodElapsedCallback
+    IRQ_PROBE_TE,                   // handler entry -> HAL_GPIO_EXTI_Callback (panel TE)
+    IRQ_PROBE_COUNT
+} IrqProbeId;
+
+/// @brief enable the DWT cycle counter and clear the statistics
+void irq_probe_init(void);
+/// @brief stamp the IRQ handler entry, first statement of the handler
+void irq_probe_enter(IrqProbeId id);
+/// @brief stamp the callback (or handler exit) and accumulate the elapsed cycles
+void irq_probe_reach(IrqProbeId id);
+/// @brief print min/avg/max cycles per probe over UART and restart the statistics
+void irq_probe_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IRQ_LATENCY_H__ */
@@ -0,0 +1,27 @@
+/// @file    mask.hpp
+#pragma once
+#include "surface.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    class Painter;
+
+    /// @brief  4 bpp run/literal coded alpha masks (glyph atlases, sprite cache)
+    /// @note   row-major over the mask box, codes may wrap rows. A code byte holds a
+    ///         2 bit type and count - 1 in the low 6 bits: 00 transparent run, 01 opaque
+    ///         run, 10 count literal alphas follow (two per byte, low nibble first).
+    ///         Opaque runs are drawn as filled spans, only the edges are blended.
+    namespace mask {
+
+        /// @brief  code the whole of a coverage view (e.g. a sub() of a canvas)
+        /// @return coded bytes, 0 when capacity is too small
+        uint32_t encode(const SurfaceA8& coverage, uint8_t* out, uint32_t capacity);
+
+        /// @brief draw a coded mask with its top-left corner at (x, y)
+        /// @param antialias false draws literal alphas of at least half solid, skips the rest
+        void draw(Painter& p, const uint8_t* data, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                  uint16_t color, uint8_t alpha = 255, bool antialias = true);
+
+    } // namespace mask
+} // namespace gfx
@@ -0,0 +1,97 @@
+/// @file    mem_test.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace test {
+
+    /// @brief one detected memory fault
+    struct MemFault {
+        uint32_t address;       // failing word address
+        uint32_t expected;
+        uint32_t actual;
+        uint32_t failing_bits;  // expected ^ actual
+        uint8_t  phase;         // MemTest::Phase in which the fault was found
+        uint8_t  element;       // March element index (0-5), 0 for bus tests
+    };
+
+    /// @brief incremental SDRAM self-test: data-bus walk, address-bus walk and March C-
+    /// @note  the whole March is split into chunks, so step() can be called from idle
+    ///        time while the application keeps running. The tested window is destroyed,
+    ///        it must not overlap frame buffers or any live data.
+    class MemTest {
+        public:
+            enum class Phase : uint8_t {
+                DataBus,
+                AddressBus,
+                March,
+                Done,
+            };
+
+            struct Config {
+                uint32_t base;          // window start, 32-byte aligned
+                uint32_t bytes;         // window size, multiple of chunk_bytes
+                uint32_t chunk_bytes;   // work done per step(), multiple of 32
+                bool use_mdma;          // generate write-only elements with MDMA
+            };
+
+            static constexpr uint32_t MAX_FAULTS {16};
+
+            explicit MemTest(const Config& cfg);
+
+            /// @brief  restart from the data-bus test, clears recorded faults
+            void restart();
+
+            /// @brief  process one chunk of work
+            /// @return true while work remains, false once the pass is complete
+            bool step();
+
+            /// @brief  run a whole pass in the foreground
+            /// @return number of faults found
+            uint32_t run_blocking();
+
+            bool is_done() const { return phase_ == Phase::Done; }
+            Phase phase() const { return phase_; }
+            uint8_t progress_percent() const;
+
+            /// @brief total faults detected (may exceed MAX_FAULTS)
+            uint32_t fault_count() const { return fault_count_; }
+            /// @brief recorded fault i, i < min(fault_count(), MAX_FAULTS)
+            const MemFault& fault(uint32_t i) const { return faults_[i]; }
+            /// @brief OR of the failing bits of every fault
+            uint32_t failing_bits() const { return failing_bits_; }
+            /// @brief failing_bits() folded onto the 16 FMC data lines (DQ0-DQ15)
+            uint16_t failing_dq_lines() const {
+                return (uint16_t)((failing_bits_ & 0xFFFF) | (failing_bits_ >> 16));
+            }
+            uint32_t passes_completed() const { return passes_; }
+
+            /// @brief print a summary and the recorded faults over UART
+            void print_report() const;
+
+        private:
+            void test_data_bus();
+            void test_address_bus();
+            bool march_chunk();
+            bool mdma_fill_start(uint32_t addr, uint32_t bytes, uint32_t pattern);
+            bool mdma_busy();
+            void record(uint32_t addr, uint32_t expected, uint32_t actual);
+
+            Config cfg_;
+            Phase phase_;
+            uint8_t element_;           // current March element (0-5)
+            uint32_t chunk_;            // chunks done in the current element
+            uint32_t chunk_count_;
+            bool mdma_pending_;
+            bool mdma_ready_;
+
+            uint32_t fault_count_;
+            uint32_t failing_bits_;
+            uint32_t passes_;
+            MemFault faults_[MAX_FAULTS];
+
+            MDMA_HandleTypeDef hmdma_;
+            uint32_t fill_word_;        // MDMA source for pattern fills
+    };
+
+} // namespace test
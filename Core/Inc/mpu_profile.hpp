@@ -0,0 +1,96 @@
+/// @file    mpu_profile.hpp
+/// @brief   build-time MPU memory-attribute profile (set MPU_PROFILE in CMake)
+#pragma once
+#include "main.hpp"
+#include "sdram_map.hpp"
+#include <cstdint>
+
+/// @brief place a small DMA buffer in D2 SRAM (non-cacheable unless profile is WRITEBACK)
+#define DMA_SRAM __attribute__((section(".dma_sram"), aligned(32)))
+/// @brief place a buffer in AXI SRAM (D1), always write-back cacheable
+#define AXI_SRAM __attribute__((section(".axi_sram"), aligned(32)))
+
+namespace mpu {
+
+    enum class Profile : uint8_t {
+        WriteBack,                  // everything write-back, drivers clean before DMA
+        FramebufferWriteThrough,    // frame buffers write-through, D2 SRAM non-cacheable
+        FramebufferNonCacheable,    // frame buffers and D2 SRAM non-cacheable
+    };
+
+#if defined(MPU_PROFILE_FB_WRITETHROUGH)
+    constexpr Profile PROFILE {Profile::FramebufferWriteThrough};
+#elif defined(MPU_PROFILE_FB_NONCACHEABLE)
+    constexpr Profile PROFILE {Profile::FramebufferNonCacheable};
+#else
+    constexpr Profile PROFILE {Profile::WriteBack};
+#endif
+
+    /// @brief SDRAM window holding the frame area of sdram_map: frames, static dial and hand canvas
+    constexpr uint32_t FRAMEBUFFER_BASE {sdram_map::BASE};
+    constexpr uint32_t FRAMEBUFFER_SIZE {sdram_map::FRAME_AREA_END - sdram_map::BASE};
+    /// @brief D2 SRAM1-3 (128 + 128 + 32 KB), home of the .dma_sram section
+    /// @note  the MPU region rounds this up to 512 KB; the space above is unmapped
+    constexpr uint32_t DMA_SRAM_BASE {0x30000000};
+    constexpr uint32_t DMA_SRAM_SIZE {288 * 1024};
+
+    /// @brief MPU regions are naturally aligned powers of two: the smallest one holding bytes
+    constexpr uint32_t region_bytes(uint32_t bytes) {
+        uint32_t size = 32;
+        while (size < bytes) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    /// @brief the MPU_REGION_SIZE_xxx encoding of region_bytes(), log2(size) - 1
+    constexpr uint8_t region_size(uint32_t bytes) {
+        uint8_t log2 = 0;
+        for (uint32_t size = region_bytes(bytes); size > 1; size >>= 1) {
+            log2++;
+        }
+        return log2 - 1;
+    }
+
+    /// @brief SubRegionDisable mask that trims the region to the eighths covering bytes
+    /// @note  subregions need a region of 256 bytes or more
+    constexpr uint8_t subregions_disabled(uint32_t bytes) {
+        const uint32_t eighth = region_bytes(bytes) / 8;
+        return (uint8_t)(0xFF << ((bytes + eighth - 1) / eighth));
+    }
+
+    static_assert(FRAMEBUFFER_BASE % region_bytes(FRAMEBUFFER_SIZE) == 0,
+                  "frame-buffer window must be aligned to its MPU region size");
+
+    constexpr const char* profile_name(Profile profile) {
+        return profile == Profile::FramebufferWriteThrough ? "fb-write-through"
+             : profile == Profile::FramebufferNonCacheable ? "fb-non-cacheable"
+             : "write-back";
+    }
+
+    constexpr const char* profile_name() {
+        return profile_name(PROFILE);
+    }
+
+    /// @brief  reprogram the frame-buffer window (MPU region 2) for a profile at run time
+    /// @note   cleans and invalidates the window first; no DMA may use it meanwhile, and
+    ///         is_dma_coherent() keeps answering for the build-time PROFILE
+    void set_framebuffer_profile(Profile profile);
+
+    /// @brief  true when DMA reads of the range see CPU writes without a cache clean
+    constexpr bool is_dma_coherent(uint32_t addr, uint32_t bytes) {
+        if (PROFILE == Profile::WriteBack) {
+            return false;
+        }
+        return (addr >= FRAMEBUFFER_BASE && addr + bytes <= FRAMEBUFFER_BASE + FRAMEBUFFER_SIZE)
+            || (addr >= DMA_SRAM_BASE && addr + bytes <= DMA_SRAM_BASE + DMA_SRAM_SIZE);
+    }
+
+    /// @brief  write back a range before a DMA hand-off, a no-op for coherent regions
+    inline void clean_for_dma(const void* p, uint32_t bytes) {
+        if (!is_dma_coherent((uint32_t)p, bytes)) {
+            SCB_CleanDCache_by_Addr((uint32_t*)p, (int32_t)bytes);
+        }
+    }
+
+} // namespace mpu
@@ -0,0 +1,56 @@
+/// @file    palette.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief  up to 256 RGB565 colours for 8 bpp indexed frames (SurfaceI8)
+    /// @note   built once: exact colours first (an image's own colours, UI colours),
+    ///         then precomputed ramps between pairs of them so antialiased edges and
+    ///         alpha blends land on a real entry. build_inverse() fills a 64 KB
+    ///         RGB565 -> index table, after which quantizing a composed line is one
+    ///         lookup per pixel. colors() is the LUT the display expands at scanout.
+    class Palette {
+        public:
+            static constexpr uint16_t MAX_COLORS {256};
+            static constexpr uint32_t INVERSE_BYTES {65536};
+
+            Palette();
+
+            uint16_t size() const { return size_; }
+            const uint16_t* colors() const { return colors_; }
+            uint16_t color(uint8_t index) const { return colors_[index]; }
+
+            /// @brief  add a colour, an exact duplicate returns the existing entry
+            /// @return index, -1 when the palette is full
+            int16_t add(uint16_t color);
+
+            /// @brief  add the steps - 1 blends from a to b (both included when missing)
+            /// @return false when the palette ran full
+            bool add_ramp(uint16_t from, uint16_t to, uint8_t steps);
+
+            /// @brief  add the distinct colours of an RGB565 image, at most max_new of them
+            /// @return colours added
+            uint16_t add_image(const uint16_t* pixels, uint32_t count, uint16_t max_new);
+
+            /// @brief  fill the nearest-entry table and use it for index_of() / quantize()
+            /// @param  table INVERSE_BYTES bytes, kept by the palette
+            void build_inverse(uint8_t* table);
+            bool ready() const { return inverse_ != nullptr; }
+
+            uint8_t index_of(uint16_t color) const { return inverse_[color]; }
+            /// @brief RGB565 -> indices through the inverse table
+            void quantize(uint8_t* dst, const uint16_t* src, uint32_t n) const;
+            /// @brief indices -> RGB565 through a LUT (scanout)
+            static void expand(uint16_t* dst, const uint8_t* src, uint32_t n, const uint16_t* lut);
+
+        private:
+            uint8_t nearest(uint16_t color) const;
+
+            uint16_t colors_[MAX_COLORS];
+            uint16_t size_;
+            const uint8_t* inverse_;
+    };
+
+} // namespace gfx
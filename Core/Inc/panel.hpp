@@ -0,0 +1,85 @@
+/// @file    panel.hpp
+#pragma once
+#include <cstdint>
+
+namespace lcd {
+
+    /// @brief 初始化序列中的一条命令：命令字、参数、执行后的延时
+    struct InitCmd {
+        uint8_t cmd;
+        uint8_t len;
+        uint8_t data[14];
+        uint16_t delay_ms;
+    };
+
+    /// @brief  面板描述符（编译期常量）：分辨率、显存偏移、MADCTL/COLMOD、初始化序列和刷新时序
+    /// @note   DMA分块由几何尺寸在编译期算出：HAL一次最多发送65535个数据项，
+    ///         一帧均分成最少的块数，最后一块可以更短。
+    ///         刷新时序给帧节拍用：一场扫描scan_lines行（显存行 + 前后肩），TE（V-blank模式）
+    ///         上升沿之后blank_lines行开始扫描显存第0行，按显存行号自上而下
+    struct Panel {
+        static constexpr uint32_t DMA_MAX_ITEMS {65535};
+
+        uint16_t width;
+        uint16_t height;
+        uint16_t x_offset;      // 可见区域在控制器显存中的起点
+        uint16_t y_offset;
+        uint8_t madctl;         // 0x36 扫描方向 / RGB顺序
+        uint8_t colmod;         // 0x3A 像素格式，0x05 = RGB565
+        const InitCmd* init;    // 复位后、MADCTL/COLMOD之外的命令
+        uint8_t init_count;
+        uint32_t frame_us;      // 一场扫描的时间（由PORCTRL/FRCTRL2决定）
+        uint16_t scan_lines;    // 一场的总行数
+        uint16_t blank_lines;   // TE上升沿到第0行的行数
+
+        constexpr uint32_t pixels() const { return (uint32_t)width * height; }
+        constexpr uint8_t dma_chunks() const { return (uint8_t)((pixels() + DMA_MAX_ITEMS - 1) / DMA_MAX_ITEMS); }
+        constexpr uint16_t dma_chunk() const { return (uint16_t)((pixels() + dma_chunks() - 1) / dma_chunks()); }
+    };
+
+    namespace panels {
+
+        // ST7789V 电源/伽马设置，最后开反色、TE输出（只在V-blank）、退出睡眠、开显示
+        inline constexpr InitCmd st7789_init[] = {
+            {0xB2, 5, {0x0C, 0x0C, 0x00, 0x33, 0x33}, 0},
+            {0xB7, 1, {0x35}, 0},
+            {0xBB, 1, {0x19}, 0},
+            {0xC0, 1, {0x2C}, 0},
+            {0xC2, 1, {0x01}, 0},
+            {0xC3, 1, {0x12}, 0},
+            {0xC4, 1, {0x20}, 0},
+            {0xC6, 1, {0x0F}, 0},
+            {0xD0, 2, {0xA4, 0xA1}, 0},
+            {0xE0, 14, {0xD0, 0x04, 0x0D, 0x11, 0x13, 0x2B, 0x3F, 0x54, 0x4C, 0x18, 0x0D, 0x0B, 0x1F, 0x23}, 0},
+            {0xE1, 14, {0xD0, 0x04, 0x0C, 0x11, 0x13, 0x2C, 0x3F, 0x44, 0x51, 0x2F, 0x1F, 0x1F, 0x20, 0x23}, 0},
+            {0x21, 0, {}, 0},
+            {0x35, 1, {0x00}, 0},
+            {0x11, 0, {}, 120},
+            {0x29, 0, {}, 20},
+        };
+
+        // 上面的PORCTRL前后肩各12行、FRCTRL2 RTNA=0x0F：
+        // 10 MHz / ((320 + 12 + 12) * (250 + 0x0F * 16)) = 59.3 Hz，一场16856 us
+        constexpr uint32_t ST7789_FRAME_US {16856};
+        constexpr uint16_t ST7789_SCAN_LINES {320 + 12 + 12};
+        constexpr uint16_t ST7789_BLANK_LINES {12 + 12};
+
+        /// @brief 1.69" 240x280 圆角屏，控制器显存为240x320，可见区域从第20行开始
+        inline constexpr Panel st7789_240x280 {
+            240, 280, 0, 20, 0x00, 0x05,
+            st7789_init, sizeof(st7789_init) / sizeof(st7789_init[0]),
+            ST7789_FRAME_US, ST7789_SCAN_LINES, ST7789_BLANK_LINES,
+        };
+
+        /// @brief 1.3" / 1.54" 240x240 方屏
+        inline constexpr Panel st7789_240x240 {
+            240, 240, 0, 0, 0x00, 0x05,
+            st7789_init, sizeof(st7789_init) / sizeof(st7789_init[0]),
+            ST7789_FRAME_US, ST7789_SCAN_LINES, ST7789_BLANK_LINES,
+        };
+
+        static_assert(st7789_240x280.dma_chunks() == 2 && st7789_240x280.dma_chunk() == 33600);
+        static_assert(st7789_240x240.dma_chunks() == 1);
+
+    } // namespace panels
+} // namespace lcd
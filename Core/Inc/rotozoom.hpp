@@ -0,0 +1,71 @@
+/// @file    rotozoom.hpp
+#pragma once
+#include "scene.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief RGB565 source image with an optional A8 alpha plane of the same layout
+    struct Texture {
+        const uint16_t* pixels;
+        const uint8_t* alpha;   // nullptr: opaque
+        uint16_t width;
+        uint16_t height;
+        uint32_t stride;        // pixels (and alpha bytes) per row
+    };
+
+    enum class Sampling : uint8_t {
+        Nearest,
+        Bilinear,   // 5-bit weights, edge texels clamped
+    };
+
+    /// @brief texture point (pivot_x, pivot_y) lands on screen (x, y), rotated clockwise
+    ///        by degrees and scaled uniformly around it
+    struct Affine {
+        float x;
+        float y;
+        float pivot_x;
+        float pivot_y;
+        float degrees;
+        float scale;
+    };
+
+    /// @brief screen bounding box of a transformed texture
+    Rect rotozoom_bounds(const Texture& tex, const Affine& xf);
+
+    /// @brief  rotate / scale a texture into a painter (canvas or RGB565 frame)
+    /// @note   inverse mapping in 16.16 fixed point: every scanline solves the exact
+    ///         column range whose samples fall inside the texture and the clip, so the
+    ///         inner loops only step (u, v) and fetch. Spans go out through
+    ///         Painter::put_span. Texel centres sit on integer coordinates like pixels.
+    /// @return pixels written
+    uint32_t rotozoom(Painter& p, const Texture& tex, const Affine& xf,
+                      Sampling sampling = Sampling::Nearest, uint8_t alpha = 255);
+
+    /// @brief rotated / scaled texture, the pivot texel at the node position
+    /// @note  keeps a copy of the Texture descriptor, only the pixel and alpha
+    ///        planes it points to must outlive the node
+    class TextureNode : public Node {
+        public:
+            TextureNode(const Texture& texture, float pivot_x, float pivot_y,
+                        Sampling sampling = Sampling::Nearest);
+
+            void set_scale(float scale);
+            void set_sampling(Sampling sampling);
+            /// @brief swap the texture (e.g. a new frame), always dirty
+            void set_texture(const Texture& texture);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            Affine affine() const;
+
+            Texture texture_;
+            float pivot_x_;
+            float pivot_y_;
+            float scale_;
+            Sampling sampling_;
+    };
+
+} // namespace gfx
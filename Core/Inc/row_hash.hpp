@@ -0,0 +1,55 @@
+/// @file    row_hash.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+/// @brief  per-scanline hashes of the last frame sent to a panel, for delta updates
+/// @note   diff() hashes every row of a full frame with the CRC unit (CRC-32, the reset
+///         configuration), compares against the hashes kept from the previous call and
+///         reports the changed rows as spans of consecutive rows. Rows are hashed from the
+///         CPU side, so the frame does not need cleaning first. Two different rows with the
+///         same CRC-32 are taken as equal; at one row in 2^32 this is accepted.
+///         Anything that writes the panel behind its back must call invalidate().
+class RowHash {
+    public:
+        static constexpr uint16_t MAX_ROWS {320};
+
+        /// @brief changed rows y0..y1, inclusive
+        struct Span {
+            uint16_t y0;
+            uint16_t y1;
+        };
+
+        RowHash();
+
+        /// @brief  hash a frame and list the rows that differ from the previous one
+        /// @param  frame  width * height RGB565 pixels, rows packed
+        /// @param  spans  receives up to max_spans spans; when there are more runs, the
+        ///                ones closest together are merged (sending the rows between them)
+        /// @return number of spans, 0 when the frame is unchanged
+        /// @note   without valid previous hashes (first frame, invalidate(), a frame taller
+        ///         than MAX_ROWS) the whole frame is one span
+        uint8_t diff(const uint16_t* frame, uint16_t width, uint16_t height, Span* spans, uint8_t max_spans);
+
+        /// @brief forget the previous frame, the next diff() reports every row
+        void invalidate() { valid_ = false; }
+
+        /// @brief rows whose hash changed in the last diff()
+        uint16_t last_rows_changed() const { return last_changed_; }
+        /// @brief rows covered by the spans of the last diff() (changed rows plus merged gaps)
+        uint16_t last_rows_sent() const { return last_sent_; }
+        /// @brief CPU cycles spent in the last diff()
+        uint32_t last_hash_cycles() const { return last_cycles_; }
+
+    private:
+        static uint32_t crc_row(const uint16_t* row, uint16_t width);
+        static uint8_t add_span(Span* spans, uint8_t count, uint8_t max_spans, uint16_t y0, uint16_t y1);
+
+        uint32_t hashes_[MAX_ROWS];
+        uint16_t rows_;         // rows in hashes_, 0 when invalid
+        uint16_t width_;
+        bool valid_;
+        uint16_t last_changed_;
+        uint16_t last_sent_;
+        uint32_t last_cycles_;
+};
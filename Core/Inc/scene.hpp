@@ -0,0 +1,256 @@
+/// @file    scene.hpp
+#pragma once
+#include "compositor.hpp"
+#include "font.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief  clipped pixel writer for node rendering
+    /// @note   with a coverage plane it writes a CanvasLayer (colour + coverage, blended
+    ///         later by the compositor); without one it blends straight into RGB565.
+    ///         Spans are clipped once; rasterizers that already clipped their box to
+    ///         clip() use blend() and skip the per-pixel test of plot().
+    class Painter {
+        public:
+            /// @param clip screen rectangle, nothing outside it (or the target clip) is written
+            Painter(const Surface565& target, const Rect& clip);
+            /// @param coverage same geometry as target
+            Painter(const Surface565& target, const SurfaceA8& coverage, const Rect& clip);
+
+            const Rect& clip() const { return target_.clip(); }
+
+            /// @brief draw one screen pixel with coverage alpha
+            void plot(int16_t x, int16_t y, uint16_t color, uint8_t alpha) {
+                const Rect& c = target_.clip();
+                if (x >= c.x && y >= c.y && x < c.right() && y < c.bottom()) {
+                    blend(x, y, color, alpha);
+                }
+            }
+            /// @brief plot() for a pixel known to lie inside clip()
+            void blend(int16_t x, int16_t y, uint16_t color, uint8_t alpha);
+            /// @brief draw screen row y, columns [x0, x1)
+            void fill_span(int16_t y, int16_t x0, int16_t x1, uint16_t color, uint8_t alpha);
+            /// @brief draw screen row y, columns [x0, x1) from per-pixel colours and
+            ///        alphas (nullptr: all opaque), clipped once for the whole span
+            void put_span(int16_t y, int16_t x0, int16_t x1, const uint16_t* colors, const uint8_t* alphas);
+
+        private:
+            Surface565 target_;     // clip narrowed to the painter clip
+            uint8_t* coverage_;     // indexed like target_, nullptr without a coverage plane
+    };
+
+    /// @brief  retained drawable: transform, colour, alpha, cached bounds and dirty flag
+    /// @note   geometry is given in local coordinates around the position, rotation is
+    ///         clockwise in degrees (0 keeps local "up" pointing up). Setters only mark
+    ///         the node dirty when the value actually changes, so an unchanged scene
+    ///         produces no damage.
+    class Node {
+        public:
+            explicit Node(uint16_t color);
+            virtual ~Node() = default;
+
+            void set_position(int16_t x, int16_t y);
+            void set_rotation(float degrees);
+            void set_color(uint16_t color);
+            void set_alpha(uint8_t alpha);
+            void set_visible(bool visible);
+            /// @brief  edges blended by coverage (default); off draws pixels at least half
+            ///         covered solid and skips the rest, cheaper but jagged
+            /// @note   honoured by capsules, lines, circles and sprites
+            void set_antialias(bool on);
+
+            int16_t x() const { return x_; }
+            int16_t y() const { return y_; }
+            float rotation() const { return angle_; }
+            uint16_t color() const { return color_; }
+            uint8_t alpha() const { return alpha_; }
+            bool visible() const { return visible_ && alpha_ != 0; }
+            bool antialias() const { return antialias_; }
+            bool dirty() const { return dirty_; }
+
+            /// @brief screen area covered when last drawn by a Scene
+            const Rect& bounds() const { return bounds_; }
+
+            /// @brief screen bounding box of the current state
+            virtual Rect extent() const = 0;
+            /// @brief rasterize into the painter (clipped by it)
+            virtual void render(Painter& p) const = 0;
+
+        protected:
+            void invalidate() { dirty_ = true; }
+            /// @brief angle actually stored by set_rotation(), e.g. snapped to a cached step
+            virtual float snap_rotation(float degrees) const { return degrees; }
+            /// @brief local -> screen
+            void to_screen(float lx, float ly, float& sx, float& sy) const;
+
+        private:
+            friend class Scene;
+
+            int16_t x_;
+            int16_t y_;
+            float angle_;
+            float cos_;
+            float sin_;
+            uint16_t color_;
+            uint8_t alpha_;
+            bool visible_;
+            bool antialias_;
+            bool dirty_;
+            Rect bounds_;
+            Node* next_;
+    };
+
+    /// @brief anti-aliased thick segment with round caps
+    class CapsuleNode : public Node {
+        public:
+            CapsuleNode(float x0, float y0, float x1, float y1, float width, uint16_t color);
+
+            void set_points(float x0, float y0, float x1, float y1);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            float x0_, y0_, x1_, y1_;
+            float radius_;
+    };
+
+    /// @brief 1 px anti-aliased line
+    class LineNode : public CapsuleNode {
+        public:
+            LineNode(float x0, float y0, float x1, float y1, uint16_t color)
+                : CapsuleNode(x0, y0, x1, y1, 1.0f, color) {}
+    };
+
+    /// @brief filled anti-aliased disc centred on the position
+    class CircleNode : public Node {
+        public:
+            CircleNode(float radius, uint16_t color);
+
+            void set_radius(float radius);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            float radius_;
+    };
+
+    /// @brief anti-aliased ring, outer edge at radius, centred on the position
+    class RingNode : public Node {
+        public:
+            RingNode(float radius, float thickness, uint16_t color);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        protected:
+            /// @brief true when the local direction (dx, dy) belongs to the shape
+            virtual bool covers(float dx, float dy) const;
+
+            float radius_;
+            float thickness_;
+    };
+
+    /// @brief part of a ring, start and sweep clockwise in degrees from "up"
+    class ArcNode : public RingNode {
+        public:
+            ArcNode(float radius, float thickness, float start, float sweep, uint16_t color);
+
+            void set_sweep(float sweep);
+
+        protected:
+            bool covers(float dx, float dy) const override;
+
+        private:
+            float start_;
+            float sweep_;
+    };
+
+    /// @brief axis-aligned filled rectangle, top-left at the position (rotation ignored)
+    class RectNode : public Node {
+        public:
+            RectNode(uint16_t w, uint16_t h, uint16_t color);
+
+            void set_size(uint16_t w, uint16_t h);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            uint16_t w_;
+            uint16_t h_;
+    };
+
+    /// @brief anti-aliased text with kerning, the pen at the position (top of the line)
+    /// @note  rotation ignored; the extent is the ink box of the glyphs
+    class TextNode : public Node {
+        public:
+            static constexpr uint8_t MAX_CHARS {24};
+
+            TextNode(const Font& font, const char* text, uint16_t color);
+
+            /// @brief replace the text, dirty only when it differs
+            void set_text(const char* text);
+            const char* text() const { return text_; }
+            const Font& font() const { return *font_; }
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            const Font* font_;
+            char text_[MAX_CHARS + 1];
+            uint8_t length_;
+    };
+
+    /// @brief RGB565 image, top-left at the position (rotation ignored, alpha applies)
+    class BitmapNode : public Node {
+        public:
+            BitmapNode(const uint16_t* pixels, uint16_t w, uint16_t h, uint32_t stride);
+
+            /// @brief swap the image (e.g. a new frame), always dirty
+            void set_pixels(const uint16_t* pixels);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        private:
+            const uint16_t* pixels_;
+            uint16_t w_;
+            uint16_t h_;
+            uint32_t stride_;
+    };
+
+    /// @brief  retained node list drawn into one CanvasLayer
+    /// @note   update() is the frame pass: every dirty node contributes its old and new
+    ///         bounds to the damage, then only the damaged rectangles of the canvas are
+    ///         cleared and re-rendered from all nodes intersecting them (in insertion
+    ///         order, later nodes on top) and handed to the compositor. Nodes are linked
+    ///         intrusively, the scene never allocates.
+    class Scene {
+        public:
+            Scene(CanvasLayer* canvas, Compositor* compositor);
+
+            /// @brief append a node on top of the existing ones
+            void add(Node* node);
+
+            /// @brief  re-render the damaged regions
+            /// @note   nodes live in canvas coordinates (CanvasLayer::area()), which are
+            ///         the screen halved on a half-resolution canvas
+            /// @return screen bounding box of the damage, empty when nothing changed
+            Rect update();
+
+            /// @brief node renders done by the last update()
+            uint16_t last_rendered() const { return last_rendered_; }
+
+        private:
+            CanvasLayer* canvas_;
+            Compositor* compositor_;
+            Node* head_;
+            Node* tail_;
+            uint16_t last_rendered_;
+    };
+
+} // namespace gfx
@@ -0,0 +1,34 @@
+/// @file    sdram_map.hpp
+/// @brief   how the applications share the 32 MB external SDRAM
+#pragma once
+#include <cstdint>
+
+/// @brief  ClockApp and DigitalClock use the same frame area at the bottom of the SDRAM:
+///         [0] frame | [1] frame | static dial | hand canvas RGB565 | hand canvas coverage (A8)
+///         Each slot holds one RGB565 frame; ClockApp's 8-bit index frames use the first half
+///         of theirs. The frame area is the MPU frame-buffer window (see mpu_profile.hpp).
+namespace sdram_map {
+
+    constexpr uint32_t BASE {0xC0000000};
+    constexpr uint32_t SIZE {32 * 1024 * 1024};
+    constexpr uint32_t FRAME_PIXELS {240 * 280};
+    constexpr uint32_t SLOT_BYTES {FRAME_PIXELS * 2};
+
+    constexpr uint32_t FRAME0 {BASE};
+    constexpr uint32_t FRAME1 {BASE + SLOT_BYTES};
+    constexpr uint32_t STATIC_DIAL {BASE + SLOT_BYTES * 2};
+    constexpr uint32_t HAND_PIXELS {BASE + SLOT_BYTES * 3};
+    constexpr uint32_t HAND_COVERAGE {BASE + SLOT_BYTES * 4};
+    constexpr uint32_t FRAME_AREA_END {HAND_COVERAGE + FRAME_PIXELS};
+
+    /// @brief ClockApp's pre-rendered hand sprites
+    constexpr uint32_t SPRITES {BASE + 0x00200000};
+    constexpr uint32_t SPRITES_END {BASE + 0x00300000};
+
+    /// @brief everything above the sprites is free for the background self-test
+    constexpr uint32_t SELF_TEST {SPRITES_END};
+    constexpr uint32_t SELF_TEST_SIZE {BASE + SIZE - SELF_TEST};
+
+    static_assert(FRAME_AREA_END <= SPRITES, "frame area overlaps the hand sprites");
+
+} // namespace sdram_map
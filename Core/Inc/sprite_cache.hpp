@@ -0,0 +1,75 @@
+/// @file    sprite_cache.hpp
+#pragma once
+#include "scene.hpp"
+#include <cstdint>
+
+namespace gfx {
+
+    /// @brief  one shape pre-rendered at N evenly spaced rotations
+    /// @note   build() rasterizes the node once per angle into a scratch canvas and
+    ///         keeps each coverage box as a 4 bpp run/literal mask (mask.hpp), so
+    ///         drawing a rotation is span fills plus edge blends, no trigonometry.
+    ///         Masks and their index share one caller-provided block; when the angle
+    ///         count does not fit the byte budget it is halved until it does.
+    class SpriteCache {
+        public:
+            static constexpr uint16_t MIN_ANGLES {60};
+
+            /// @param storage 4-byte aligned block of bytes for the index and the masks
+            SpriteCache(uint8_t* storage, uint32_t bytes);
+
+            /// @brief  pre-render shape around its position at up to angles rotations
+            /// @param  scratch transparent canvas containing the shape at every angle,
+            ///         left transparent again
+            /// @return false when not even MIN_ANGLES fit (the cache stays empty)
+            bool build(Node& shape, uint16_t angles, CanvasLayer& scratch);
+
+            bool ready() const { return angles_ != 0; }
+            uint16_t angles() const { return angles_; }
+            uint32_t bytes_used() const { return used_; }
+
+            /// @brief nearest cached rotation (degrees, clockwise)
+            float quantize(float degrees) const;
+            /// @brief screen box of the mask nearest to degrees with the pivot at (x, y)
+            Rect extent(int16_t x, int16_t y, float degrees) const;
+            void draw(Painter& p, int16_t x, int16_t y, float degrees, uint16_t color, uint8_t alpha,
+                      bool antialias = true) const;
+
+        private:
+            struct Entry {
+                int16_t x;          // box relative to the pivot
+                int16_t y;
+                uint16_t w;
+                uint16_t h;
+                uint32_t offset;    // into the mask data
+            };
+
+            bool try_build(Node& shape, uint16_t angles, CanvasLayer& scratch);
+            uint16_t index_of(float degrees) const;
+
+            uint8_t* storage_;
+            uint32_t capacity_;
+            Entry* entries_;
+            uint8_t* data_;
+            uint16_t angles_;
+            uint32_t used_;
+    };
+
+    /// @brief  scene node drawn from a SpriteCache in the node colour and alpha
+    /// @note   rotations snap to the cached step, so rotations that land on the same
+    ///         mask produce no damage
+    class SpriteNode : public Node {
+        public:
+            SpriteNode(const SpriteCache& cache, uint16_t color);
+
+            Rect extent() const override;
+            void render(Painter& p) const override;
+
+        protected:
+            float snap_rotation(float degrees) const override { return cache_->quantize(degrees); }
+
+        private:
+            const SpriteCache* cache_;
+    };
+
+} // namespace gfx
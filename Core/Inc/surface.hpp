@@ -0,0 +1,145 @@
+/// @file    surface.hpp
+#pragma once
+#include "main.hpp"
+#include "fastmem.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace gfx {
+
+    /// @brief screen rectangle, w == 0 or h == 0 means empty
+    struct Rect {
+        int16_t x;
+        int16_t y;
+        uint16_t w;
+        uint16_t h;
+
+        bool empty() const { return w == 0 || h == 0; }
+        int16_t right() const { return (int16_t)(x + w); }     // exclusive
+        int16_t bottom() const { return (int16_t)(y + h); }    // exclusive
+
+        /// @brief smallest rectangle containing both (an empty side is ignored)
+        Rect united(const Rect& o) const;
+        /// @brief overlap of both, empty when disjoint
+        Rect intersected(const Rect& o) const;
+        bool intersects(const Rect& o) const { return !intersected(o).empty(); }
+
+        /// @brief rectangle from inclusive corner coordinates, grown by pad on every side
+        static Rect from_points(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t pad = 0);
+    };
+
+    /// @brief pixel formats, one storage element per pixel
+    struct Rgb565 {
+        using Pixel = uint16_t;
+    };
+
+    struct A8 {
+        using Pixel = uint8_t;     // coverage / alpha
+    };
+
+    struct I8 {
+        using Pixel = uint8_t;     // index into a Palette
+    };
+
+    /// @brief  non-owning view of a strided pixel block placed on the screen
+    /// @note   bounds() is the screen rectangle the memory covers, so the same drawing
+    ///         code addresses a full SDRAM frame, a band buffer in AXI SRAM standing in
+    ///         for a few rows, or a cell inside a larger image with screen coordinates.
+    ///         sub() narrows the view without copying; clip() bounds every write.
+    template<typename Format>
+    class Surface {
+        public:
+            using Pixel = typename Format::Pixel;
+
+            Surface() : data_(nullptr), stride_(0), bounds_{0, 0, 0, 0}, clip_{0, 0, 0, 0} {}
+
+            /// @param data   pixel at the top-left of the bounds
+            /// @param stride line pitch in pixels
+            /// @param x/y    screen position of data[0]
+            Surface(Pixel* data, uint16_t width, uint16_t height, uint32_t stride, int16_t x = 0, int16_t y = 0)
+                : data_(data), stride_(stride), bounds_{x, y, width, height}, clip_{x, y, width, height} {}
+
+            Pixel* data() const { return data_; }
+            uint32_t stride() const { return stride_; }
+            uint16_t width() const { return bounds_.w; }
+            uint16_t height() const { return bounds_.h; }
+            const Rect& bounds() const { return bounds_; }
+            const Rect& clip() const { return clip_; }
+
+            /// @brief restrict writes to r, never beyond the bounds
+            void set_clip(const Rect& r) { clip_ = r.intersected(bounds_); }
+
+            /// @brief view of r (clipped to the bounds) on the same memory, screen coordinates kept
+            Surface sub(const Rect& r) const {
+                const Rect c = r.intersected(bounds_);
+                if (c.empty()) {
+                    return {};
+                }
+                Surface s(at(c.x, c.y), c.w, c.h, stride_, c.x, c.y);
+                s.set_clip(clip_);
+                return s;
+            }
+
+            /// @brief element offset of screen (x, y) from data()
+            int32_t offset(int16_t x, int16_t y) const {
+                return (int32_t)(y - bounds_.y) * (int32_t)stride_ + (x - bounds_.x);
+            }
+            /// @brief pixel at screen (x, y), unchecked
+            Pixel* at(int16_t x, int16_t y) const { return data_ + offset(x, y); }
+
+            /// @brief  clip row y, columns [x0, x1) once for a whole span
+            /// @return false when nothing of it is writable
+            bool clip_span(int16_t y, int16_t& x0, int16_t& x1) const {
+                if (y < clip_.y || y >= clip_.bottom()) {
+                    return false;
+                }
+                if (x0 < clip_.x) x0 = clip_.x;
+                if (x1 > clip_.right()) x1 = clip_.right();
+                return x0 < x1;
+            }
+
+            /// @brief fill the part of screen rectangle r inside the clip
+            void fill(const Rect& r, Pixel value) const {
+                const Rect c = r.intersected(clip_);
+                if (c.empty()) {
+                    return;
+                }
+                if constexpr (sizeof(Pixel) == 2) {
+                    fastmem::fill_rect16(at(c.x, c.y), stride_, c.w, c.h, value);
+                } else {
+                    Pixel* row = at(c.x, c.y);
+                    for (uint16_t y = 0; y < c.h; y++, row += stride_) {
+                        std::memset(row, value, c.w);
+                    }
+                }
+            }
+
+            /// @brief copy screen rectangle r from src, clipped to both
+            void copy(const Rect& r, const Surface<Format>& src) const {
+                const Rect c = r.intersected(clip_).intersected(src.bounds());
+                if (c.empty()) {
+                    return;
+                }
+                if constexpr (sizeof(Pixel) == 2) {
+                    fastmem::copy_rect16(at(c.x, c.y), stride_, src.at(c.x, c.y), src.stride(), c.w, c.h);
+                } else {
+                    Pixel* d = at(c.x, c.y);
+                    const Pixel* s = src.at(c.x, c.y);
+                    for (uint16_t y = 0; y < c.h; y++, d += stride_, s += src.stride()) {
+                        fastmem::copy(d, s, c.w);
+                    }
+                }
+            }
+
+        private:
+            Pixel* data_;
+            uint32_t stride_;
+            Rect bounds_;
+            Rect clip_;
+    };
+
+    using Surface565 = Surface<Rgb565>;
+    using SurfaceA8 = Surface<A8>;
+    using SurfaceI8 = Surface<I8>;
+
+} // namespace gfx
@@ -6,6 +6,7 @@ extern "C" {
     // 声明所有系统配置相关的函数
     void SystemClock_Config(void);
     void MPU_Config(void);
+    void ISR_Relocate(void);
     void Error_Handler(void);
 
     // assert_failed 通常在 main.h 中通过宏定义，但如果不在，也应在这里声明
@@ -0,0 +1,62 @@
+/// @file    timebase.hpp
+#pragma once
+#include "main.hpp"
+#include <cstdint>
+
+/// @brief  64-bit monotonic clock on the DWT cycle counter
+/// @note   CYCCNT is 32 bits and wraps every 2^32 / SystemCoreClock (8.9 s at 480 MHz);
+///         every read extends it with a wrap count, so some read must happen at least once
+///         per wrap. poll() from a periodic interrupt guarantees that. Nothing else may write
+///         CYCCNT, a reset would look like a wrap.
+///         Reads are a few instructions under PRIMASK and are safe from any context.
+///         Conversions use the SystemCoreClock captured by init()/calibrate(): a whole part
+///         plus a 32-bit binary fraction (rounded up, relative error below 2^-32), multiplies
+///         only, no division at run time.
+namespace timebase {
+
+    /// @brief  start the cycle counter (if needed) and calibrate; idempotent
+    void init();
+
+    /// @brief  recompute the conversions after a core clock change
+    void calibrate();
+
+    /// @brief  keep the wrap extension alive, call at least once per CYCCNT wrap
+    void poll();
+
+    /// @brief  core clock the conversions were derived from, in Hz
+    uint32_t frequency();
+
+    /// @brief  cycles since the counter was started, monotonic
+    uint64_t cycles();
+
+    uint64_t to_us(uint64_t cycles);
+    uint64_t to_ns(uint64_t cycles);
+    uint64_t from_us(uint64_t us);
+
+    inline uint64_t now_us() { return to_us(cycles()); }
+    inline uint64_t now_ns() { return to_ns(cycles()); }
+
+    /// @brief  spin until the given cycles() value
+    void wait_until(uint64_t at);
+
+    /// @brief  busy-wait delay
+    inline void delay_us(uint32_t us) { wait_until(cycles() + from_us(us)); }
+
+    /// @brief  point in time for timeouts and waits
+    class Deadline {
+        public:
+            static Deadline at(uint64_t cycles) { return Deadline(cycles); }
+            static Deadline after_us(uint64_t us) { return Deadline(timebase::cycles() + from_us(us)); }
+
+            bool expired() const { return timebase::cycles() >= at_; }
+            /// @brief 0 once expired
+            uint64_t remaining_us() const;
+            void wait() const { wait_until(at_); }
+            uint64_t cycles() const { return at_; }
+
+        private:
+            explicit Deadline(uint64_t at) : at_(at) {}
+            uint64_t at_;
+    };
+
+} // namespace timebase
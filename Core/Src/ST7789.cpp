@@ -1,54 +1,106 @@
 #include "ST7789.hpp"
 #include "uart.hpp"
+#include "mpu_profile.hpp"
+#include "fastmem.hpp"
+#include "irq_latency.h"
+#include "palette.hpp"
+#include "timebase.hpp"
 #include <stdio.h>
 #include <cstring>
 
-#define TFT_W 240
-#define TFT_H 280
-#define PIXEL_COUNT (TFT_W * TFT_H)
-
-// SDRAM 中的双缓冲
-#define FRAME_BUFFER_0 ((uint16_t*)0xC0000000)           // 帧缓冲 A
-#define FRAME_BUFFER_1 ((uint16_t*)(0xC0000000 + (PIXEL_COUNT * 2)))  // 帧缓冲 B
-
 // DC 引脚控制宏
 #define LCD_DC_Command  HAL_GPIO_WritePin(dc_port_, dc_pin_, GPIO_PIN_RESET)
 #define LCD_DC_Data     HAL_GPIO_WritePin(dc_port_, dc_pin_, GPIO_PIN_SET)
 
+// 8位索引元素的展开行缓冲：ST7789对象本身在DTCM里，DMA1访问不到，所以放在D2 SRAM
+// （.dma_sram段，按MPU配置不可缓存时展开后不用清理D-Cache）
+namespace {
+    DMA_SRAM uint16_t expand_lines[ST7789::MAX_PANELS][2][ST7789::EXPAND_PIXELS];
+}
+
+ST7789* ST7789::instances_[MAX_PANELS] = {};
+uint8_t ST7789::instance_count_ = 0;
+
 ST7789::ST7789(
+    const lcd::Panel& panel,
     SPI_HandleTypeDef* hspi,
     GPIO_TypeDef* dc_port, 
     uint16_t dc_pin,
     GPIO_TypeDef* bl_port, 
-    uint16_t bl_pin
+    uint16_t bl_pin,
+    uint16_t* fill_buffers
 ) :
+    panel_(panel),
     hspi_(hspi),
     dc_port_(dc_port),
     dc_pin_(dc_pin),
     bl_port_(bl_port),
     bl_pin_(bl_pin),
-    current_buffer_(FRAME_BUFFER_0),
+    fill_buffers_{fill_buffers, fill_buffers + panel.pixels()},
+    current_buffer_(fill_buffers),
     is_transmitting_(false),
-    dma_chunk_count_(0),
-    dma_next_ptr_(nullptr) {}
+    list_(),
+    list_count_(0),
+    list_idx_(0),
+    dma_next_ptr_(nullptr),
+    pixel_bytes_(2),
+    expand_{nullptr, nullptr},
+    expand_idx_(0),
+    expand_ready_(false),
+    dma_remaining_(0),
+    list_start_(0),
+    gap_start_(0),
+    list_stats_(),
+    last_stats_(),
+    dma_mode_max_(DmaMode::Burst),
+    dma_mode_(DmaMode::Halfword),
+    delta_mode_(false),
+    row_hash_(),
+    delta_stats_() {
+    // 注册到中断分发表（同一SPI句柄只允许一个实例），按槽位分配索引展开用的行缓冲；
+    // 超过MAX_PANELS时既收不到DMA完成回调也没有行缓冲，直接报错
+    if (instance_count_ >= MAX_PANELS) {
+        Error_Handler();
+    }
+    expand_[0] = expand_lines[instance_count_][0];
+    expand_[1] = expand_lines[instance_count_][1];
+    instances_[instance_count_++] = this;
+}
 
+ITCM_FUNC void ST7789::dispatch_tx_complete(SPI_HandleTypeDef* hspi) {
+    for (uint8_t i = 0; i < instance_count_; i++) {
+        if (instances_[i]->hspi_ == hspi) {
+            instances_[i]->dma_tx_cplt_callback();
+            return;
+        }
+    }
+}
+
+// HAL_SPI_Init()带HAL_GetTick超时，只在线程上下文调用；宽度没变时不重新初始化
 void ST7789::spi_set_datasize(uint16_t datasize) {
+    if (hspi_->Init.DataSize == datasize) {
+        return;
+    }
     hspi_->Init.DataSize = datasize;
     HAL_SPI_Init(hspi_);
 }
 
+// 链表发完后SPI停在16位模式（完成中断里不切换），8位命令写入前按需切回
 void ST7789::write_cmd(uint8_t cmd) {
+    spi_set_datasize(SPI_DATASIZE_8BIT);
     LCD_DC_Command;
     HAL_SPI_Transmit(hspi_, (uint8_t*)&cmd, 1, 100);
 }
 
 void ST7789::write_data_8bit(uint8_t data) {
+    spi_set_datasize(SPI_DATASIZE_8BIT);
     LCD_DC_Data;
     HAL_SPI_Transmit(hspi_, (uint8_t*)&data, 1, 100);
 }
 
 void ST7789::write_data_16bit(uint16_t data) {
     uint8_t buf[2];
+    spi_set_datasize(SPI_DATASIZE_8BIT);
     LCD_DC_Data;
     buf[0] = data >> 8;
     buf[1] = data & 0xFF;
@@ -56,18 +108,38 @@ void ST7789::write_data_16bit(uint16_t data) {
 }
 
 void ST7789::set_addr_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-    const uint16_t X_OFFSET = 0;
-    const uint16_t Y_OFFSET = 20;
-    
+    row_hash_.invalidate();     // 轮询写屏，增量模式下一帧整帧发送
     write_cmd(0x2A);
-    write_data_16bit(x1 + X_OFFSET);
-    write_data_16bit(x2 + X_OFFSET);
+    write_data_16bit(x1 + panel_.x_offset);
+    write_data_16bit(x2 + panel_.x_offset);
     write_cmd(0x2B);
-    write_data_16bit(y1 + Y_OFFSET);
-    write_data_16bit(y2 + Y_OFFSET);
+    write_data_16bit(y1 + panel_.y_offset);
+    write_data_16bit(y2 + panel_.y_offset);
     write_cmd(0x2C);
 }
 
+// 16位模式下设置窗口：命令字高字节为0x00（NOP），参数正好是16位的起止坐标，不用切换SPI宽度
+// 在DMA完成中断里轮询发送：共5个字（不到1us）。主机模式的SPI没有流控，TXP一定会就绪，
+// 所以不会卡住；中断里SysTick（优先级15）不走，HAL的超时参数在这里不起作用
+ITCM_FUNC void ST7789::set_window_16bit(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    const uint16_t caset = 0x2A;
+    const uint16_t raset = 0x2B;
+    const uint16_t ramwr = 0x2C;
+    const uint16_t cols[2] = {(uint16_t)(x1 + panel_.x_offset), (uint16_t)(x2 + panel_.x_offset)};
+    const uint16_t rows[2] = {(uint16_t)(y1 + panel_.y_offset), (uint16_t)(y2 + panel_.y_offset)};
+    LCD_DC_Command;
+    HAL_SPI_Transmit(hspi_, (uint8_t*)&caset, 1, 10);
+    LCD_DC_Data;
+    HAL_SPI_Transmit(hspi_, (uint8_t*)cols, 2, 10);
+    LCD_DC_Command;
+    HAL_SPI_Transmit(hspi_, (uint8_t*)&raset, 1, 10);
+    LCD_DC_Data;
+    HAL_SPI_Transmit(hspi_, (uint8_t*)rows, 2, 10);
+    LCD_DC_Command;
+    HAL_SPI_Transmit(hspi_, (uint8_t*)&ramwr, 1, 10);
+    LCD_DC_Data;
+}
+
 void ST7789::init_basic() {
     HAL_GPIO_WritePin(bl_port_, bl_pin_, GPIO_PIN_SET);
     HAL_Delay(10);
@@ -75,67 +147,19 @@ void ST7789::init_basic() {
     HAL_Delay(150);
     HAL_Delay(10);
     write_cmd(0x36);
-    write_data_8bit(0x00);
+    write_data_8bit(panel_.madctl);
     write_cmd(0x3A);
-    write_data_8bit(0x05);
-    write_cmd(0xB2);
-    write_data_8bit(0x0C);
-    write_data_8bit(0x0C);
-    write_data_8bit(0x00);
-    write_data_8bit(0x33);
-    write_data_8bit(0x33);
-    write_cmd(0xB7);
-    write_data_8bit(0x35);
-    write_cmd(0xBB);
-    write_data_8bit(0x19);
-    write_cmd(0xC0);
-    write_data_8bit(0x2C);
-    write_cmd(0xC2);
-    write_data_8bit(0x01);
-    write_cmd(0xC3);
-    write_data_8bit(0x12);
-    write_cmd(0xC4);
-    write_data_8bit(0x20);
-    write_cmd(0xC6);
-    write_data_8bit(0x0F);
-    write_cmd(0xD0);
-    write_data_8bit(0xA4);
-    write_data_8bit(0xA1);
-    write_cmd(0xE0);
-    write_data_8bit(0xD0);
-    write_data_8bit(0x04);
-    write_data_8bit(0x0D);
-    write_data_8bit(0x11);
-    write_data_8bit(0x13);
-    write_data_8bit(0x2B);
-    write_data_8bit(0x3F);
-    write_data_8bit(0x54);
-    write_data_8bit(0x4C);
-    write_data_8bit(0x18);
-    write_data_8bit(0x0D);
-    write_data_8bit(0x0B);
-    write_data_8bit(0x1F);
-    write_data_8bit(0x23);
-    write_cmd(0xE1);
-    write_data_8bit(0xD0);
-    write_data_8bit(0x04);
-    write_data_8bit(0x0C);
-    write_data_8bit(0x11);
-    write_data_8bit(0x13);
-    write_data_8bit(0x2C);
-    write_data_8bit(0x3F);
-    write_data_8bit(0x44);
-    write_data_8bit(0x51);
-    write_data_8bit(0x2F);
-    write_data_8bit(0x1F);
-    write_data_8bit(0x1F);
-    write_data_8bit(0x20);
-    write_data_8bit(0x23);
-    write_cmd(0x21);
-    write_cmd(0x11);
-    HAL_Delay(120);
-    write_cmd(0x29);
-    HAL_Delay(20);
+    write_data_8bit(panel_.colmod);
+    for (uint8_t i = 0; i < panel_.init_count; i++) {
+        const lcd::InitCmd& c = panel_.init[i];
+        write_cmd(c.cmd);
+        for (uint8_t k = 0; k < c.len; k++) {
+            write_data_8bit(c.data[k]);
+        }
+        if (c.delay_ms) {
+            HAL_Delay(c.delay_ms);
+        }
+    }
 }
 
 // ========== 双缓冲 + 同步版本 ==========
@@ -146,19 +170,15 @@ void ST7789::fill_screen(uint16_t color) {
     }
     
     // 获取要填充的缓冲区（与当前显示的不同）
-    uint16_t* fill_buffer = (current_buffer_ == FRAME_BUFFER_0) ? FRAME_BUFFER_1 : FRAME_BUFFER_0;
+    uint16_t* fill_buffer = (current_buffer_ == fill_buffers_[0]) ? fill_buffers_[1] : fill_buffers_[0];
     
-    // 1. 快速填充背缓冲（32 位写入）
-    uint32_t color32 = (color << 16) | color;
-    uint32_t* ptr32 = (uint32_t*)fill_buffer;
-    for (uint32_t i = 0; i < PIXEL_COUNT / 2; i++) {
-        ptr32[i] = color32;
-    }
+    // 1. 快速填充背缓冲（64 位写入）
+    fastmem::fill16(fill_buffer, color, panel_.pixels());
     
-    // 2. 清除 D-Cache
-    SCB_CleanInvalidateDCache_by_Addr((uint32_t*)fill_buffer, PIXEL_COUNT * 2);
+    // 2. 写回 D-Cache（只需clean，CPU不会读回DMA的数据）
+    mpu::clean_for_dma(fill_buffer, panel_.pixels() * 2);
     // 3. 设置显示窗口
-    set_addr_window(0, 0, TFT_W - 1, TFT_H - 1);
+    set_addr_window(0, 0, panel_.width - 1, panel_.height - 1);
     // 4. DC 切到数据模式
     LCD_DC_Data;
     HAL_Delay(1);
@@ -168,7 +188,7 @@ void ST7789::fill_screen(uint16_t color) {
     is_transmitting_ = true;
     // 7. 发送缓冲数据
     #define LARGE_CHUNK 4096
-    uint32_t remaining = PIXEL_COUNT;
+    uint32_t remaining = panel_.pixels();
     uint16_t* ptr = fill_buffer;
     
     while (remaining > 0) {
@@ -193,15 +213,15 @@ void ST7789::update_from_buffer(uint16_t* buffer) {
     }
     
     // 直接在SDRAM上做字节交换（原地修改）
-    for (uint32_t i = 0; i < PIXEL_COUNT; i++) {
+    for (uint32_t i = 0; i < panel_.pixels(); i++) {
         buffer[i] = __REV16(buffer[i]);  // 字节交换
     }
     
     // 清理D-Cache
-    SCB_CleanDCache_by_Addr((uint32_t*)buffer, PIXEL_COUNT * 2);
+    mpu::clean_for_dma(buffer, panel_.pixels() * 2);
     
     // 设置地址窗口
-    set_addr_window(0, 0, TFT_W - 1, TFT_H - 1);
+    set_addr_window(0, 0, panel_.width - 1, panel_.height - 1);
     LCD_DC_Data;
     HAL_Delay(1);
     
@@ -212,7 +232,7 @@ void ST7789::update_from_buffer(uint16_t* buffer) {
     
     // 使用轮询模式传输
     #define LARGE_CHUNK 4096
-    uint32_t remaining = PIXEL_COUNT;
+    uint32_t remaining = panel_.pixels();
     uint16_t* ptr = buffer;
     
     while (remaining > 0) {
@@ -225,7 +245,7 @@ void ST7789::update_from_buffer(uint16_t* buffer) {
     is_transmitting_ = false;
     
     // 恢复buffer的字节序（以便下次绘制）
-    for (uint32_t i = 0; i < PIXEL_COUNT; i++) {
+    for (uint32_t i = 0; i < panel_.pixels(); i++) {
         buffer[i] = __REV16(buffer[i]);
     }
     
@@ -239,55 +259,179 @@ void ST7789::fill_screen_dma(uint16_t color) {
         HAL_Delay(1);
     }
     
-    uint16_t* fill_buffer = (current_buffer_ == FRAME_BUFFER_0) ? FRAME_BUFFER_1 : FRAME_BUFFER_0;
+    uint16_t* fill_buffer = (current_buffer_ == fill_buffers_[0]) ? fill_buffers_[1] : fill_buffers_[0];
     
     // 填充缓冲区
-    uint32_t color32 = (color << 16) | color;
-    uint32_t* ptr32 = (uint32_t*)fill_buffer;
-    for (uint32_t i = 0; i < PIXEL_COUNT / 2; i++) {
-        ptr32[i] = color32;
-    }
+    fastmem::fill16(fill_buffer, color, panel_.pixels());
     
     // 清除D-Cache
-    SCB_CleanDCache_by_Addr((uint32_t*)fill_buffer, PIXEL_COUNT * 2);
-    
-    // 设置地址窗口
-    set_addr_window(0, 0, TFT_W - 1, TFT_H - 1);
-    LCD_DC_Data;
-    HAL_Delay(1);
+    mpu::clean_for_dma(fill_buffer, panel_.pixels() * 2);
+    start_frame_dma(fill_buffer);
+}
+
+// ========== 传输链表 ==========
+bool ST7789::transmit_list(const Transfer* list, uint8_t count) {
+    // 局部写屏后行哈希不再代表屏上内容
+    row_hash_.invalidate();
+    return start_list(list, count);
+}
+
+bool ST7789::start_list(const Transfer* list, uint8_t count) {
+    if (is_transmitting_ || count == 0 || count > MAX_TRANSFERS) {
+        return false;
+    }
+    list_stats_ = {0, 0, 0, count};
+    for (uint8_t i = 0; i < count; i++) {
+        if (list[i].count == 0) {
+            return false;   // 空元素不会产生DMA完成中断，链表会卡住
+        }
+        list_[i] = list[i];
+        list_stats_.pixels += list[i].count;
+    }
+    list_count_ = count;
+    list_idx_ = 0;
     
-    // 切换到16位模式
+    // 整条链表都在16位模式下发送（窗口命令也是）
     spi_set_datasize(SPI_DATASIZE_16BIT);
-    
     is_transmitting_ = true;
-    dma_chunk_count_ = 0;
-    
-    // 分成两个chunk传输
-    // 总共67200个像素 = 67200个halfword
-    // 每个chunk传输33600个halfword
-    uint16_t* ptr = fill_buffer;
-    uint32_t chunk_size = 33600;  // 半帧的halfword数量
-    dma_next_ptr_ = ptr + chunk_size;
+    list_start_ = DWT->CYCCNT;
+    gap_start_ = list_start_;
+    start_element();
+    return true;
+}
+
+ITCM_FUNC void ST7789::start_element() {
+    const Transfer& t = list_[list_idx_];
+    if (t.flags & TX_WINDOW) {
+        set_window_16bit(t.x0, t.y0, t.x1, t.y1);
+    }
+    dma_next_ptr_ = (const uint8_t*)t.src;
+    dma_remaining_ = t.count;
+    pixel_bytes_ = t.lut ? 1 : 2;
+    expand_ready_ = false;
+    send_chunk();
+}
+
+// 当前元素下一块的像素数：矩形每次一行，连续像素按分块大小（索引元素不超过行缓冲）
+ITCM_FUNC uint16_t ST7789::chunk_len() const {
+    const Transfer& t = list_[list_idx_];
+    uint32_t limit = panel_.dma_chunk();
+    if (t.stride != 0) {
+        limit = (uint32_t)(t.x1 - t.x0 + 1);
+    } else if (t.lut && limit > EXPAND_PIXELS) {
+        limit = EXPAND_PIXELS;
+    }
+    return (uint16_t)(dma_remaining_ < limit ? dma_remaining_ : limit);
+}
+
+ITCM_FUNC void ST7789::advance(uint16_t n) {
+    const Transfer& t = list_[list_idx_];
+    dma_next_ptr_ += (uint32_t)(t.stride != 0 ? t.stride : n) * pixel_bytes_;
+    dma_remaining_ -= n;
+}
+
+// 查表展开一块索引到行缓冲，并写回D-Cache供DMA读取（D2 SRAM不可缓存时为空操作）
+ITCM_FUNC void ST7789::expand_chunk(uint8_t buf, const uint8_t* ptr, uint16_t n) {
+    gfx::Palette::expand(expand_[buf], ptr, n, list_[list_idx_].lut);
+    mpu::clean_for_dma(expand_[buf], (n * 2 + 31) & ~31);
+}
+
+ITCM_FUNC void ST7789::send_chunk() {
+    const uint8_t* ptr = dma_next_ptr_;
+    const uint16_t n = chunk_len();
+    advance(n);
+    if (list_[list_idx_].lut == nullptr) {
+        dma_start((const uint16_t*)ptr, n);
+        return;
+    }
     
-    // 启动第一个chunk的DMA传输
-    HAL_SPI_Transmit_DMA(hspi_, (uint8_t*)ptr, chunk_size);
+    // 索引：发送已展开的行缓冲（元素的第一块在这里现展开），再趁DMA发送时展开下一块。
+    // 从transmit_list()（线程上下文）进来时，很短的一块可能在预展开结束前就发完，
+    // 所以关中断直到预展开完成，完成中断随后再处理
+    const uint8_t buf = expand_idx_;
+    if (!expand_ready_) {
+        expand_chunk(buf, ptr, n);
+    }
+    expand_idx_ ^= 1;
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    dma_start(expand_[buf], n);
+    expand_ready_ = dma_remaining_ > 0;
+    if (expand_ready_) {
+        expand_chunk(expand_idx_, dma_next_ptr_, chunk_len());
+    }
+    __set_PRIMASK(primask);
 }
 
-// DMA完成回调
-void ST7789::dma_tx_cplt_callback() {
-    if (dma_chunk_count_ == 0) {
-        // 第一个chunk完成，启动第二个
-        dma_chunk_count_++;
-        HAL_SPI_Transmit_DMA(hspi_, (uint8_t*)dma_next_ptr_, 33600);
+// 按源地址对齐和长度选DMA方式，只在方式变化时重新配置DMA流
+ITCM_FUNC void ST7789::dma_start(const uint16_t* ptr, uint16_t n) {
+    const uint32_t addr = (uint32_t)ptr;
+    DmaMode mode = DmaMode::Halfword;
+    if ((addr & 15) == 0 && (n & 7) == 0) {
+        mode = DmaMode::Burst;          // 4拍突发不会跨1KB边界
+    } else if ((addr & 3) == 0 && (n & 1) == 0) {
+        mode = DmaMode::Packed;
+    }
+    if (mode > dma_mode_max_) {
+        mode = dma_mode_max_;
+    }
+    if (mode != dma_mode_) {
+        dma_configure(mode);
+    }
+    // DMA空闲到此为止（完成中断可能在下一行返回前就到来，所以在启动前累加）
+    list_stats_.gap_cycles += DWT->CYCCNT - gap_start_;
+    HAL_SPI_Transmit_DMA(hspi_, (uint8_t*)ptr, n);
+}
+
+// 16位帧 + FIFO阈值2个数据：SPI的一次DMA请求正好是一个32位字，外设端写32位即自动打包两个像素
+// 在DMA完成中断里调用：流此时已停止（EN=0），直接改寄存器，不走带超时等待的HAL_DMA_Init()。
+// Init里的字段仍要同步，HAL_SPI_Transmit_DMA()按MemDataAlignment换算传输个数
+ITCM_FUNC void ST7789::dma_configure(DmaMode mode) {
+    DMA_HandleTypeDef* dma = hspi_->hdmatx;
+    if (mode == DmaMode::Halfword) {
+        dma->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+        dma->Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+        dma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        dma->Init.MemBurst = DMA_MBURST_SINGLE;
     } else {
-        // 全部完成
-        dma_chunk_count_ = 0;
-        is_transmitting_ = false;
-        current_buffer_ = (current_buffer_ == FRAME_BUFFER_0) ? FRAME_BUFFER_1 : FRAME_BUFFER_0;
-        
-        // 切回8位模式
-        spi_set_datasize(SPI_DATASIZE_8BIT);
+        dma->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+        dma->Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+        dma->Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+        dma->Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+        dma->Init.MemBurst = (mode == DmaMode::Burst) ? DMA_MBURST_INC4 : DMA_MBURST_SINGLE;
+    }
+    dma->Init.PeriphBurst = DMA_PBURST_SINGLE;
+    DMA_Stream_TypeDef* stream = (DMA_Stream_TypeDef*)dma->Instance;
+    MODIFY_REG(stream->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE | DMA_SxCR_MBURST | DMA_SxCR_PBURST,
+               dma->Init.PeriphDataAlignment | dma->Init.MemDataAlignment | dma->Init.MemBurst
+               | dma->Init.PeriphBurst);
+    stream->FCR = (mode == DmaMode::Halfword) ? 0 : (dma->Init.FIFOMode | dma->Init.FIFOThreshold);
+    dma_mode_ = mode;
+}
+
+void ST7789::set_dma_mode(DmaMode max) {
+    wait_idle();
+    dma_mode_max_ = max;
+}
+
+// DMA完成回调：同一元素的下一块 -> 下一个元素 -> 整条链表完成
+ITCM_FUNC void ST7789::dma_tx_cplt_callback() {
+    const uint32_t now = DWT->CYCCNT;
+    gap_start_ = now;
+    if (dma_remaining_ > 0) {
+        send_chunk();
+        return;
+    }
+    if (++list_idx_ < list_count_) {
+        start_element();
+        return;
     }
+    
+    // 全部完成
+    list_stats_.total_cycles = now - list_start_;
+    last_stats_ = list_stats_;
+    is_transmitting_ = false;
+    current_buffer_ = (current_buffer_ == fill_buffers_[0]) ? fill_buffers_[1] : fill_buffers_[0];
 }
 
 // ========== DMA传输外部framebuffer ==========
@@ -297,26 +441,68 @@ void ST7789::transmit_buffer_dma(uint16_t* buffer) {
     }
     
     // 清除D-Cache
-    SCB_CleanDCache_by_Addr((uint32_t*)buffer, PIXEL_COUNT * 2);
-    
-    // 设置地址窗口
-    set_addr_window(0, 0, TFT_W - 1, TFT_H - 1);
-    LCD_DC_Data;
-    HAL_Delay(1);
+    mpu::clean_for_dma(buffer, panel_.pixels() * 2);
+    start_frame_dma(buffer);
+}
+
+// ========== DMA传输DmaBuffer（只清理脏缓存行）==========
+void ST7789::transmit_buffer_dma(DmaBuffer& buffer) {
+    while (is_transmitting_) {
+        HAL_Delay(1);
+    }
     
-    // 切换到16位模式
-    spi_set_datasize(SPI_DATASIZE_16BIT);
+    // 只写回渲染时标记过的缓存行
+    buffer.clean();
+    start_frame_dma(buffer.data16());
+}
+
+// 整帧 = 一个全屏窗口的元素；增量模式下每段变化的行一个元素
+void ST7789::start_frame_dma(uint16_t* buffer) {
+    if (!delta_mode_) {
+        const Transfer frame = {0, 0, (uint16_t)(panel_.width - 1), (uint16_t)(panel_.height - 1),
+                                buffer, panel_.pixels(), 0, TX_WINDOW};
+        transmit_list(&frame, 1);
+        return;
+    }
     
-    is_transmitting_ = true;
-    dma_chunk_count_ = 0;
+    RowHash::Span spans[MAX_TRANSFERS];
+    const uint8_t count = row_hash_.diff(buffer, panel_.width, panel_.height, spans, MAX_TRANSFERS);
+    delta_stats_ = {row_hash_.last_rows_changed(), row_hash_.last_rows_sent(), count,
+                    (uint32_t)(panel_.height - row_hash_.last_rows_sent()) * panel_.width * 2,
+                    row_hash_.last_hash_cycles()};
+    if (count == 0) {
+        return;     // 屏上已经是这一帧：不发送
+    }
     
-    // 分成两个chunk传输
-    uint16_t* ptr = buffer;
-    uint32_t chunk_size = 33600;
-    dma_next_ptr_ = ptr + chunk_size;
+    Transfer list[MAX_TRANSFERS];
+    for (uint8_t i = 0; i < count; i++) {
+        const uint16_t rows = spans[i].y1 - spans[i].y0 + 1;
+        list[i] = {0, spans[i].y0, (uint16_t)(panel_.width - 1), spans[i].y1,
+                   buffer + (uint32_t)spans[i].y0 * panel_.width, (uint32_t)rows * panel_.width, 0, TX_WINDOW};
+    }
+    start_list(list, count);
+}
+
+void ST7789::set_delta_mode(bool on) {
+    wait_idle();
+    delta_mode_ = on;
+    row_hash_.invalidate();
+    delta_stats_ = {};
+}
+
+// ========== 局部刷新：链表里的元素指向buffer中的区域 ==========
+void ST7789::transmit_list_dma(DmaBuffer& buffer, const Transfer* list, uint8_t count) {
+    wait_idle();
     
-    // 启动第一个chunk的DMA传输
-    HAL_SPI_Transmit_DMA(hspi_, (uint8_t*)ptr, chunk_size);
+    // 只写回渲染时标记过的缓存行
+    buffer.clean();
+    transmit_list(list, count);
+}
+
+void ST7789::wait_idle() {
+    while (is_transmitting_) {
+        HAL_Delay(1);
+    }
 }
 
 void ST7789::display_test_colors() {
@@ -361,10 +547,11 @@ void ST7789::color_cycle_loop() {
     // 使用更高精度的色调值（0-3600，即0.1度精度）
     uint32_t hue_x10 = 0;  // 色调 × 10
     uint32_t frame_count = 0;
-    uint32_t last_fps_print = HAL_GetTick();
+    timebase::init();
+    uint64_t last_fps_print = timebase::cycles();
     
     while (1) {
-        uint32_t frame_start = HAL_GetTick();
+        uint64_t frame_start = timebase::cycles();
         
         // 改进的HSV到RGB转换，使用高精度计算获得更平滑的过渡
         // hue_x10: 0-3599 (0.1度精度)
@@ -398,8 +585,8 @@ void ST7789::color_cycle_loop() {
             fill_screen(color);
         }
         
-        uint32_t frame_end = HAL_GetTick();
-        uint32_t frame_time = frame_end - frame_start;
+        uint64_t frame_end = timebase::cycles();
+        uint32_t frame_time = (uint32_t)timebase::to_us(frame_end - frame_start);
         
         // 极慢增加色调（每帧0.1度），完全消除撕裂视觉
         hue_x10 += 5;  // 每帧增加0.1度 × N
@@ -409,11 +596,11 @@ void ST7789::color_cycle_loop() {
         
         frame_count++;
         
-        // 每5秒打印一次FPS统计
-        if (frame_end - last_fps_print >= 20000) {
-            uint32_t elapsed = frame_end - last_fps_print;
-            uint32_t fps_x10 = (frame_count * 10000) / elapsed;  // FPS * 10
-            printf("[FPS] %lu.%lu fps, frame_time=%lums, frames=%lu, hue=%lu.%lu\r\n", 
+        // 每20秒打印一次FPS统计
+        if (frame_end - last_fps_print >= timebase::from_us(20000000)) {
+            uint64_t elapsed_us = timebase::to_us(frame_end - last_fps_print);
+            uint32_t fps_x10 = (uint32_t)((uint64_t)frame_count * 10000000 / elapsed_us);  // FPS * 10
+            printf("[FPS] %lu.%lu fps, frame_time=%luus, frames=%lu, hue=%lu.%lu\r\n", 
                    (unsigned long)(fps_x10 / 10), 
                    (unsigned long)(fps_x10 % 10),
                    (unsigned long)frame_time,
@@ -433,8 +620,11 @@ void ST7789::clock_color_display() {
     uint8_t minutes = 30;
     uint8_t seconds = 45;
     
-    uint32_t last_update = HAL_GetTick();
-    uint32_t last_print = HAL_GetTick();
+    // 秒节拍和打印间隔按时基计时
+    timebase::init();
+    const uint64_t second = timebase::from_us(1000000);
+    uint64_t last_update = timebase::cycles();
+    uint64_t last_print = last_update;
     
     printf("[CLOCK] Color Clock Started!\r\n");
     printf("[CLOCK] Initial time: %02d:%02d:%02d\r\n", hours, minutes, seconds);
@@ -458,11 +648,11 @@ void ST7789::clock_color_display() {
     printf("[CLOCK] First frame transmitted successfully!\r\n");
     
     while (1) {
-        uint32_t now = HAL_GetTick();
+        uint64_t now = timebase::cycles();
         
         // 每秒更新
-        if (now - last_update >= 1000) {
-            last_update = now;
+        if (now - last_update >= second) {
+            last_update += second;
             
             // 时间递增
             seconds++;
@@ -492,13 +682,13 @@ void ST7789::clock_color_display() {
             }
             
             // 每5秒打印一次时间
-            if (now - last_print >= 5000) {
+            if (now - last_print >= 5 * second) {
                 last_print = now;
                 printf("[CLOCK] %02d:%02d:%02d - Color: R=%d G=%d B=%d\r\n",
                        hours, minutes, seconds, r, g, b);
             }
         }
         
-        HAL_Delay(10);
+        timebase::delay_us(10000);
     }
 }
@@ -0,0 +1,196 @@
+#include "accel2d.hpp"
+#include "fastmem.hpp"
+
+namespace {
+    // DMA2D colour modes (FGPFCCR/BGPFCCR/OPFCCR CM)
+    constexpr uint32_t CM_RGB565 {0x2};
+    constexpr uint32_t CM_A8     {0x9};
+    constexpr uint32_t CM_A4     {0xA};
+
+    // CR MODE field
+    constexpr uint32_t MODE_M2M       {0x0};
+    constexpr uint32_t MODE_M2M_BLEND {0x2};
+    constexpr uint32_t MODE_R2M       {0x3};
+
+    constexpr uint32_t ERROR_FLAGS {DMA2D_ISR_TEIF | DMA2D_ISR_CEIF};
+
+    // RGB565 channel to 8 bits as the DMA2D PFC does it: bit replication
+    inline uint32_t r8(uint16_t c) { uint32_t v = (c >> 11) & 0x1F; return (v << 3) | (v >> 2); }
+    inline uint32_t g8(uint16_t c) { uint32_t v = (c >> 5) & 0x3F;  return (v << 2) | (v >> 4); }
+    inline uint32_t b8(uint16_t c) { uint32_t v = c & 0x1F;         return (v << 3) | (v >> 2); }
+
+    // clean-invalidate or invalidate a strided block, row by row unless contiguous
+    template<bool Invalidate>
+    void maintain_rows(const void* p, uint32_t stride_bytes, uint32_t row_bytes, uint16_t h) {
+        const uint8_t* q = (const uint8_t*)p;
+        if (stride_bytes == row_bytes) {
+            row_bytes *= h;
+            h = 1;
+        }
+        for (uint16_t y = 0; y < h; y++) {
+            if (Invalidate) {
+                SCB_InvalidateDCache_by_Addr((uint32_t*)q, (int32_t)row_bytes);
+            } else {
+                SCB_CleanInvalidateDCache_by_Addr((uint32_t*)q, (int32_t)row_bytes);
+            }
+            q += stride_bytes;
+        }
+    }
+
+    inline bool in_tcm(const void* p) {
+        uint32_t a = (uint32_t)p;
+        return a < 0x00010000 || (a >= 0x20000000 && a < 0x20020000);
+    }
+} // namespace
+
+namespace gfx {
+
+    Accel2D::Accel2D(Backend backend)
+        : backend_(backend), pending_(false), errors_(0), pend_dst_(nullptr),
+          pend_stride_(0), pend_w_(0), pend_h_(0) {
+        __HAL_RCC_DMA2D_CLK_ENABLE();
+    }
+
+    void Accel2D::set_backend(Backend backend) {
+        wait();
+        backend_ = backend;
+    }
+
+    uint16_t Accel2D::blend_pixel(uint16_t bg, uint16_t fg, uint8_t alpha) {
+        // Cout = (Cfg * a + Cbg * (255 - a)) / 255, background alpha fixed at 255
+        const uint32_t ia = 255 - alpha;
+        uint32_t r = (r8(fg) * alpha + r8(bg) * ia) / 255;
+        uint32_t g = (g8(fg) * alpha + g8(bg) * ia) / 255;
+        uint32_t b = (b8(fg) * alpha + b8(bg) * ia) / 255;
+        return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+
+    bool Accel2D::use_dma2d(const void* a, const void* b) const {
+        return backend_ == Backend::Dma2d && !in_tcm(a) && (b == nullptr || !in_tcm(b));
+    }
+
+    bool Accel2D::busy() const {
+        return pending_ && (DMA2D->CR & DMA2D_CR_START) != 0;
+    }
+
+    void Accel2D::wait() {
+        if (!pending_) {
+            return;
+        }
+        while ((DMA2D->ISR & (DMA2D_ISR_TCIF | ERROR_FLAGS)) == 0U) {
+        }
+        if (DMA2D->ISR & ERROR_FLAGS) {
+            errors_++;
+            DMA2D->CR &= ~DMA2D_CR_START;
+        }
+        DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+        // drop lines the core may have speculatively refilled during the transfer
+        maintain_rows<true>(pend_dst_, pend_stride_ * 2, pend_w_ * 2u, pend_h_);
+        pending_ = false;
+    }
+
+    void Accel2D::start(uint32_t mode, uint16_t* dst, uint32_t dst_stride, uint16_t w, uint16_t h) {
+        // no dirty line may be evicted on top of the DMA2D output later
+        maintain_rows<false>(dst, dst_stride * 2, w * 2u, h);
+
+        DMA2D->OPFCCR = CM_RGB565;
+        DMA2D->OMAR = (uint32_t)dst;
+        DMA2D->OOR = dst_stride - w;
+        DMA2D->NLR = ((uint32_t)w << DMA2D_NLR_PL_Pos) | h;
+        DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+
+        pend_dst_ = dst;
+        pend_stride_ = dst_stride;
+        pend_w_ = w;
+        pend_h_ = h;
+        pending_ = true;
+        DMA2D->CR = (mode << DMA2D_CR_MODE_Pos) | DMA2D_CR_START;
+    }
+
+    void Accel2D::fill(uint16_t* dst, uint32_t dst_stride, uint16_t w, uint16_t h, uint16_t color) {
+        wait();
+        if (w == 0 || h == 0) {
+            return;
+        }
+        if (!use_dma2d(dst)) {
+            fastmem::fill_rect16(dst, dst_stride, w, h, color);
+            return;
+        }
+        DMA2D->OCOLR = color;   // RGB565 output: colour register holds the 16-bit value
+        start(MODE_R2M, dst, dst_stride, w, h);
+    }
+
+    void Accel2D::copy(uint16_t* dst, uint32_t dst_stride,
+                       const uint16_t* src, uint32_t src_stride, uint16_t w, uint16_t h) {
+        wait();
+        if (w == 0 || h == 0) {
+            return;
+        }
+        if (!use_dma2d(dst, src)) {
+            fastmem::copy_rect16(dst, dst_stride, src, src_stride, w, h);
+            return;
+        }
+        DMA2D->FGMAR = (uint32_t)src;
+        DMA2D->FGOR = src_stride - w;
+        DMA2D->FGPFCCR = CM_RGB565;
+        start(MODE_M2M, dst, dst_stride, w, h);
+    }
+
+    void Accel2D::blend_dma2d(uint16_t* dst, uint32_t dst_stride, const uint8_t* mask,
+                              uint32_t mask_stride, uint16_t w, uint16_t h, uint16_t color, uint32_t cm) {
+        DMA2D->FGMAR = (uint32_t)mask;
+        DMA2D->FGOR = mask_stride - w;
+        DMA2D->FGPFCCR = cm;    // alpha mode 00: mask alpha as is
+        DMA2D->FGCOLR = (r8(color) << 16) | (g8(color) << 8) | b8(color);
+        DMA2D->BGMAR = (uint32_t)dst;
+        DMA2D->BGOR = dst_stride - w;
+        DMA2D->BGPFCCR = CM_RGB565;
+        start(MODE_M2M_BLEND, dst, dst_stride, w, h);
+    }
+
+    void Accel2D::blend_a8(uint16_t* dst, uint32_t dst_stride,
+                           const uint8_t* mask, uint32_t mask_stride,
+                           uint16_t w, uint16_t h, uint16_t color) {
+        wait();
+        if (w == 0 || h == 0) {
+            return;
+        }
+        if (use_dma2d(dst, mask)) {
+            blend_dma2d(dst, dst_stride, mask, mask_stride, w, h, color, CM_A8);
+            return;
+        }
+        for (uint16_t y = 0; y < h; y++) {
+            uint16_t* d = dst + y * dst_stride;
+            const uint8_t* m = mask + y * mask_stride;
+            for (uint16_t x = 0; x < w; x++) {
+                if (m[x] != 0) {
+                    d[x] = blend_pixel(d[x], color, m[x]);
+                }
+            }
+        }
+    }
+
+    void Accel2D::blend_a4(uint16_t* dst, uint32_t dst_stride,
+                           const uint8_t* mask, uint32_t mask_stride,
+                           uint16_t w, uint16_t h, uint16_t color) {
+        wait();
+        if (w == 0 || h == 0) {
+            return;
+        }
+        if (use_dma2d(dst, mask)) {
+            blend_dma2d(dst, dst_stride, mask, mask_stride, w, h, color, CM_A4);
+            return;
+        }
+        for (uint16_t y = 0; y < h; y++) {
+            uint16_t* d = dst + y * dst_stride;
+            const uint8_t* m = mask + y * (mask_stride / 2);
+            for (uint16_t x = 0; x < w; x++) {
+                uint8_t a4 = (x & 1) ? (m[x / 2] >> 4) : (m[x / 2] & 0x0F);
+                if (a4 != 0) {
+                    d[x] = blend_pixel(d[x], color, (uint8_t)(a4 * 17));  // 4 -> 8 bit as 0xN -> 0xNN
+                }
+            }
+        }
+    }
+
+} // namespace gfx
@@ -3,11 +3,13 @@
 #include "uart.hpp"
 #include "led.hpp"
 #include "ST7789.hpp"
+#include "frame_pacer.hpp"
+#include "timebase.hpp"
+#include "irq_latency.h"
 
 // 声明在 main.cpp 中定义的全局 led_pc13_ptr 指针
 // 我们需要用 extern 来告诉编译器，这个变量在别处定义
 extern Led* led_pc13_ptr;
-extern ST7789* g_lcd_ptr;  // ⭐ LCD全局指针
 
 ///  @brief uart receive callback
 void uart_rx_callback(uint8_t byte) {
@@ -19,8 +21,9 @@ extern "C" {
     ///  @brief  uart receive callback
     ///  @param  huart: uart handle pointer, UART_HandleTypeDef structure
     ///  @retval None
-    void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+    ITCM_FUNC void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
         if (huart->Instance == USART1) {
+            irq_probe_reach(IRQ_PROBE_USART1);
             // Safety check: only call if Uart is initialized
             // This prevents crashes if interrupt fires before init is complete
             if (Uart::is_initialized()) {
@@ -32,23 +35,32 @@ extern "C" {
     ///  @brief  TIM Period Elapsed callback in non-blocking mode
     ///  @param  htim TIM handle
     ///  @retval None
-    void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim) {
+    ITCM_FUNC void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim) {
         if (htim->Instance == TIM6) {
-            // Reserved for future periodic tasks
+            irq_probe_reach(IRQ_PROBE_TIM6);
+            timebase::poll();   // 2 Hz, well inside one CYCCNT wrap
         }
 
         if (htim->Instance == TIM7) {
+            irq_probe_reach(IRQ_PROBE_TIM7);
             if (led_pc13_ptr) {
                 led_pc13_ptr->breathing();
             }
         }
     }
 
-    /// @brief SPI TX完成回调（DMA模式）
-    void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
-        if (hspi->Instance == SPI5 && g_lcd_ptr) {
-            g_lcd_ptr->dma_tx_cplt_callback();
+    /// @brief SPI TX完成回调（DMA模式），按句柄分发到对应的屏
+    ITCM_FUNC void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+        if (hspi->Instance == SPI5) {
+            irq_probe_reach(IRQ_PROBE_SPI5);
         }
+        ST7789::dispatch_tx_complete(hspi);
+    }
+
+    /// @brief EXTI回调：屏的TE信号交给帧节拍器
+    ITCM_FUNC void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+        irq_probe_reach(IRQ_PROBE_TE);
+        FramePacer::dispatch_te(GPIO_Pin);
     }
 
 }
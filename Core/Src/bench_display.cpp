@@ -0,0 +1,180 @@
+#include "bench_display.hpp"
+#include "bench_sdram.hpp"
+#include "fastmem.hpp"
+#include "mpu_profile.hpp"
+#include "timebase.hpp"
+#include <stdio.h>
+
+namespace bench {
+    namespace display {
+
+        namespace {
+            constexpr uint32_t FRAMES {10};
+            constexpr uint32_t COPY_BYTES {32 * 1024};     // larger than the D-Cache, so it hits SDRAM
+            constexpr uint32_t FRAME_OFFSET {0};
+            constexpr uint32_t COPY_OFFSET {1024 * 1024};  // copy source, destination follows
+            constexpr uint32_t DELTA_FRAMES {60};
+            constexpr uint16_t BOX {24};                   // square moved by the delta run
+            constexpr uint16_t BOX_STEP {4};               // rows per frame
+
+            struct Mode {
+                ST7789::DmaMode mode;
+                const char* name;
+            };
+            const Mode modes[] = {
+                {ST7789::DmaMode::Halfword, "halfword"},
+                {ST7789::DmaMode::Packed, "packed32"},
+                {ST7789::DmaMode::Burst, "burst4"},
+            };
+
+            struct Result {
+                uint32_t frame_cycles;  // average per frame
+                uint32_t copy_mbps_x10; // CPU copy throughput, 0 when not copying
+            };
+
+            struct DeltaResult {
+                uint32_t frame_cycles;  // average per frame, row hashing included
+                uint32_t rows_sent;     // average per frame
+                uint32_t hash_cycles;   // average per frame
+            };
+
+            /// SPI bit clock from the kernel clock and the baud rate prescaler (2 << MBR)
+            uint32_t spi_bit_hz(const SPI_HandleTypeDef* hspi) {
+                const uint32_t kernel = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SPI45);
+                return kernel / (2U << (hspi->Init.BaudRatePrescaler >> SPI_CFG1_MBR_Pos));
+            }
+
+            void make_frame(uint16_t* frame, uint16_t width, uint16_t height) {
+                for (uint32_t y = 0; y < height; y++) {
+                    for (uint32_t x = 0; x < width; x++) {
+                        frame[y * width + x] = (uint16_t)(((x >> 3) << 11) | ((y * 63 / height) << 5) | ((x ^ y) & 0x1F));
+                    }
+                }
+                mpu::clean_for_dma(frame, (uint32_t)width * height * 2);
+            }
+
+            /// send FRAMES full frames; with copy set, the CPU copies SDRAM blocks until each frame is out
+            Result run(ST7789& lcd, uint16_t* frame, bool copy) {
+                uint8_t* src = (uint8_t*)(bench::sdram::DEFAULT_BASE + COPY_OFFSET);
+                uint8_t* dst = src + COPY_BYTES;
+                const ST7789::Transfer full = {0, 0, (uint16_t)(lcd.width() - 1), (uint16_t)(lcd.height() - 1),
+                                               frame, lcd.panel().pixels(), 0, ST7789::TX_WINDOW};
+                uint64_t copied = 0;
+                uint32_t copy_cycles = 0;
+                uint32_t frame_cycles = 0;
+                for (uint32_t f = 0; f < FRAMES; f++) {
+                    lcd.transmit_list(&full, 1);
+                    const uint32_t start = DWT->CYCCNT;
+                    while (lcd.is_busy()) {
+                        if (copy) {
+                            fastmem::copy(dst, src, COPY_BYTES);
+                            copied += COPY_BYTES;
+                        }
+                    }
+                    copy_cycles += DWT->CYCCNT - start;
+                    frame_cycles += lcd.last_list_stats().total_cycles;
+                }
+                return {frame_cycles / FRAMES, copy ? sdram::to_mbps_x10(copied, copy_cycles) : 0};
+            }
+
+            /// redraw the whole frame with a BOX square a few rows further down, as an app
+            /// without damage tracking does, and send it with transmit_buffer_dma();
+            /// the first frame after a mode change goes out untimed
+            DeltaResult run_delta(ST7789& lcd, uint16_t* frame) {
+                const uint16_t w = lcd.width();
+                const uint16_t h = lcd.height();
+                uint32_t frame_cycles = 0;
+                uint32_t rows_sent = 0;
+                uint32_t hash_cycles = 0;
+                for (uint32_t f = 0; f <= DELTA_FRAMES; f++) {
+                    const uint16_t y = (uint16_t)((f * BOX_STEP) % (h - BOX));
+                    make_frame(frame, w, h);
+                    fastmem::fill_rect16(frame + (uint32_t)y * w + (w - BOX) / 2, w, BOX, BOX, 0xFFFF);
+                    const uint32_t start = DWT->CYCCNT;
+                    lcd.transmit_buffer_dma(frame);
+                    while (lcd.is_busy()) {
+                    }
+                    if (f == 0) {
+                        continue;
+                    }
+                    frame_cycles += DWT->CYCCNT - start;
+                    if (lcd.delta_mode()) {
+                        rows_sent += lcd.last_delta_stats().rows_sent;
+                        hash_cycles += lcd.last_delta_stats().hash_cycles;
+                    } else {
+                        rows_sent += h;
+                    }
+                }
+                return {frame_cycles / DELTA_FRAMES, rows_sent / DELTA_FRAMES, hash_cycles / DELTA_FRAMES};
+            }
+
+            /// CPU copy throughput with the bus to itself, over about the same time
+            uint32_t copy_alone(uint32_t cycles) {
+                uint8_t* src = (uint8_t*)(bench::sdram::DEFAULT_BASE + COPY_OFFSET);
+                uint8_t* dst = src + COPY_BYTES;
+                uint64_t copied = 0;
+                const uint32_t start = DWT->CYCCNT;
+                while (DWT->CYCCNT - start < cycles) {
+                    fastmem::copy(dst, src, COPY_BYTES);
+                    copied += COPY_BYTES;
+                }
+                return sdram::to_mbps_x10(copied, DWT->CYCCNT - start);
+            }
+
+            uint32_t percent_x10(uint64_t part, uint64_t whole) {
+                return whole ? (uint32_t)(part * 1000 / whole) : 0;
+            }
+        } // namespace
+
+        void run_report(ST7789& lcd) {
+            timebase::init();
+            uint16_t* frame = (uint16_t*)(bench::sdram::DEFAULT_BASE + FRAME_OFFSET);
+            make_frame(frame, lcd.width(), lcd.height());
+
+            const uint32_t bit_hz = spi_bit_hz(lcd.spi());
+            // time the pixels need on the wire at 16 bits each
+            const uint32_t wire_cycles = (uint32_t)((uint64_t)lcd.panel().pixels() * 16 * SystemCoreClock / bit_hz);
+            printf("[BENCH] display %ux%u from SDRAM, SPI %lu kHz, wire time %lu us/frame (%s)\r\n",
+                   (unsigned int)lcd.width(), (unsigned int)lcd.height(),
+                   (unsigned long)(bit_hz / 1000), (unsigned long)(wire_cycles / (SystemCoreClock / 1000000)),
+                   mpu::profile_name());
+
+            const uint32_t idle = copy_alone(wire_cycles * FRAMES);
+            printf("[BENCH] cpu sdram copy alone: %lu.%lu MB/s\r\n",
+                   (unsigned long)(idle / 10), (unsigned long)(idle % 10));
+            printf("[BENCH] mode      frame_us  spi_util  frame_us+cpu  spi_util  cpu_MB/s  cpu_loss\r\n");
+
+            for (const Mode& m : modes) {
+                lcd.set_dma_mode(m.mode);
+                run(lcd, frame, false);     // warm up: DMA stream reconfigured, window sent once
+                const Result alone = run(lcd, frame, false);
+                const Result busy = run(lcd, frame, true);
+                const uint32_t util = percent_x10(wire_cycles, alone.frame_cycles);
+                const uint32_t util_busy = percent_x10(wire_cycles, busy.frame_cycles);
+                const uint32_t loss = busy.copy_mbps_x10 < idle ? percent_x10(idle - busy.copy_mbps_x10, idle) : 0;
+                printf("[BENCH] %-8s %9lu %6lu.%lu%% %13lu %6lu.%lu%% %6lu.%lu %6lu.%lu%%\r\n", m.name,
+                       (unsigned long)(alone.frame_cycles / (SystemCoreClock / 1000000)),
+                       (unsigned long)(util / 10), (unsigned long)(util % 10),
+                       (unsigned long)(busy.frame_cycles / (SystemCoreClock / 1000000)),
+                       (unsigned long)(util_busy / 10), (unsigned long)(util_busy % 10),
+                       (unsigned long)(busy.copy_mbps_x10 / 10), (unsigned long)(busy.copy_mbps_x10 % 10),
+                       (unsigned long)(loss / 10), (unsigned long)(loss % 10));
+            }
+            lcd.set_dma_mode(ST7789::DmaMode::Burst);
+
+            // full frames without damage information: whole frame vs changed rows only
+            const DeltaResult whole = run_delta(lcd, frame);
+            lcd.set_delta_mode(true);
+            const DeltaResult delta = run_delta(lcd, frame);
+            lcd.set_delta_mode(false);
+            printf("[BENCH] full frames, %ux%u box moving %u rows/frame:\r\n",
+                   (unsigned int)BOX, (unsigned int)BOX, (unsigned int)BOX_STEP);
+            printf("[BENCH]   whole  %6lu us/frame, %3lu rows\r\n",
+                   (unsigned long)(whole.frame_cycles / (SystemCoreClock / 1000000)), (unsigned long)whole.rows_sent);
+            printf("[BENCH]   delta  %6lu us/frame, %3lu rows, hash %lu us\r\n",
+                   (unsigned long)(delta.frame_cycles / (SystemCoreClock / 1000000)), (unsigned long)delta.rows_sent,
+                   (unsigned long)(delta.hash_cycles / (SystemCoreClock / 1000000)));
+        }
+
+    } // namespace display
+} // namespace bench
@@ -0,0 +1,239 @@
+#include "bench_gfx.hpp"
+#include "bench_sdram.hpp"
+#include "accel2d.hpp"
+#include "rotozoom.hpp"
+#include "mpu_profile.hpp"
+#include "timebase.hpp"
+#include <stdio.h>
+
+namespace bench {
+    namespace gfx2d {
+
+        namespace {
+            constexpr uint16_t WIDTH {240};     // ClockApp frame
+            constexpr uint16_t HEIGHT {280};
+            constexpr uint32_t FRAME_PIXELS {WIDTH * HEIGHT};
+            constexpr uint16_t SPRITE {64};
+            constexpr uint16_t BAND_Y0 {40};    // typical hand band
+            constexpr uint16_t BAND_Y1 {240};
+            constexpr uint16_t CHECK_W {256};   // blend check: one column per alpha value
+            constexpr uint16_t CHECK_ROWS {64}; // one background colour per row
+
+            AXI_SRAM uint8_t mask_a8[SPRITE * SPRITE];
+            AXI_SRAM uint8_t mask_a4[SPRITE * SPRITE / 2];
+
+            enum Op : uint8_t { FILL, DIAL, BAND, A8, A4, OP_COUNT };
+            const char* const op_names[OP_COUNT] = {"fill", "dial", "band", "blend-a8", "blend-a4"};
+
+            struct Timing {
+                uint32_t issue;     // cycles until the call returns (CPU busy)
+                uint32_t total;     // cycles until the result is in memory
+            };
+
+            void make_inputs(uint16_t* dial) {
+                for (uint32_t i = 0; i < FRAME_PIXELS; i++) {
+                    uint32_t x = i % WIDTH;
+                    uint32_t y = i / WIDTH;
+                    dial[i] = (uint16_t)(((x >> 3) << 11) | ((y * 63 / HEIGHT) << 5) | ((x ^ y) & 0x1F));
+                }
+                for (uint32_t y = 0; y < SPRITE; y++) {
+                    for (uint32_t x = 0; x < SPRITE; x++) {
+                        int32_t dx = (int32_t)x - SPRITE / 2;
+                        int32_t dy = (int32_t)y - SPRITE / 2;
+                        int32_t d2 = dx * dx + dy * dy;
+                        uint8_t a = d2 >= 1024 ? 0 : (uint8_t)(255 - d2 * 255 / 1024);
+                        mask_a8[y * SPRITE + x] = a;
+                        uint8_t& b = mask_a4[(y * SPRITE + x) / 2];
+                        b = (x & 1) ? (uint8_t)((b & 0x0F) | ((a >> 4) << 4)) : (uint8_t)(a >> 4);
+                    }
+                }
+                mpu::clean_for_dma(dial, FRAME_PIXELS * 2);
+                SCB_CleanDCache_by_Addr((uint32_t*)mask_a8, sizeof(mask_a8));
+                SCB_CleanDCache_by_Addr((uint32_t*)mask_a4, sizeof(mask_a4));
+            }
+
+            template<typename Fn>
+            Timing timed(gfx::Accel2D& accel, Fn fn) {
+                uint32_t start = DWT->CYCCNT;
+                fn();
+                uint32_t issued = DWT->CYCCNT;
+                accel.wait();
+                return {issued - start, DWT->CYCCNT - start};
+            }
+
+            void run_frame(gfx::Accel2D& accel, uint16_t* frame, const uint16_t* dial, Timing t[OP_COUNT]) {
+                const uint16_t rose = 0xDC90;
+                t[FILL] = timed(accel, [&] { accel.fill(frame, WIDTH, WIDTH, HEIGHT, 0x0841); });
+                t[DIAL] = timed(accel, [&] { accel.copy(frame, WIDTH, dial, WIDTH, WIDTH, HEIGHT); });
+                t[BAND] = timed(accel, [&] {
+                    accel.copy(frame + BAND_Y0 * WIDTH, WIDTH, dial + BAND_Y0 * WIDTH, WIDTH, WIDTH, BAND_Y1 - BAND_Y0);
+                });
+                t[A8] = timed(accel, [&] {
+                    accel.blend_a8(frame + 108 * WIDTH + 88, WIDTH, mask_a8, SPRITE, SPRITE, SPRITE, rose);
+                });
+                t[A4] = timed(accel, [&] {
+                    accel.blend_a4(frame + 20 * WIDTH + 20, WIDTH, mask_a4, SPRITE, SPRITE, SPRITE, rose);
+                });
+            }
+
+            // background of a check row: black, white and a spread of channel values between
+            uint16_t check_background(uint32_t y) {
+                if (y == 0) {
+                    return 0x0000;
+                }
+                if (y == CHECK_ROWS - 1) {
+                    return 0xFFFF;
+                }
+                return (uint16_t)((((y * 5) & 31) << 11) | (((y * 13 + 7) & 63) << 5) | ((y * 29 + 3) & 31));
+            }
+
+            /// software blend vs DMA2D blend for every alpha value over CHECK_ROWS backgrounds,
+            /// returns the number of differing pixels and reports the first one
+            uint32_t check_blend(uint16_t* sw, uint16_t* hw, uint8_t* mask, bool a4, uint16_t fg) {
+                for (uint32_t y = 0; y < CHECK_ROWS; y++) {
+                    for (uint32_t x = 0; x < CHECK_W; x++) {
+                        sw[y * CHECK_W + x] = check_background(y);
+                        hw[y * CHECK_W + x] = check_background(y);
+                    }
+                }
+                gfx::Accel2D cpu(gfx::Backend::Software);
+                gfx::Accel2D dma2d(gfx::Backend::Dma2d);
+                if (a4) {
+                    cpu.blend_a4(sw, CHECK_W, mask, CHECK_W, CHECK_W, CHECK_ROWS, fg);
+                    dma2d.blend_a4(hw, CHECK_W, mask, CHECK_W, CHECK_W, CHECK_ROWS, fg);
+                } else {
+                    cpu.blend_a8(sw, CHECK_W, mask, CHECK_W, CHECK_W, CHECK_ROWS, fg);
+                    dma2d.blend_a8(hw, CHECK_W, mask, CHECK_W, CHECK_W, CHECK_ROWS, fg);
+                }
+                dma2d.wait();
+
+                uint32_t diff = 0;
+                for (uint32_t i = 0; i < CHECK_W * CHECK_ROWS; i++) {
+                    if (sw[i] == hw[i]) {
+                        continue;
+                    }
+                    if (diff++ == 0) {
+                        const uint32_t x = i % CHECK_W;
+                        const uint8_t alpha = a4 ? (uint8_t)(((x & 1) ? mask[i / 2] >> 4 : mask[i / 2] & 0x0F) * 17)
+                                                 : (uint8_t)x;
+                        printf("[BENCH] blend-%s mismatch: bg %04X fg %04X alpha %u -> cpu %04X dma2d %04X\r\n",
+                               a4 ? "a4" : "a8", (unsigned int)check_background(i / CHECK_W), (unsigned int)fg,
+                               (unsigned int)alpha, (unsigned int)sw[i], (unsigned int)hw[i]);
+                    }
+                }
+                return diff + dma2d.error_count();
+            }
+        } // namespace
+
+        void run_report() {
+            timebase::init();
+
+            uint16_t* dial = (uint16_t*)sdram::DEFAULT_BASE;
+            uint16_t* frame_sw = dial + FRAME_PIXELS;
+            uint16_t* frame_hw = frame_sw + FRAME_PIXELS;
+            make_inputs(dial);
+
+            Timing sw[OP_COUNT];
+            Timing hw[OP_COUNT];
+            gfx::Accel2D accel(gfx::Backend::Software);
+            run_frame(accel, frame_sw, dial, sw);
+            accel.set_backend(gfx::Backend::Dma2d);
+            run_frame(accel, frame_hw, dial, hw);
+
+            uint32_t diff = 0;
+            for (uint32_t i = 0; i < FRAME_PIXELS; i++) {
+                if (frame_sw[i] != frame_hw[i]) {
+                    diff++;
+                }
+            }
+
+            printf("[BENCH] gfx2d %ux%u frame, cycles    cpu   dma2d(busy/total)\r\n", WIDTH, HEIGHT);
+            for (uint8_t op = 0; op < OP_COUNT; op++) {
+                printf("[BENCH] %-9s %8lu %8lu/%-8lu\r\n", op_names[op], (unsigned long)sw[op].total,
+                       (unsigned long)hw[op].issue, (unsigned long)hw[op].total);
+            }
+            printf("[BENCH] gfx2d differing pixels: %lu, DMA2D errors: %lu\r\n",
+                   (unsigned long)diff, (unsigned long)accel.error_count());
+
+            // bit-exactness of the CPU blend: all 256 alphas (16 for A4) x CHECK_ROWS backgrounds x colours
+            const uint16_t colors[] = {0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xDC90, 0x8410, 0x7BEF, 0x1234, 0xFFE0};
+            uint16_t* check_sw = frame_hw + FRAME_PIXELS;
+            uint16_t* check_hw = check_sw + CHECK_W * CHECK_ROWS;
+            uint8_t* check_a8 = (uint8_t*)(check_hw + CHECK_W * CHECK_ROWS);
+            uint8_t* check_a4 = check_a8 + CHECK_W * CHECK_ROWS;
+            for (uint32_t y = 0; y < CHECK_ROWS; y++) {
+                for (uint32_t x = 0; x < CHECK_W; x++) {
+                    check_a8[y * CHECK_W + x] = (uint8_t)x;
+                }
+                for (uint32_t x = 0; x < CHECK_W / 2; x++) {
+                    // both nibbles walk 0..15 across the row
+                    const uint8_t lo = (uint8_t)((2 * x) & 0x0F);
+                    check_a4[y * CHECK_W / 2 + x] = (uint8_t)(lo | ((lo + 1) << 4));
+                }
+            }
+            mpu::clean_for_dma(check_a8, CHECK_W * CHECK_ROWS);
+            mpu::clean_for_dma(check_a4, CHECK_W * CHECK_ROWS / 2);
+            uint32_t a8_diff = 0;
+            uint32_t a4_diff = 0;
+            for (uint16_t fg : colors) {
+                a8_diff += check_blend(check_sw, check_hw, check_a8, false, fg);
+                a4_diff += check_blend(check_sw, check_hw, check_a4, true, fg);
+            }
+            printf("[BENCH] blend check (%u colours x %u backgrounds x all alphas): a8 %lu, a4 %lu differing\r\n",
+                   (unsigned int)(sizeof(colors) / sizeof(colors[0])), (unsigned int)CHECK_ROWS,
+                   (unsigned long)a8_diff, (unsigned long)a4_diff);
+        }
+
+        void run_rotozoom_report() {
+            timebase::init();
+
+            constexpr uint16_t TEX {128};
+            constexpr uint8_t ANGLES {8};
+            constexpr uint8_t MODES {3};
+            const float scales[] = {0.5f, 1.0f, 1.5f, 2.0f, 3.0f};
+
+            uint16_t* frame = (uint16_t*)sdram::DEFAULT_BASE;
+            uint16_t* texels = frame + FRAME_PIXELS;
+            uint8_t* alpha = (uint8_t*)(texels + TEX * TEX);
+            for (uint32_t y = 0; y < TEX; y++) {
+                for (uint32_t x = 0; x < TEX; x++) {
+                    texels[y * TEX + x] = (uint16_t)(((x >> 2) << 11) | ((y >> 1) << 5) | ((x ^ y) & 0x1F));
+                    int32_t dx = (int32_t)x - TEX / 2;
+                    int32_t dy = (int32_t)y - TEX / 2;
+                    int32_t d2 = dx * dx + dy * dy;
+                    alpha[y * TEX + x] = d2 >= TEX * TEX / 4 ? 0 : (uint8_t)(255 - d2 * 255 / (TEX * TEX / 4));
+                }
+            }
+            const gfx::Texture opaque {texels, nullptr, TEX, TEX, TEX};
+            const gfx::Texture masked {texels, alpha, TEX, TEX, TEX};
+            gfx::Painter painter(gfx::Surface565(frame, WIDTH, HEIGHT, WIDTH), {0, 0, WIDTH, HEIGHT});
+
+            printf("[BENCH] rotozoom %ux%u texture -> %ux%u RGB565, Mpx/s over %u angles\r\n",
+                   TEX, TEX, WIDTH, HEIGHT, ANGLES);
+            printf("[BENCH] scale  nearest  bilinear  bilinear+mask\r\n");
+            for (float scale : scales) {
+                uint32_t mpx10[MODES];     // Mpx/s x10, nano printf has no %f
+                for (uint8_t mode = 0; mode < MODES; mode++) {
+                    const gfx::Texture& tex = (mode == 2) ? masked : opaque;
+                    const gfx::Sampling sampling = (mode == 0) ? gfx::Sampling::Nearest : gfx::Sampling::Bilinear;
+                    uint32_t pixels = 0;
+                    uint32_t cycles = 0;
+                    for (uint8_t a = 0; a < ANGLES; a++) {
+                        const gfx::Affine xf {WIDTH / 2, HEIGHT / 2, TEX / 2, TEX / 2, a * 360.0f / ANGLES + 7.0f, scale};
+                        uint32_t start = DWT->CYCCNT;
+                        pixels += gfx::rotozoom(painter, tex, xf, sampling);
+                        cycles += DWT->CYCCNT - start;
+                    }
+                    // cycles / (SYSCLK MHz) = us, so px / us = Mpx/s
+                    mpx10[mode] = cycles ? (uint32_t)((uint64_t)pixels * (SystemCoreClock / 100000U) / cycles) : 0;
+                }
+                printf("[BENCH] x%lu.%lu ", (unsigned long)scale, (unsigned long)(scale * 10) % 10);
+                for (uint8_t mode = 0; mode < MODES; mode++) {
+                    printf(" %5lu.%lu", (unsigned long)(mpx10[mode] / 10), (unsigned long)(mpx10[mode] % 10));
+                }
+                printf("\r\n");
+            }
+        }
+
+    } // namespace gfx2d
+} // namespace bench
@@ -0,0 +1,119 @@
+#include "bench_mem.hpp"
+#include "bench_sdram.hpp"
+#include "fastmem.hpp"
+#include "mpu_profile.hpp"
+#include "timebase.hpp"
+#include <stdio.h>
+#include <string.h>
+
+namespace bench {
+    namespace mem {
+
+        namespace {
+            constexpr uint32_t DTCM_BYTES {16 * 1024};
+            constexpr uint32_t AXI_BYTES  {128 * 1024};
+            constexpr uint32_t SDRAM_BYTES {512 * 1024};
+            constexpr uint32_t RECT_W {120};    // quarter-panel rectangle
+            constexpr uint32_t RECT_H {120};
+            constexpr uint32_t STRIDE {240};
+
+            alignas(32) uint8_t dtcm_scratch[DTCM_BYTES];   // .bss lives in DTCM
+            AXI_SRAM uint8_t axi_scratch[AXI_BYTES];
+
+            /// run fn from a cold cache, return MB/s x10 for the given byte count
+            template<typename Fn>
+            uint32_t timed(uint32_t bytes, Fn fn) {
+                SCB_CleanInvalidateDCache();
+                uint32_t start = DWT->CYCCNT;
+                fn();
+                __DSB();
+                return sdram::to_mbps_x10(bytes, DWT->CYCCNT - start);
+            }
+
+            void print_row(const char* region, const char* op, uint32_t libc, uint32_t fast, uint32_t nt) {
+                printf("[BENCH] %-5s %-9s %5lu.%lu %5lu.%lu", region, op,
+                       (unsigned long)(libc / 10), (unsigned long)(libc % 10),
+                       (unsigned long)(fast / 10), (unsigned long)(fast % 10));
+                if (nt) {
+                    printf(" %5lu.%lu", (unsigned long)(nt / 10), (unsigned long)(nt % 10));
+                }
+                printf("\r\n");
+            }
+        } // namespace
+
+        void run_region(const Region& r) {
+            const uint32_t n = r.bytes / 2;
+            uint8_t* src = r.base;
+            uint8_t* dst = r.base + n;
+            memset(src, 0x5A, n);
+
+            // aligned copy
+            uint32_t libc = timed(n, [&] { memcpy(dst, src, n); });
+            uint32_t fast = timed(n, [&] { fastmem::copy(dst, src, n); });
+            uint32_t nt = timed(n, [&] { fastmem::copy_nt(dst, src, n); });
+            print_row(r.name, "copy", libc, fast, nt);
+
+            // source one byte off: head/tail and unaligned-load path
+            libc = timed(n - 8, [&] { memcpy(dst, src + 1, n - 8); });
+            fast = timed(n - 8, [&] { fastmem::copy(dst, src + 1, n - 8); });
+            print_row(r.name, "copy+1", libc, fast, 0);
+
+            // overlapping move, destination 8 bytes above the source
+            libc = timed(n - 8, [&] { memmove(src + 8, src, n - 8); });
+            fast = timed(n - 8, [&] { fastmem::move(src + 8, src, n - 8); });
+            print_row(r.name, "move", libc, fast, 0);
+
+            // RGB565 fill (memset only stands in for a byte-repeating colour)
+            libc = timed(n, [&] { memset(dst, 0x18, n); });
+            fast = timed(n, [&] { fastmem::fill16((uint16_t*)dst, 0x1818, n / 2); });
+            nt = timed(n, [&] { fastmem::fill16_nt((uint16_t*)dst, 0x1818, n / 2); });
+            print_row(r.name, "fill", libc, fast, nt);
+
+            // word fill (ARGB8888 / packed pixel pairs)
+            libc = timed(n, [&] { memset(dst, 0x18, n); });
+            fast = timed(n, [&] { fastmem::fill32((uint32_t*)dst, 0x18181818, n / 4); });
+            print_row(r.name, "fill32", libc, fast, 0);
+
+            // strided rectangle, only when a whole STRIDE x RECT_H surface fits
+            const uint32_t surface = STRIDE * RECT_H * sizeof(uint16_t);
+            if (surface <= n) {
+                const uint32_t rect = RECT_W * RECT_H * sizeof(uint16_t);
+                libc = timed(rect, [&] {
+                    for (uint32_t y = 0; y < RECT_H; y++) {
+                        memcpy(dst + y * STRIDE * 2, src + y * STRIDE * 2, RECT_W * 2);
+                    }
+                });
+                fast = timed(rect, [&] {
+                    fastmem::copy_rect16((uint16_t*)dst, STRIDE, (const uint16_t*)src, STRIDE, RECT_W, RECT_H);
+                });
+                print_row(r.name, "rect-copy", libc, fast, 0);
+
+                libc = timed(rect, [&] {
+                    for (uint32_t y = 0; y < RECT_H; y++) {
+                        memset(dst + y * STRIDE * 2, 0x18, RECT_W * 2);
+                    }
+                });
+                fast = timed(rect, [&] {
+                    fastmem::fill_rect16((uint16_t*)dst, STRIDE, RECT_W, RECT_H, 0x1818);
+                });
+                print_row(r.name, "rect-fill", libc, fast, 0);
+            }
+        }
+
+        void run_report() {
+            timebase::init();
+            printf("[BENCH] mem   op         newlib fastmem   nt  (MB/s, SYSCLK %lu MHz)\r\n",
+                   (unsigned long)(SystemCoreClock / 1000000));
+
+            const Region regions[] = {
+                {"DTCM", dtcm_scratch, DTCM_BYTES},
+                {"AXI", axi_scratch, AXI_BYTES},
+                {"SDRAM", (uint8_t*)sdram::DEFAULT_BASE, SDRAM_BYTES},
+            };
+            for (const Region& r : regions) {
+                run_region(r);
+            }
+        }
+
+    } // namespace mem
+} // namespace bench
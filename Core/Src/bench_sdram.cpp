@@ -0,0 +1,220 @@
+#include "bench_sdram.hpp"
+#include "timebase.hpp"
+#include <stdio.h>
+#include <string.h>
+
+namespace bench {
+    namespace sdram {
+
+        namespace {
+            constexpr uint32_t MDMA_BLOCK_BYTES {32 * 1024};
+            constexpr uint32_t CHASE_STRIDE     {64};     // two cache lines per node
+            constexpr uint32_t CHASE_HOPS       {16384};
+
+            MDMA_HandleTypeDef hmdma_bench;
+            volatile uint32_t sink;                        // keeps loads alive
+
+            template<typename T>
+            uint32_t seq_write(uint32_t base, uint32_t bytes) {
+                volatile T* p = (volatile T*)base;
+                uint32_t n = bytes / sizeof(T);
+                uint32_t start = DWT->CYCCNT;
+                for (uint32_t i = 0; i < n; i += 4) {
+                    p[i]     = (T)i;
+                    p[i + 1] = (T)i;
+                    p[i + 2] = (T)i;
+                    p[i + 3] = (T)i;
+                }
+                __DSB();
+                return DWT->CYCCNT - start;
+            }
+
+            template<typename T>
+            uint32_t seq_read(uint32_t base, uint32_t bytes) {
+                volatile const T* p = (volatile const T*)base;
+                uint32_t n = bytes / sizeof(T);
+                T acc = 0;
+                uint32_t start = DWT->CYCCNT;
+                for (uint32_t i = 0; i < n; i += 4) {
+                    acc ^= p[i];
+                    acc ^= p[i + 1];
+                    acc ^= p[i + 2];
+                    acc ^= p[i + 3];
+                }
+                uint32_t cycles = DWT->CYCCNT - start;
+                sink = (uint32_t)acc;
+                return cycles;
+            }
+
+            template<typename T>
+            uint32_t word_copy(uint32_t dst, uint32_t src, uint32_t bytes) {
+                volatile T* d = (volatile T*)dst;
+                volatile const T* s = (volatile const T*)src;
+                uint32_t n = bytes / sizeof(T);
+                uint32_t start = DWT->CYCCNT;
+                for (uint32_t i = 0; i < n; i += 4) {
+                    d[i]     = s[i];
+                    d[i + 1] = s[i + 1];
+                    d[i + 2] = s[i + 2];
+                    d[i + 3] = s[i + 3];
+                }
+                __DSB();
+                return DWT->CYCCNT - start;
+            }
+
+            /// MDMA copy of the whole blocks in bytes, MB/s x10; 0 when the transfer fails
+            /// or bytes holds no full block
+            uint32_t mdma_copy_mbps_x10(uint32_t dst, uint32_t src, uint32_t bytes, bool dcache_on) {
+                const uint32_t blocks = bytes / MDMA_BLOCK_BYTES;
+                const uint32_t moved = blocks * MDMA_BLOCK_BYTES;
+                if (blocks == 0) {
+                    return 0;
+                }
+
+                hmdma_bench.Instance = MDMA_Channel0;
+                hmdma_bench.Init.Request = MDMA_REQUEST_SW;
+                hmdma_bench.Init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+                hmdma_bench.Init.Priority = MDMA_PRIORITY_HIGH;
+                hmdma_bench.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+                hmdma_bench.Init.SourceInc = MDMA_SRC_INC_DOUBLEWORD;
+                hmdma_bench.Init.DestinationInc = MDMA_DEST_INC_DOUBLEWORD;
+                hmdma_bench.Init.SourceDataSize = MDMA_SRC_DATASIZE_DOUBLEWORD;
+                hmdma_bench.Init.DestDataSize = MDMA_DEST_DATASIZE_DOUBLEWORD;
+                hmdma_bench.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+                hmdma_bench.Init.BufferTransferLength = 128;
+                hmdma_bench.Init.SourceBurst = MDMA_SOURCE_BURST_16BEATS;
+                hmdma_bench.Init.DestBurst = MDMA_DEST_BURST_16BEATS;
+                hmdma_bench.Init.SourceBlockAddressOffset = 0;
+                hmdma_bench.Init.DestBlockAddressOffset = 0;
+                if (HAL_MDMA_Init(&hmdma_bench) != HAL_OK) {
+                    return 0;
+                }
+
+                uint32_t start = DWT->CYCCNT;
+                // cache maintenance is part of the real cost of a DMA hand-off
+                if (dcache_on) {
+                    SCB_CleanDCache_by_Addr((uint32_t*)src, moved);
+                    SCB_InvalidateDCache_by_Addr((uint32_t*)dst, moved);
+                }
+                bool ok = HAL_MDMA_Start(&hmdma_bench, src, dst, MDMA_BLOCK_BYTES, blocks) == HAL_OK
+                       && HAL_MDMA_PollForTransfer(&hmdma_bench, HAL_MDMA_FULL_TRANSFER, 1000) == HAL_OK;
+                uint32_t cycles = DWT->CYCCNT - start;
+
+                if (!ok) {
+                    printf("[BENCH] MDMA copy failed, error 0x%08lX\r\n", (unsigned long)HAL_MDMA_GetError(&hmdma_bench));
+                    HAL_MDMA_Abort(&hmdma_bench);
+                }
+                HAL_MDMA_DeInit(&hmdma_bench);
+                return ok ? to_mbps_x10(moved, cycles) : 0;
+            }
+
+            /// build a single random cycle over the window (Sattolo) and chase it,
+            /// every load depends on the previous one so prefetch cannot hide latency
+            uint32_t chase_latency_x10(uint32_t base, uint32_t bytes, bool dcache_on) {
+                volatile uint32_t* node = (volatile uint32_t*)base;
+                const uint32_t step = CHASE_STRIDE / sizeof(uint32_t);
+                const uint32_t n = bytes / CHASE_STRIDE;
+
+                for (uint32_t i = 0; i < n; i++) {
+                    node[i * step] = i;
+                }
+                uint32_t seed = 0x2545F491;
+                for (uint32_t i = n - 1; i > 0; i--) {
+                    seed = seed * 1664525U + 1013904223U;
+                    uint32_t j = seed % i;
+                    uint32_t tmp = node[i * step];
+                    node[i * step] = node[j * step];
+                    node[j * step] = tmp;
+                }
+                if (dcache_on) {
+                    SCB_CleanInvalidateDCache_by_Addr((uint32_t*)base, bytes);
+                }
+
+                uint32_t idx = 0;
+                uint32_t start = DWT->CYCCNT;
+                for (uint32_t i = 0; i < CHASE_HOPS; i++) {
+                    idx = node[idx * step];
+                }
+                uint32_t cycles = DWT->CYCCNT - start;
+                sink = idx;
+                return (uint32_t)((uint64_t)cycles * 10 / CHASE_HOPS);
+            }
+
+            void print_row(const char* cache, const char* op, const uint32_t v[4]) {
+                printf("[BENCH] %-3s %-6s %5lu.%lu %5lu.%lu %5lu.%lu %5lu.%lu\r\n", cache, op,
+                       (unsigned long)(v[0] / 10), (unsigned long)(v[0] % 10),
+                       (unsigned long)(v[1] / 10), (unsigned long)(v[1] % 10),
+                       (unsigned long)(v[2] / 10), (unsigned long)(v[2] % 10),
+                       (unsigned long)(v[3] / 10), (unsigned long)(v[3] % 10));
+            }
+        } // namespace
+
+        Report measure(uint32_t base, uint32_t bytes, bool dcache_on) {
+            Report r = {};
+            r.dcache_on = dcache_on;
+            uint32_t src = base;
+            uint32_t dst = base + bytes;
+
+            timebase::init();
+            if (!dcache_on) {
+                SCB_DisableDCache();
+            }
+
+            r.write_mbps_x10[0] = to_mbps_x10(bytes, seq_write<uint8_t>(src, bytes));
+            r.write_mbps_x10[1] = to_mbps_x10(bytes, seq_write<uint16_t>(src, bytes));
+            r.write_mbps_x10[2] = to_mbps_x10(bytes, seq_write<uint32_t>(src, bytes));
+            r.write_mbps_x10[3] = to_mbps_x10(bytes, seq_write<uint64_t>(src, bytes));
+
+            r.read_mbps_x10[0] = to_mbps_x10(bytes, seq_read<uint8_t>(src, bytes));
+            r.read_mbps_x10[1] = to_mbps_x10(bytes, seq_read<uint16_t>(src, bytes));
+            r.read_mbps_x10[2] = to_mbps_x10(bytes, seq_read<uint32_t>(src, bytes));
+            r.read_mbps_x10[3] = to_mbps_x10(bytes, seq_read<uint64_t>(src, bytes));
+
+            r.copy_mbps_x10[0] = to_mbps_x10(bytes, word_copy<uint8_t>(dst, src, bytes));
+            r.copy_mbps_x10[1] = to_mbps_x10(bytes, word_copy<uint16_t>(dst, src, bytes));
+            r.copy_mbps_x10[2] = to_mbps_x10(bytes, word_copy<uint32_t>(dst, src, bytes));
+            r.copy_mbps_x10[3] = to_mbps_x10(bytes, word_copy<uint64_t>(dst, src, bytes));
+
+            uint32_t start = DWT->CYCCNT;
+            memcpy((void*)dst, (const void*)src, bytes);
+            __DSB();
+            r.memcpy_mbps_x10 = to_mbps_x10(bytes, DWT->CYCCNT - start);
+
+            r.mdma_mbps_x10 = mdma_copy_mbps_x10(dst, src, bytes, dcache_on);
+            r.latency_cycles_x10 = chase_latency_x10(src, bytes, dcache_on);
+
+            if (!dcache_on) {
+                SCB_EnableDCache();
+            }
+            return r;
+        }
+
+        void run_report(uint32_t base, uint32_t bytes) {
+            const uint32_t sdcr = FMC_Bank5_6_R->SDCR[0];
+            const uint32_t sdtr = FMC_Bank5_6_R->SDTR[0];
+            const uint32_t refresh = (FMC_Bank5_6_R->SDRTR & FMC_SDRTR_COUNT) >> FMC_SDRTR_COUNT_Pos;
+
+            printf("[BENCH] SDRAM @0x%08lX window %lu KB, SYSCLK %lu MHz\r\n",
+                   (unsigned long)base, (unsigned long)(bytes / 1024),
+                   (unsigned long)(SystemCoreClock / 1000000));
+            printf("[BENCH] FMC SDCR=0x%08lX SDTR=0x%08lX refresh=%lu\r\n",
+                   (unsigned long)sdcr, (unsigned long)sdtr, (unsigned long)refresh);
+            printf("[BENCH] DC  op          8b    16b    32b    64b  (MB/s)\r\n");
+
+            const bool states[2] = {true, false};
+            for (bool on : states) {
+                Report r = measure(base, bytes, on);
+                const char* tag = on ? "on" : "off";
+                print_row(tag, "write", r.write_mbps_x10);
+                print_row(tag, "read", r.read_mbps_x10);
+                print_row(tag, "copy", r.copy_mbps_x10);
+                printf("[BENCH] %-3s memcpy %lu.%lu | mdma %lu.%lu MB/s | rand %lu.%lu cyc (%lu ns)\r\n", tag,
+                       (unsigned long)(r.memcpy_mbps_x10 / 10), (unsigned long)(r.memcpy_mbps_x10 % 10),
+                       (unsigned long)(r.mdma_mbps_x10 / 10), (unsigned long)(r.mdma_mbps_x10 % 10),
+                       (unsigned long)(r.latency_cycles_x10 / 10), (unsigned long)(r.latency_cycles_x10 % 10),
+                       (unsigned long)((uint64_t)r.latency_cycles_x10 * 100 / (SystemCoreClock / 1000000)));
+            }
+        }
+
+    } // namespace sdram
+} // namespace bench
@@ -1,507 +1,746 @@
 #include "clock_app.hpp"
+#include "mpu_profile.hpp"
+#include "sdram_map.hpp"
+#include "fastmem.hpp"
+#include "font_stroke20.hpp"
+#include "image_dial_face.hpp"
 #include <stdio.h>
-#include <math.h>
-#include <string.h>  // for memcpy
-
-// 静态表盘缓冲区：放回SDRAM（妥协方案）
-// 内部SRAM配置复杂，暂时使用SDRAM
-// TODO: 未来优化链接脚本以使用512KB AXI SRAM
-
-// Sin/Cos查找表（每6度一个值，0-354度，共60个值）
-static const int16_t sin_table[60] = {
-    0, 105, 208, 309, 407, 500, 588, 669, 743, 809,
-    866, 914, 951, 978, 995, 1000, 995, 978, 951, 914,
-    866, 809, 743, 669, 588, 500, 407, 309, 208, 105,
-    0, -105, -208, -309, -407, -500, -588, -669, -743, -809,
-    -866, -914, -951, -978, -995, -1000, -995, -978, -951, -914,
-    -866, -809, -743, -669, -588, -500, -407, -309, -208, -105
-};
+#include <string.h>
 
+// 内存布局：帧缓冲、静态表盘和指针精灵缓存在SDRAM；每帧都访问的小画布、数字读数和
+// 调色板反查表在AXI SRAM（.axi_sram段）
+
+namespace {
+    constexpr uint32_t FRAME_PIXELS {sdram_map::FRAME_PIXELS};
+
+    // HUD：表盘下方的FPS/CPU统计和秒进度条（半透明叠加）
+    constexpr int16_t HUD_X {8};
+    constexpr int16_t HUD_Y {246};
+    constexpr uint16_t HUD_W {224};
+    constexpr uint16_t HUD_H {34};
+    constexpr uint8_t HUD_ALPHA {160};
+    constexpr float HUD_BAR {6.0f};                         // 圆头进度条粗细
+    constexpr float HUD_LEN {HUD_W - 1 - HUD_BAR};          // 两端圆头中心之间的长度
+
+    // HUD画布很小，放在AXI SRAM
+    AXI_SRAM uint16_t hud_pixels[HUD_W * HUD_H];
+    AXI_SRAM uint8_t hud_coverage[HUD_W * HUD_H];
+
+    // 数字读数面板：表盘中心下方、刻度以内的不透明小图层
+    constexpr int16_t READOUT_X {60};
+    constexpr int16_t READOUT_Y {170};
+    constexpr uint16_t READOUT_W {120};
+    constexpr uint16_t READOUT_H {24};                      // stroke20行高
+    constexpr uint32_t READOUT_CELLS {12 * 14 * READOUT_H}; // "0123456789:."，每个单元最宽14px
+    AXI_SRAM uint16_t readout_pixels[READOUT_W * READOUT_H];
+    AXI_SRAM uint16_t readout_cells[READOUT_CELLS];
+
+    // 毫秒针画布：半分辨率（120x140），颜色+覆盖率共50 KB，放在AXI SRAM
+    constexpr uint32_t FAST_PIXELS {FRAME_PIXELS / 4};
+    AXI_SRAM uint16_t fast_pixels[FAST_PIXELS];
+    AXI_SRAM uint8_t fast_coverage[FAST_PIXELS];
+    
+    // 调色板反查表（RGB565 -> 索引），每个合成像素查一次，放在AXI SRAM
+    AXI_SRAM uint8_t palette_inverse[gfx::Palette::INVERSE_BYTES];
+    constexpr uint16_t DIAL_COLORS {160};       // 表盘图片最多占用的调色板项
+    constexpr uint8_t RAMP_STEPS {8};           // 底色到各配色的抗锯齿/半透明过渡
+    
+    // 指针精灵缓存：SDRAM 2 MB~3 MB（sdram_map::SPRITES），每根指针的角度数和字节预算；
+    // 后台SDRAM自检从3 MB处起（main.cpp），不会覆盖缓存。
+    // 分针每次跳6°，60个角度即完全准确；预算不够时角度数自动减半
+    struct HandSprites {
+        uint16_t angles;
+        uint32_t budget;
+    };
+    constexpr uint32_t SPRITE_BASE {sdram_map::SPRITES};
+    constexpr HandSprites HAND_SPRITES[] = {
+        {720, 384 * 1024},      // 秒针
+        {60, 64 * 1024},        // 分针
+        {360, 128 * 1024},      // 毫秒轨迹（远）
+        {360, 128 * 1024},      // 毫秒轨迹（近）
+        {360, 192 * 1024},      // 毫秒针
+    };
+    constexpr uint32_t SPRITE_END {sdram_map::SPRITES_END};
+    static_assert([] {
+        uint32_t total = 0;
+        for (const HandSprites& h : HAND_SPRITES) total += h.budget;
+        return SPRITE_BASE + total <= SPRITE_END;
+    }(), "hand sprite budgets overlap the SDRAM self-test window");
+
+    uint8_t* sprite_storage(uint8_t hand) {
+        uint32_t offset = 0;
+        for (uint8_t i = 0; i < hand; i++) {
+            offset += HAND_SPRITES[i].budget;
+        }
+        return (uint8_t*)(SPRITE_BASE + offset);
+    }
+
+    const char* const QUALITY_NAMES[] = {"full", "no-trails", "no-aa", "slow-hands"};
+    
+    // 配色
+    const uint16_t INK = ST7789::rgb_to_rgb565(12, 12, 12);
+    const uint16_t ROSE_GOLD = ST7789::rgb_to_rgb565(220, 150, 130);
+    const uint16_t CHAMPAGNE = ST7789::rgb_to_rgb565(200, 170, 120);
+    const uint16_t SILVER = ST7789::rgb_to_rgb565(180, 180, 180);
+    const uint16_t PEARL = ST7789::rgb_to_rgb565(240, 235, 230);
+    const uint16_t DARK_GOLD = ST7789::rgb_to_rgb565(120, 100, 80);
+
+    // 表盘图片（assets/dial_face.png，由tools/imgconv.py压缩）：8 KB代替134 KB原始RGB565
+    static_assert(gfx::images::dial_face.width == 240 && gfx::images::dial_face.height == 280,
+                  "dial face must cover the panel");
+} // namespace
+
+// SDRAM布局见sdram_map.hpp：[0]帧缓冲 | [1]帧缓冲（8位索引，各占一半槽位） | 静态表盘 | 指针画布RGB565 | 指针画布覆盖率（A8） | ... | 2 MB起：指针精灵
+// 指针在本地坐标中都朝上（-y），由节点旋转角度指向当前时间
 ClockApp::ClockApp(ST7789* lcd)
-    : current_buffer_idx_(0), lcd_(lcd), is_running_(false), 
-      elapsed_ms_(0), last_update_tick_(0), last_cpu_calc_tick_(0),
-      busy_time_us_(0), cpu_usage_(0.0f) {
-    // 使用SDRAM的三个缓冲区
-    buffer_[0] = (uint16_t*)0xC0000000;
-    buffer_[1] = (uint16_t*)(0xC0000000 + WIDTH * HEIGHT * 2);
-    static_dial_ = (uint16_t*)(0xC0000000 + WIDTH * HEIGHT * 4);  // 第3块buffer
+    : frame_{(uint8_t*)sdram_map::FRAME0, (uint8_t*)sdram_map::FRAME1},
+      current_buffer_idx_(0), written_(), accel_(gfx::Backend::Dma2d),
+      static_dial_((uint16_t*)sdram_map::STATIC_DIAL),
+      dial_layer_({0, 0, WIDTH, HEIGHT}, static_dial_, WIDTH),
+      readout_layer_({READOUT_X, READOUT_Y, READOUT_W, READOUT_H}, readout_pixels, READOUT_W),
+      fast_layer_({0, 0, WIDTH, HEIGHT}, fast_pixels, fast_coverage, 255, FAST_SHIFT),
+      hand_layer_({0, 0, WIDTH, HEIGHT}, (uint16_t*)sdram_map::HAND_PIXELS,
+                  (uint8_t*)sdram_map::HAND_COVERAGE),
+      hud_layer_({HUD_X, HUD_Y, HUD_W, HUD_H}, hud_pixels, hud_coverage, HUD_ALPHA),
+      compositor_(WIDTH, HEIGHT, 2),
+      fast_scene_(&fast_layer_, &compositor_), hand_scene_(&hand_layer_, &compositor_), hud_scene_(&hud_layer_, &compositor_),
+      sec_hand_(0, 0, 0, -88, 3, ROSE_GOLD),
+      min_hand_(0, 0, 0, -70, 5, CHAMPAGNE),
+      ms_trail_{{0, 0, 0, -42.5f, SILVER}, {0, 0, 0, -40, SILVER}},   // 半分辨率画布上的尺寸
+      ms_hand_(0, 0, 0, -45, 1.5f, SILVER),
+      hand_cache_{{sprite_storage(SEC), HAND_SPRITES[SEC].budget},
+                  {sprite_storage(MIN), HAND_SPRITES[MIN].budget},
+                  {sprite_storage(TRAIL_FAR), HAND_SPRITES[TRAIL_FAR].budget},
+                  {sprite_storage(TRAIL_NEAR), HAND_SPRITES[TRAIL_NEAR].budget},
+                  {sprite_storage(MS), HAND_SPRITES[MS].budget}},
+      hand_sprite_{{hand_cache_[SEC], ROSE_GOLD}, {hand_cache_[MIN], CHAMPAGNE},
+                   {hand_cache_[TRAIL_FAR], SILVER}, {hand_cache_[TRAIL_NEAR], SILVER},
+                   {hand_cache_[MS], SILVER}},
+      hub_(5, ROSE_GOLD), hub_cap_(3, PEARL),
+      hud_track_(0, 0, HUD_LEN, 0, HUD_BAR, DARK_GOLD),
+      hud_fill_(0, 0, 0, 0, HUD_BAR, ROSE_GOLD),
+      fps_text_(gfx::fonts::stroke20, "", PEARL), cpu_text_(gfx::fonts::stroke20, "", PEARL),
+      readout_cache_(readout_cells, READOUT_CELLS), readout_text_(), readout_x0_(0),
+      lcd_(lcd), idle_task_(nullptr), is_running_(false), 
+      elapsed_cycles_(0), last_update_cycles_(0), frame_us_(0), late_latch_(false), render_cycles_(0),
+      latch_stats_(), last_error_us_(0), have_last_error_(false), cpu_window_start_(0),
+      busy_time_us_(0), frames_sent_(0), cpu_usage_(0.0f),
+      governor_(FRAME_MS * 1000, QUALITY_COUNT), pacer_(lcd->panel()), pacing_(false), profile_report_(false) {
+    static_assert((WIDTH >> FAST_SHIFT) * (HEIGHT >> FAST_SHIFT) <= FAST_PIXELS, "fast canvas too small");
+    
+    // 从下到上：表盘、读数、毫秒针、秒针分针、HUD
+    compositor_.add_layer(&dial_layer_);
+    compositor_.add_layer(&readout_layer_);
+    compositor_.add_layer(&fast_layer_);
+    compositor_.add_layer(&hand_layer_);
+    compositor_.add_layer(&hud_layer_);
+    fast_layer_.clear();
+    hand_layer_.clear();
+    hud_layer_.clear();
+    
+    // 指针形状（精灵缓存的来源，缓存放不下时直接用于场景），场景在build_hand_sprites()中组建
+    // 毫秒针和轨迹在半分辨率画布的坐标系里，圆心也要缩小
+    for (uint8_t h = 0; h < HAND_COUNT; h++) {
+        const uint8_t shift = hand_canvas((Hand)h).scale_shift();
+        hand_shape((Hand)h)->set_position(CENTER_X >> shift, CENTER_Y >> shift);
+    }
+    hub_.set_position(CENTER_X, CENTER_Y);
+    hub_cap_.set_position(CENTER_X, CENTER_Y);
+    ms_trail_[0].set_alpha(100);  // 轨迹：半透明细线
+    ms_trail_[1].set_alpha(50);
+    hand_sprite_[TRAIL_NEAR].set_alpha(100);
+    hand_sprite_[TRAIL_FAR].set_alpha(50);
+    
+    // HUD场景：上面一行统计文字，底部进度条（底槽 + 已走过的部分）
+    const int16_t bar_x = HUD_X + (int16_t)(HUD_BAR / 2);
+    const int16_t bar_y = HUD_Y + HUD_H - 4;
+    hud_track_.set_position(bar_x, bar_y);
+    hud_fill_.set_position(bar_x, bar_y);
+    fps_text_.set_position(HUD_X, HUD_Y);
+    cpu_text_.set_position(HUD_X, HUD_Y);
+    hud_scene_.add(&hud_track_);
+    hud_scene_.add(&hud_fill_);
+    hud_scene_.add(&fps_text_);
+    hud_scene_.add(&cpu_text_);
+    
+    // 读数：数字和分隔符只在这里解码一次（已用表盘底色预合成）
+    // 字形单元由DMA2D拷贝到读数面板，和CPU画指针并行（合成前等待）
+    fastmem::fill16(readout_pixels, INK, READOUT_W * READOUT_H);
+    readout_cache_.set_accel(&accel_);
+    if (!readout_cache_.build(gfx::fonts::stroke20, "0123456789:.", CHAMPAGNE, INK)) {
+        printf("[WAT] Readout glyph cache too small, falling back to blending\r\n");
+    }
     
-    printf("[WAT] Buffers: [0]=0x%08X [1]=0x%08X Static=0x%08X\r\n",
-           (unsigned int)buffer_[0], (unsigned int)buffer_[1], (unsigned int)static_dial_);
+    printf("[WAT] Buffers: [0]=0x%08X [1]=0x%08X Static=0x%08X Hands=0x%08X Fast=0x%08X (1/%u)\r\n",
+           (unsigned int)frame_[0], (unsigned int)frame_[1], (unsigned int)static_dial_,
+           (unsigned int)hand_layer_.pixels(), (unsigned int)fast_layer_.pixels(), (unsigned int)(1u << (2 * FAST_SHIFT)));
+}
+
+void ClockApp::set_idle_task(IdleTask task) {
+    idle_task_ = task;
+}
+
+bool ClockApp::attach_te(GPIO_TypeDef* port, uint16_t pin) {
+    return pacer_.attach_te(port, pin);
+}
+
+void ClockApp::set_frame_pacing(bool on) {
+    pacing_ = on;
+}
+
+void ClockApp::set_late_latch(bool on) {
+    late_latch_ = on;
+    have_last_error_ = false;
+}
+
+void ClockApp::set_profile_report(bool on) {
+    profile_report_ = on;
 }
 
 void ClockApp::start() {
     if (!is_running_) {
         is_running_ = true;
-        last_update_tick_ = HAL_GetTick();
+        last_update_cycles_ = timebase::cycles();
         printf("[WAT] Started\r\n");
     }
 }
 
 void ClockApp::stop() {
     if (is_running_) {
+        advance_clock();
         is_running_ = false;
         printf("[WAT] Stopped at %u.%03u s\r\n", 
-               (unsigned int)(elapsed_ms_ / 1000), 
-               (unsigned int)(elapsed_ms_ % 1000));
+               (unsigned int)(elapsed_ms() / 1000), 
+               (unsigned int)(elapsed_ms() % 1000));
     }
 }
 
 void ClockApp::reset() {
-    elapsed_ms_ = 0;
-    last_update_tick_ = HAL_GetTick();
+    elapsed_cycles_ = 0;
+    last_update_cycles_ = timebase::cycles();
     printf("[WAT] Reset\r\n");
 }
 
-int16_t ClockApp::get_sin(uint16_t angle) {
-    angle = angle % 360;
-    uint16_t index = angle / 6;
-    return sin_table[index];
+void ClockApp::advance_clock() {
+    const uint64_t now = timebase::cycles();
+    if (is_running_) {
+        elapsed_cycles_ += now - last_update_cycles_;
+    }
+    last_update_cycles_ = now;
 }
 
-int16_t ClockApp::get_cos(uint16_t angle) {
-    return get_sin(angle + 90);
+// 这一帧的变化行扫描到一半的时刻：节拍模式由扫描位置算出，否则按上一条链表发送到一半估计
+uint32_t ClockApp::predict_lead(uint64_t latch) const {
+    if (pacing_) {
+        return (uint32_t)(pacer_.predict_scanout(latch + render_cycles_) - latch);
+    }
+    return render_cycles_ + lcd_->last_list_stats().total_cycles / 2;
 }
 
-void ClockApp::set_pixel(uint16_t* fb, uint16_t x, uint16_t y, uint16_t color) {
-    if (x >= WIDTH || y >= HEIGHT) return;
-    fb[y * WIDTH + x] = color;
+// 误差 = 画面时间 - 上屏时刻的真实时间；相邻两帧误差之差就是画面运动的不均匀（抖动）
+void ClockApp::record_present(uint64_t latch, uint64_t present) {
+    if (!is_running_) {
+        have_last_error_ = false;
+        return;
+    }
+    const uint64_t true_us = timebase::to_us(elapsed_cycles_ + (present - latch));
+    const int32_t error_us = (int32_t)((int64_t)frame_us_ - (int64_t)true_us);
+    latch_stats_.frames++;
+    latch_stats_.lead_us_sum += (uint32_t)(frame_us_ - timebase::to_us(elapsed_cycles_));
+    latch_stats_.error_us_sum += (uint32_t)(error_us < 0 ? -error_us : error_us);
+    if (have_last_error_) {
+        const int32_t step = error_us - last_error_us_;
+        const uint32_t jitter = (uint32_t)(step < 0 ? -step : step);
+        latch_stats_.jitter_us_sum += jitter;
+        if (jitter > latch_stats_.jitter_us_max) {
+            latch_stats_.jitter_us_max = jitter;
+        }
+    }
+    last_error_us_ = error_us;
+    have_last_error_ = true;
 }
 
-// RGB565颜色混合（alpha: 0-255）
-uint16_t ClockApp::blend_color(uint16_t fg, uint16_t bg, uint8_t alpha) {
-    if (alpha == 255) return fg;
-    if (alpha == 0) return bg;
-    
-    // 解码RGB565
-    uint8_t fg_r = (fg >> 11) & 0x1F;
-    uint8_t fg_g = (fg >> 5) & 0x3F;
-    uint8_t fg_b = fg & 0x1F;
-    
-    uint8_t bg_r = (bg >> 11) & 0x1F;
-    uint8_t bg_g = (bg >> 5) & 0x3F;
-    uint8_t bg_b = bg & 0x1F;
+// 解码静态表盘图片（只调用一次）
+void ClockApp::render_static_dial() {
+    printf("[WAT] Decoding static dial...\r\n");
+    
+    const gfx::Image& dial = gfx::images::dial_face;
+    uint32_t start = DWT->CYCCNT;
+    bool ok = gfx::decode_image(dial, static_dial_, WIDTH);
+    uint32_t decode_cycles = DWT->CYCCNT - start;
+    if (!ok || gfx::image_checksum(static_dial_, WIDTH, HEIGHT, WIDTH) != dial.checksum) {
+        // 图片数据损坏：只保留背景色，指针照常工作
+        printf("[WAT] Dial image corrupt, using plain background\r\n");
+        accel_.fill(static_dial_, WIDTH, WIDTH, HEIGHT, INK);
+        accel_.wait();
+    }
     
-    // Alpha混合
-    uint8_t r = (fg_r * alpha + bg_r * (255 - alpha)) / 255;
-    uint8_t g = (fg_g * alpha + bg_g * (255 - alpha)) / 255;
-    uint8_t b = (fg_b * alpha + bg_b * (255 - alpha)) / 255;
+    // 表盘绘制完成（合成器只读取它），写回一次即可
+    mpu::clean_for_dma(static_dial_, WIDTH * HEIGHT * sizeof(uint16_t));
     
-    return (r << 11) | (g << 5) | b;
+    printf("[WAT] Static dial decoded: %u -> %u bytes in %u us\r\n",
+           (unsigned int)dial.size, (unsigned int)(WIDTH * HEIGHT * sizeof(uint16_t)),
+           (unsigned int)timebase::to_us(decode_cycles));
 }
 
-// 抗锯齿像素（带alpha通道）
-void ClockApp::set_pixel_aa(uint16_t* fb, uint16_t x, uint16_t y, uint16_t color, uint8_t alpha) {
-    if (x >= WIDTH || y >= HEIGHT) return;
-    uint16_t bg = fb[y * WIDTH + x];
-    fb[y * WIDTH + x] = blend_color(color, bg, alpha);
+// 调色板：表盘图片自己的颜色，加上底色到指针/HUD配色的过渡（抗锯齿边缘和半透明HUD落在这些项上）
+void ClockApp::build_palette() {
+    uint32_t start = DWT->CYCCNT;
+    const uint16_t dial_colors = palette_.add_image(static_dial_, FRAME_PIXELS, DIAL_COLORS);
+    const uint16_t accents[] = {ROSE_GOLD, CHAMPAGNE, SILVER, PEARL, DARK_GOLD};
+    bool ok = true;
+    for (uint16_t c : accents) {
+        ok = palette_.add_ramp(INK, c, RAMP_STEPS) && ok;
+    }
+    ok = palette_.add_ramp(DARK_GOLD, ROSE_GOLD, RAMP_STEPS) && ok;     // 进度条
+    if (!ok) {
+        printf("[WAT] Palette full, some blends use the nearest entry\r\n");
+    }
+    palette_.build_inverse(palette_inverse);
+    printf("[WAT] Palette: %u colors (%u from the dial), inverse table built in %u ms\r\n",
+           (unsigned int)palette_.size(), (unsigned int)dial_colors,
+           (unsigned int)(timebase::to_us(DWT->CYCCNT - start) / 1000));
 }
 
-void ClockApp::draw_line(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-    int16_t dx = abs(x1 - x0);
-    int16_t dy = abs(y1 - y0);
-    int16_t sx = x0 < x1 ? 1 : -1;
-    int16_t sy = y0 < y1 ? 1 : -1;
-    int16_t err = dx - dy;
+// 每根指针按量化角度预渲染一次，之后每帧只绘制遮罩（跨度填充 + 边缘混合，无三角运算）
+void ClockApp::build_hand_sprites() {
+    gfx::Node* shapes[HAND_COUNT];
+    for (uint8_t h = 0; h < HAND_COUNT; h++) {
+        shapes[h] = hand_shape((Hand)h);
+    }
     
-    while (true) {
-        set_pixel(fb, x0, y0, color);
-        
-        if (x0 == x1 && y0 == y1) break;
-        
-        int16_t e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t bytes = 0;
+    for (uint8_t h = 0; h < HAND_COUNT; h++) {
+        bool ok = hand_cache_[h].build(*shapes[h], HAND_SPRITES[h].angles, hand_canvas((Hand)h));
+        if (!ok) {
+            printf("[WAT] Hand %u sprites over budget, rasterizing instead\r\n", (unsigned int)h);
         }
+        bytes += hand_cache_[h].bytes_used();
     }
-}
-
-// 简化抗锯齿直线（在普通线条基础上添加边缘柔化）
-void ClockApp::draw_line_aa(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-    // 先绘制实心线条
-    draw_line(fb, x0, y0, x1, y1, color);
-    
-    // 计算垂直方向，在边缘添加半透明像素
-    int16_t dx = x1 - x0;
-    int16_t dy = y1 - y0;
-    float len = sqrtf(dx * dx + dy * dy);
-    if (len < 1) return;
-    
-    // 垂直单位向量
-    float nx = -dy / len;
-    float ny = dx / len;
-    
-    // Bresenham遍历主线，在两侧添加淡化像素
-    int16_t px = x0, py = y0;
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = abs(dx) - abs(dy);
-    
-    while (true) {
-        // 两侧添加30%透明度的边缘像素
-        int16_t ox1 = px + (int16_t)nx;
-        int16_t oy1 = py + (int16_t)ny;
-        int16_t ox2 = px - (int16_t)nx;
-        int16_t oy2 = py - (int16_t)ny;
-        
-        set_pixel_aa(fb, ox1, oy1, color, 80);
-        set_pixel_aa(fb, ox2, oy2, color, 80);
-        
-        if (px == x1 && py == y1) break;
-        
-        int16_t e2 = 2 * err;
-        if (e2 > -abs(dy)) {
-            err -= abs(dy);
-            px += sx;
+    uint32_t build_cycles = DWT->CYCCNT - start;
+    
+    // 每帧节省：同一组角度下逐帧光栅化与精灵绘制的耗时对比（画在指针画布上，之后清空）
+    gfx::Painter painter(hand_layer_.surface(), hand_layer_.coverage_surface(), hand_layer_.bounds());
+    constexpr uint8_t SAMPLES = 36;
+    uint32_t raster_cycles = 0;
+    uint32_t sprite_cycles = 0;
+    for (uint8_t i = 0; i < SAMPLES; i++) {
+        float deg = i * 10.0f + 3.0f;
+        uint32_t t0 = DWT->CYCCNT;
+        for (gfx::Node* shape : shapes) {
+            shape->set_rotation(deg);
+            shape->render(painter);
         }
-        if (e2 < abs(dx)) {
-            err += abs(dx);
-            py += sy;
+        uint32_t t1 = DWT->CYCCNT;
+        for (uint8_t h = 0; h < HAND_COUNT; h++) {
+            hand_cache_[h].draw(painter, CENTER_X, CENTER_Y, deg, SILVER, 255);
         }
+        sprite_cycles += DWT->CYCCNT - t1;
+        raster_cycles += t1 - t0;
+        hand_layer_.clear();
+    }
+    
+    printf("[WAT] Hand sprites: %u KB, %u/%u/%u angles (sec/min/ms), built in %u ms | "
+           "hands %u us rasterized -> %u us sprites per frame\r\n",
+           (unsigned int)(bytes / 1024), (unsigned int)hand_cache_[SEC].angles(),
+           (unsigned int)hand_cache_[MIN].angles(), (unsigned int)hand_cache_[MS].angles(),
+           (unsigned int)(timebase::to_us(build_cycles) / 1000),
+           (unsigned int)(timebase::to_us(raster_cycles) / SAMPLES), (unsigned int)(timebase::to_us(sprite_cycles) / SAMPLES));
+    
+    // 指针场景（后加入的画在上面）：毫秒轨迹、毫秒针在半分辨率场景；秒针、分针、中心装饰在指针场景
+    for (uint8_t h = 0; h < HAND_COUNT; h++) {
+        gfx::Node* node = hand_cache_[h].ready() ? (gfx::Node*)&hand_sprite_[h] : shapes[h];
+        node->set_position(shapes[h]->x(), shapes[h]->y());
+        (is_fast((Hand)h) ? fast_scene_ : hand_scene_).add(node);
     }
+    hand_scene_.add(&hub_);
+    hand_scene_.add(&hub_cap_);
 }
 
-void ClockApp::draw_thick_line(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t thickness, uint16_t color) {
-    for (uint16_t t = 0; t < thickness; t++) {
-        int16_t offset = t - thickness / 2;
-        int16_t dx = x1 - x0;
-        int16_t dy = y1 - y0;
-        float len = sqrt(dx * dx + dy * dy);
-        if (len == 0) continue;
-        
-        int16_t ox = (int16_t)(-dy * offset / len);
-        int16_t oy = (int16_t)(dx * offset / len);
-        
-        draw_line(fb, x0 + ox, y0 + oy, x1 + ox, y1 + oy, color);
+gfx::Node* ClockApp::hand_shape(Hand hand) {
+    switch (hand) {
+        case SEC: return &sec_hand_;
+        case MIN: return &min_hand_;
+        case TRAIL_FAR: return &ms_trail_[1];
+        case TRAIL_NEAR: return &ms_trail_[0];
+        default: return &ms_hand_;
     }
 }
 
-// 抗锯齿粗线条（简化版：普通粗线+边缘柔化）
-void ClockApp::draw_thick_line_aa(uint16_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t thickness, uint16_t color) {
-    if (thickness == 1) {
-        draw_line_aa(fb, x0, y0, x1, y1, color);
-        return;
-    }
-    
-    int16_t dx = x1 - x0;
-    int16_t dy = y1 - y0;
-    float len = sqrtf(dx * dx + dy * dy);
-    if (len == 0) return;
-    
-    // 垂直方向单位向量
-    float nx = -dy / len;
-    float ny = dx / len;
-    
-    // 绘制实心粗线（中间部分）
-    for (int16_t t = 0; t < thickness; t++) {
-        float offset = t - thickness / 2.0f + 0.5f;
-        int16_t ox = (int16_t)(nx * offset);
-        int16_t oy = (int16_t)(ny * offset);
-        draw_line(fb, x0 + ox, y0 + oy, x1 + ox, y1 + oy, color);
-    }
-    
-    // 在外侧边缘添加半透明柔化
-    float edge_offset1 = thickness / 2.0f + 0.5f;
-    float edge_offset2 = -thickness / 2.0f - 0.5f;
-    
-    int16_t ox1 = (int16_t)(nx * edge_offset1);
-    int16_t oy1 = (int16_t)(ny * edge_offset1);
-    int16_t ox2 = (int16_t)(nx * edge_offset2);
-    int16_t oy2 = (int16_t)(ny * edge_offset2);
-    
-    // 边缘线用60%透明度
-    int16_t px = x0, py = y0;
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = abs(dx) - abs(dy);
-    
-    while (true) {
-        set_pixel_aa(fb, px + ox1, py + oy1, color, 100);
-        set_pixel_aa(fb, px + ox2, py + oy2, color, 100);
-        
-        if (px == x1 && py == y1) break;
-        
-        int16_t e2 = 2 * err;
-        if (e2 > -abs(dy)) {
-            err -= abs(dy);
-            px += sx;
-        }
-        if (e2 < abs(dx)) {
-            err += abs(dx);
-            py += sy;
-        }
+// 缓存可用时转动精灵节点（角度按缓存步长量化），否则转动形状节点
+void ClockApp::set_hand(Hand hand, float degrees) {
+    if (hand_cache_[hand].ready()) {
+        hand_sprite_[hand].set_rotation(degrees);
+    } else {
+        hand_shape(hand)->set_rotation(degrees);
     }
 }
 
-void ClockApp::draw_circle(uint16_t* fb, uint16_t cx, uint16_t cy, uint16_t r, uint16_t color) {
-    int16_t x = r;
-    int16_t y = 0;
-    int16_t err = 0;
-    
-    while (x >= y) {
-        set_pixel(fb, cx + x, cy + y, color);
-        set_pixel(fb, cx + y, cy + x, color);
-        set_pixel(fb, cx - y, cy + x, color);
-        set_pixel(fb, cx - x, cy + y, color);
-        set_pixel(fb, cx - x, cy - y, color);
-        set_pixel(fb, cx - y, cy - x, color);
-        set_pixel(fb, cx + y, cy - x, color);
-        set_pixel(fb, cx + x, cy - y, color);
-        
-        if (err <= 0) {
-            y += 1;
-            err += 2 * y + 1;
-        }
-        if (err > 0) {
-            x -= 1;
-            err -= 2 * x + 1;
-        }
+// 降级的效果都只是节点状态：隐藏/关闭抗锯齿的节点由场景按脏区重画
+void ClockApp::apply_quality() {
+    const uint8_t q = governor_.level();
+    const bool trails = q < Q_NO_TRAILS;
+    const bool aa = q < Q_NO_AA;
+    for (uint8_t h = 0; h < HAND_COUNT; h++) {
+        const bool visible = trails || (h != TRAIL_FAR && h != TRAIL_NEAR);
+        hand_sprite_[h].set_visible(visible);
+        hand_shape((Hand)h)->set_visible(visible);
+        hand_sprite_[h].set_antialias(aa);
+        hand_shape((Hand)h)->set_antialias(aa);
     }
+    hub_.set_antialias(aa);
+    hub_cap_.set_antialias(aa);
 }
 
-void ClockApp::fill_circle(uint16_t* fb, uint16_t cx, uint16_t cy, uint16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        for (int16_t x = -r; x <= r; x++) {
-            if (x * x + y * y <= r * r) {
-                set_pixel(fb, cx + x, cy + y, color);
-            }
-        }
-    }
+// 只修改节点状态，角度不变的节点不会产生脏区
+void ClockApp::update_scene() {
+    // 降级时慢指针（秒针、进度条）按SLOW_HAND_MS步进，毫秒针仍然每帧更新
+    const uint32_t frame_ms = (uint32_t)(frame_us_ / 1000);
+    const uint32_t slow_ms = (governor_.level() >= Q_SLOW_HANDS) ? frame_ms - frame_ms % SLOW_HAND_MS
+                                                                   : frame_ms;
+    float sec_deg = (slow_ms % 60000) * 360.0f / 60000.0f;
+    float ms_deg = (uint32_t)(frame_us_ % 1000000) * 360.0f / 1000000.0f;
+    set_hand(SEC, sec_deg);
+    set_hand(MIN, (frame_ms / 1000) * 6.0f);      // 跳动形式
+    set_hand(MS, ms_deg);
+    set_hand(TRAIL_NEAR, ms_deg - 2.86f);         // 向后偏移（0.05 rad）
+    set_hand(TRAIL_FAR, ms_deg - 5.73f);
+    
+    // 进度条按整像素变化
+    int16_t fill = (int16_t)((slow_ms % 60000) * (uint32_t)HUD_LEN / 60000);
+    hud_fill_.set_points(0, 0, fill, 0);
 }
 
-// 预渲染静态表盘（只调用一次）
-void ClockApp::render_static_dial() {
-    printf("[WAT] Rendering static dial...\r\n");
-    
-    // 1. 填充背景（深墨黑）
-    uint16_t bg_color = ST7789::rgb_to_rgb565(12, 12, 12);
-    uint32_t bg_color32 = (bg_color << 16) | bg_color;
-    uint32_t* ptr32 = (uint32_t*)static_dial_;
-    for (uint32_t i = 0; i < (WIDTH * HEIGHT) / 2; i++) {
-        ptr32[i] = bg_color32;
+// 读数面板由字形单元拼成，只把内容变化的字符交给合成器（通常只有毫秒的后两位）
+gfx::Rect ClockApp::update_readout() {
+    char text[sizeof(readout_text_)];
+    const uint32_t frame_ms = (uint32_t)(frame_us_ / 1000);
+    snprintf(text, sizeof(text), "%02u:%02u.%03u",
+             (unsigned int)((frame_ms / 60000) % 100),
+             (unsigned int)((frame_ms / 1000) % 60),
+             (unsigned int)(frame_ms % 1000));
+    if (strcmp(text, readout_text_) == 0) {
+        return {0, 0, 0, 0};
     }
     
-    // 2. 绘制表盘装饰圈（香槟金）
-    for (uint8_t i = 0; i < 3; i++) {
-        draw_circle(static_dial_, CENTER_X, CENTER_Y, RADIUS + i, ST7789::rgb_to_rgb565(200, 170, 120));
-    }
-    for (uint8_t i = 0; i < 2; i++) {
-        draw_circle(static_dial_, CENTER_X, CENTER_Y, RADIUS - 5 + i, ST7789::rgb_to_rgb565(150, 130, 100));
-    }
+    const gfx::Font& font = gfx::fonts::stroke20;
+    const int16_t x0 = (READOUT_W - font.measure(text)) / 2;
+    const gfx::Surface565 panel(readout_pixels, READOUT_W, READOUT_H, READOUT_W, READOUT_X, READOUT_Y);
     
-    // 3. 60个刻度（抗锯齿）
-    for (uint8_t i = 0; i < 60; i++) {
-        float angle_rad = (i * 6.0f - 90.0f) * 3.14159f / 180.0f;
-        uint16_t color;
-        uint16_t thickness;
-        int16_t inner_radius;
-        
-        if (i % 5 == 0) {
-            // 大刻度（玫瑰金，加粗到4px）
-            color = ST7789::rgb_to_rgb565(220, 150, 130);
-            thickness = 4;
-            inner_radius = RADIUS - 15;
-        } else {
-            // 小刻度（暗金，加粗到2px）
-            color = ST7789::rgb_to_rgb565(120, 100, 80);
-            thickness = 2;
-            inner_radius = RADIUS - 8;
+    // 只拷贝变化的字符；居中位置变了（字距不同）就整行重画
+    const bool moved = x0 != readout_x0_;
+    if (moved) {
+        accel_.fill(readout_pixels, READOUT_W, READOUT_W, READOUT_H, INK);
+    }
+    gfx::Rect damage = {0, 0, 0, 0};
+    int16_t pen = x0;
+    bool same_prefix = !moved;
+    for (uint8_t i = 0; text[i] != '\0'; i++) {
+        const gfx::GlyphInfo* g = font.find((uint8_t)text[i]);
+        uint8_t advance = g ? g->advance : 0;
+        same_prefix = same_prefix && readout_text_[i] != '\0';
+        if (!same_prefix || text[i] != readout_text_[i]) {
+            const char glyph[2] = {text[i], '\0'};
+            readout_cache_.draw(panel, READOUT_X + pen, READOUT_Y, glyph);
+            damage = damage.united({(int16_t)(READOUT_X + pen), READOUT_Y, advance, READOUT_H});
         }
-        
-        int16_t x1 = CENTER_X + (int16_t)(inner_radius * cosf(angle_rad));
-        int16_t y1 = CENTER_Y + (int16_t)(inner_radius * sinf(angle_rad));
-        int16_t x2 = CENTER_X + (int16_t)((RADIUS - 2) * cosf(angle_rad));
-        int16_t y2 = CENTER_Y + (int16_t)((RADIUS - 2) * sinf(angle_rad));
-        
-        draw_thick_line_aa(static_dial_, x1, y1, x2, y2, thickness, color);
+        pen += advance;
     }
-    
-    printf("[WAT] Static dial rendered!\r\n");
+    if (moved) {
+        damage = {READOUT_X, READOUT_Y, READOUT_W, READOUT_H};
+    }
+    readout_x0_ = x0;
+    strcpy(readout_text_, text);
+    compositor_.damage(damage);
+    return damage;
 }
 
-// 只绘制指针到缓冲区（基于静态表盘）
-void ClockApp::draw_pointers_only(uint16_t* fb) {
-    // 1. 从静态表盘快速复制（使用memcpy，编译器优化）
-    uint32_t copy_start = DWT->CYCCNT;
-    memcpy(fb, static_dial_, WIDTH * HEIGHT * sizeof(uint16_t));
-    uint32_t copy_end = DWT->CYCCNT;
-    uint32_t copy_cycles = copy_end - copy_start;
-    
-    // 2. 秒针（玫瑰金，长，3px）
-    uint32_t ptr_start = DWT->CYCCNT;
-    float sec_angle_rad = ((elapsed_ms_ % 60000) * 360.0f / 60000.0f - 90.0f) * 3.14159f / 180.0f;
-    int16_t sec_x = CENTER_X + (int16_t)(88 * cosf(sec_angle_rad));
-    int16_t sec_y = CENTER_Y + (int16_t)(88 * sinf(sec_angle_rad));
-    draw_thick_line_aa(fb, CENTER_X, CENTER_Y, sec_x, sec_y, 3, ST7789::rgb_to_rgb565(220, 150, 130));
-    
-    // 3. 分钟指针（香槟金，中，5px）- 跳动形式
-    uint32_t total_seconds = elapsed_ms_ / 1000;
-    float min_angle_rad = (total_seconds * 6.0f - 90.0f) * 3.14159f / 180.0f;
-    int16_t min_x = CENTER_X + (int16_t)(70 * cosf(min_angle_rad));
-    int16_t min_y = CENTER_Y + (int16_t)(70 * sinf(min_angle_rad));
-    draw_thick_line_aa(fb, CENTER_X, CENTER_Y, min_x, min_y, 5, ST7789::rgb_to_rgb565(200, 170, 120));
-    
-    // 4. 毫秒指针（银灰，3px粗，带运动模糊轨迹）
-    float ms_angle_rad = ((elapsed_ms_ % 1000) * 360.0f / 1000.0f - 90.0f) * 3.14159f / 180.0f;
-    
-    // 绘制3帧运动模糊轨迹（减少撕裂感）
-    uint16_t ms_color = ST7789::rgb_to_rgb565(180, 180, 180);
-    for (int8_t trail = 2; trail >= 0; trail--) {
-        float trail_angle = ms_angle_rad - (trail * 0.05f); // 向后偏移
-        int16_t trail_len = 90 - trail * 5; // 渐短
-        int16_t trail_x = CENTER_X + (int16_t)(trail_len * cosf(trail_angle));
-        int16_t trail_y = CENTER_Y + (int16_t)(trail_len * sinf(trail_angle));
-        
-        if (trail == 0) {
-            // 主指针：实心3px
-            draw_thick_line_aa(fb, CENTER_X, CENTER_Y, trail_x, trail_y, 3, ms_color);
-        } else {
-            // 轨迹：半透明细线
-            uint8_t alpha = (3 - trail) * 50; // 50, 100透明度
-            int16_t px = CENTER_X, py = CENTER_Y;
-            int16_t dx = trail_x - CENTER_X;
-            int16_t dy = trail_y - CENTER_Y;
-            int16_t sx = (dx > 0) ? 1 : -1;
-            int16_t sy = (dy > 0) ? 1 : -1;
-            int16_t err = abs(dx) - abs(dy);
-            
-            while (true) {
-                set_pixel_aa(fb, px, py, ms_color, alpha);
-                if (px == trail_x && py == trail_y) break;
-                
-                int16_t e2 = 2 * err;
-                if (e2 > -abs(dy)) {
-                    err -= abs(dy);
-                    px += sx;
-                }
-                if (e2 < abs(dx)) {
-                    err += abs(dx);
-                    py += sy;
-                }
-            }
-        }
+bool ClockApp::render_frame(uint8_t idx) {
+    // 1. 场景帧处理：只重画变化的区域，并把脏区交给合成器
+    //    读数先更新：字形单元的DMA2D拷贝在CPU画指针的同时进行，合成读取读数面板前等它完成
+    uint32_t scene_start = DWT->CYCCNT;
+    const gfx::Rect readout = update_readout();
+    gfx::Rect changed = fast_scene_.update().united(hand_scene_.update()).united(hud_scene_.update())
+                            .united(readout);
+    accel_.wait();
+    uint32_t scene_cycles = DWT->CYCCNT - scene_start;
+    if (changed.empty()) {
+        // 屏幕上的帧已经是最新状态：不合成、不发送
+        return false;
     }
-    uint32_t ptr_end = DWT->CYCCNT;
-    uint32_t ptr_cycles = ptr_end - ptr_start;
     
-    // 5. 中心装饰（玫瑰金+珍珠白）
-    uint32_t circle_start = DWT->CYCCNT;
-    fill_circle(fb, CENTER_X, CENTER_Y, 5, ST7789::rgb_to_rgb565(220, 150, 130));
-    fill_circle(fb, CENTER_X, CENTER_Y, 3, ST7789::rgb_to_rgb565(240, 235, 230));
-    uint32_t circle_end = DWT->CYCCNT;
-    uint32_t circle_cycles = circle_end - circle_start;
+    // 2. 合成：只重画该缓冲区自上次合成以来的脏区，每行量化成调色板索引
+    //    发送时由CPU查表展开（读的是缓存里的数据），所以索引帧不需要清理D-Cache
+    uint32_t compose_start = DWT->CYCCNT;
+    compositor_.compose(idx, gfx::SurfaceI8(frame_[idx], WIDTH, HEIGHT, WIDTH), palette_, &written_);
+    uint32_t compose_cycles = DWT->CYCCNT - compose_start;
     
     // 每100帧打印一次性能分析
     static uint32_t frame_count = 0;
     if (++frame_count >= 100) {
-        printf("[PERF] Copy: %u us | Pointers: %u us | Circles: %u us | Total: %u us\r\n",
-               (unsigned int)(copy_cycles / 480),
-               (unsigned int)(ptr_cycles / 480),
-               (unsigned int)(circle_cycles / 480),
-               (unsigned int)((copy_cycles + ptr_cycles + circle_cycles) / 480));
+        const ST7789::ListStats& spi = lcd_->last_list_stats();
+        printf("[PERF] Scene: %u us (%u nodes) | Compose: %u px %u us | Total: %u us (%s)"
+               " | SPI: %u px in %u rects %u us, gap %u us\r\n",
+               (unsigned int)timebase::to_us(scene_cycles),
+               (unsigned int)(fast_scene_.last_rendered() + hand_scene_.last_rendered() + hud_scene_.last_rendered()),
+               (unsigned int)compositor_.last_pixels(),
+               (unsigned int)timebase::to_us(compose_cycles),
+               (unsigned int)timebase::to_us(scene_cycles + compose_cycles),
+               mpu::profile_name(),
+               (unsigned int)spi.pixels,
+               (unsigned int)spi.elements,
+               (unsigned int)timebase::to_us(spi.total_cycles),
+               (unsigned int)timebase::to_us(spi.gap_cycles));
         frame_count = 0;
     }
+    return true;
+}
+
+// 双缓冲下写过的区域 ⊇ 屏幕上一帧以来的变化，屏幕其余部分已经是最新的，不用重发
+// 合成后整个缓冲区都是当前帧，所以可以把列扩到8像素对齐：展开后的行缓冲DMA走突发读
+uint8_t ClockApp::build_transfers(uint8_t idx, ST7789::Transfer* list) const {
+    const uint8_t* frame = frame_[idx];
+    for (uint8_t i = 0; i < written_.count; i++) {
+        const gfx::Rect& r = written_.rects[i];
+        const uint16_t x0 = (uint16_t)(r.x & ~7);
+        uint16_t x1 = (uint16_t)((r.right() + 7) & ~7);
+        if (x1 > WIDTH) x1 = WIDTH;
+        const uint16_t w = x1 - x0;
+        // 整行宽的区域在缓冲区中连续，按大块发送；否则逐行发送
+        list[i] = {x0, (uint16_t)r.y, (uint16_t)(x1 - 1), (uint16_t)(r.bottom() - 1),
+                   frame + (uint32_t)r.y * WIDTH + x0, (uint32_t)w * r.h,
+                   (uint16_t)(w == WIDTH ? 0 : WIDTH), ST7789::TX_WINDOW, palette_.colors()};
+    }
+    return written_.count;
+}
+
+// 帧节拍：等上一条链表发完（它的耗时用来预测这一条），再等到扫描线不会穿过这些行的时刻
+uint32_t ClockApp::pace(const ST7789::Transfer* list, uint8_t count, uint64_t input) {
+    const uint64_t wait_start = timebase::cycles();
+    while (lcd_->is_busy()) {
+    }
+    const ST7789::ListStats& spi = lcd_->last_list_stats();
+    pacer_.record_transfer(spi.pixels, spi.elements, spi.total_cycles, spi.gap_cycles);
+    
+    uint16_t y0 = HEIGHT;
+    uint16_t y1 = 0;
+    uint32_t pixels = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        y0 = list[i].y0 < y0 ? list[i].y0 : y0;
+        y1 = list[i].y1 > y1 ? list[i].y1 : y1;
+        pixels += list[i].count;
+    }
+    timebase::wait_until(pacer_.schedule(y0, y1, pixels, count, input));
+    return (uint32_t)(timebase::cycles() - wait_start);
 }
 
-void ClockApp::draw_to_buffer(uint16_t* fb) {
-    // 兼容旧接口：直接调用优化版本
-    draw_pointers_only(fb);
+// 在帧缓冲区窗口（sdram_map的帧区域）的三种MPU属性下渲染同一段动画：场景、合成、链表发送，
+// 和主循环的路径相同。帧循环里没有DMA读写这个窗口（索引帧由CPU展开，表盘和指针画布只有CPU访问），
+// 所以可以在运行时切换属性；结束后恢复编译时选择的配置
+void ClockApp::compare_mpu_profiles() {
+    constexpr uint16_t FRAMES {200};
+    constexpr uint64_t STEP_US {FRAME_MS * 1000 + 37};     // 不是整10毫秒：读数的末位也在变，和实际运行一样
+    constexpr mpu::Profile PROFILES[] {mpu::Profile::WriteBack, mpu::Profile::FramebufferWriteThrough,
+                                       mpu::Profile::FramebufferNonCacheable};
+    for (mpu::Profile profile : PROFILES) {
+        mpu::set_framebuffer_profile(profile);
+        compositor_.damage({0, 0, WIDTH, HEIGHT});    // 每种属性都从一次整屏合成开始
+        uint64_t render_cycles = 0;
+        uint64_t send_cycles = 0;
+        uint32_t pixels = 0;
+        for (uint16_t i = 0; i < FRAMES; i++) {
+            const uint64_t t0 = timebase::cycles();
+            frame_us_ = i * STEP_US;
+            update_scene();
+            if (!render_frame(current_buffer_idx_)) {
+                continue;
+            }
+            const uint64_t t1 = timebase::cycles();
+            ST7789::Transfer list[gfx::DamageList::MAX_RECTS];
+            lcd_->transmit_list(list, build_transfers(current_buffer_idx_, list));
+            while (lcd_->is_busy()) {
+            }
+            render_cycles += t1 - t0;
+            send_cycles += timebase::cycles() - t1;
+            pixels += compositor_.last_pixels();
+            current_buffer_idx_ = 1 - current_buffer_idx_;
+        }
+        printf("[MPU] %s: render %u us + send %u us per frame (%u frames, %u px composed)\r\n",
+               mpu::profile_name(profile), (unsigned int)(timebase::to_us(render_cycles) / FRAMES),
+               (unsigned int)(timebase::to_us(send_cycles) / FRAMES), (unsigned int)FRAMES, (unsigned int)pixels);
+    }
+    mpu::set_framebuffer_profile(mpu::PROFILE);
 }
 
 void ClockApp::run() {
-    printf("[WAT] Stopwatch ready. Auto-started!\r\n");
-    
-    // 自动启动秒表
-    start();
+    printf("[WAT] Stopwatch ready. Auto-started! MPU profile: %s\r\n", mpu::profile_name());
     
-    // 初始化DWT用于微秒级计时
-    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-    DWT->CYCCNT = 0;
-    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    // 64位时基（main里已初始化，重复调用无副作用）：秒表、帧节拍和耗时统计都用它
+    timebase::init();
     
-    // **预渲染静态表盘（只执行一次）**
+    // **解码静态表盘、预渲染指针精灵（只执行一次）**
     render_static_dial();
+    build_palette();
+    build_hand_sprites();
     
-    // 初始显示
-    uint16_t* back_buffer = buffer_[current_buffer_idx_];
-    draw_pointers_only(back_buffer);  // 使用优化版本
+    // 初始显示（第一帧时所有节点都是脏的，会完整合成一次）
     lcd_->fill_screen_dma(ST7789::rgb_to_rgb565(15, 25, 45));
     HAL_Delay(100);
     
-    uint32_t last_draw = HAL_GetTick();
-    last_cpu_calc_tick_ = HAL_GetTick();
+    if (profile_report_) {
+        compare_mpu_profiles();
+    }
+    
+    // 帧间隔和CPU占用率统计窗口都按时基计时（HAL_GetTick只有1 ms分辨率，10 ms帧周期下抖动10%）
+    const uint64_t frame_cycles = timebase::from_us(FRAME_MS * 1000);
+    timebase::Deadline next_draw = timebase::Deadline::after_us(0);
+    cpu_window_start_ = timebase::cycles();
     busy_time_us_ = 0;
+    pacer_.take_refresh();      // 启动期间的刷新不算错过
+    pacer_.reset_window();
+    
+    // 表盘和精灵准备好之后自动启动秒表
+    start();
     
     while (1) {
-        uint32_t now = HAL_GetTick();
-        
         // 更新已过时间
-        if (is_running_) {
-            uint32_t delta = now - last_update_tick_;
-            elapsed_ms_ += delta;
-            last_update_tick_ = now;
-        }
+        advance_clock();
         
-        // 每10ms更新一次显示（100 FPS）
-        if (now - last_draw >= 10) {
-            last_draw = now;
+        // 每10ms更新一次显示（100 FPS）；帧节拍模式下每次屏刷新一帧
+        const bool due = pacing_ ? pacer_.take_refresh() > 0 : next_draw.expired();
+        if (due) {
+            next_draw = timebase::Deadline::at(timebase::cycles() + frame_cycles);
             
             // ===== 开始测量CPU时间 =====
-            uint32_t work_start = DWT->CYCCNT;
+            const uint64_t work_start = timebase::cycles();
+            uint32_t wait_cycles = 0;   // 帧节拍等待，不算CPU忙碌
             
-            // 在后台缓冲区绘制（只绘制指针）
-            back_buffer = buffer_[current_buffer_idx_];
-            draw_pointers_only(back_buffer);  // ⭐ 使用优化版本
+            // 采样画面时间：晚锁存时紧挨着更新场景，外推到预测的上屏时刻
+            const uint64_t latch = timebase::cycles();
+            advance_clock();
+            const uint32_t lead = (late_latch_ && is_running_) ? predict_lead(latch) : 0;
+            frame_us_ = timebase::to_us(elapsed_cycles_ + lead);
             
-            // 使用DMA传输framebuffer（异步）
-            lcd_->transmit_buffer_dma(back_buffer);
+            // 更新场景，只在有变化时合成并发送（停表时不占用CPU和SPI）
+            update_scene();
+            if (render_frame(current_buffer_idx_)) {
+                // 帧预算：本帧渲染耗时和最近完成的一次传输耗时（双缓冲下并行，取较大者）
+                const uint32_t render_us = (uint32_t)timebase::to_us(timebase::cycles() - work_start);
+                const uint32_t transfer_us = (uint32_t)timebase::to_us(lcd_->last_list_stats().total_cycles);
+                if (governor_.report(render_us, transfer_us)) {
+                    printf("[GOV] Quality -> %s (render %u us, transfer %u us, budget %u us)\r\n",
+                           QUALITY_NAMES[governor_.level()], (unsigned int)render_us,
+                           (unsigned int)transfer_us, (unsigned int)governor_.budget_us());
+                    apply_quality();
+                }
+                
+                // 只发送写过的区域（异步；索引帧由CPU在发送中断里查表展开，不用清理D-Cache）
+                ST7789::Transfer list[gfx::DamageList::MAX_RECTS];
+                const uint8_t count = build_transfers(current_buffer_idx_, list);
+                if (count > 0) {
+                    const uint32_t ready = (uint32_t)(timebase::cycles() - latch);
+                    render_cycles_ = render_cycles_ - render_cycles_ / 4 + ready / 4;
+                    if (pacing_) {
+                        wait_cycles = pace(list, count, latch);
+                    }
+                    while (lcd_->is_busy()) {
+                    }
+                    lcd_->transmit_list(list, count);
+                    record_present(latch, pacing_ ? pacer_.last_scanout()
+                                                  : timebase::cycles() + lcd_->last_list_stats().total_cycles / 2);
+                }
+                frames_sent_++;
+                
+                // 切换缓冲区
+                current_buffer_idx_ = 1 - current_buffer_idx_;
+            }
             
             // ===== 结束测量 =====
-            uint32_t work_end = DWT->CYCCNT;
-            uint32_t work_cycles = work_end - work_start;
-            uint32_t work_us = work_cycles / 480;  // 480MHz CPU
+            const uint64_t work_cycles = timebase::cycles() - work_start - wait_cycles;
+            uint32_t work_us = (uint32_t)timebase::to_us(work_cycles);
             busy_time_us_ += work_us;
-            
-            // 切换缓冲区
-            current_buffer_idx_ = 1 - current_buffer_idx_;
         }
         
         // 每秒计算一次CPU占用率
-        if (now - last_cpu_calc_tick_ >= 1000) {
-            uint32_t period_ms = now - last_cpu_calc_tick_;
+        const uint64_t now = timebase::cycles();
+        if (now - cpu_window_start_ >= timebase::from_us(1000000)) {
+            const uint32_t period_us = (uint32_t)timebase::to_us(now - cpu_window_start_);
             
-            // 计算这段时间内实际执行的帧数
-            uint32_t frame_count = period_ms / 10; // 理论帧数（每10ms一帧）
+            // 这段时间内实际发送的帧数（无变化的帧被跳过）
+            uint32_t frame_count = frames_sent_;
             uint32_t avg_frame_us = frame_count > 0 ? (busy_time_us_ / frame_count) : 0;
             
-            // CPU占用率 = (总忙碌微秒 / 周期微秒) * 100
-            //          = (忙碌us / (周期ms * 1000)) * 100
-            //          = (忙碌us * 100) / (周期ms * 1000)
-            //          = 忙碌us / (周期ms * 10)
-            // 为了小数点后1位精度，分子先乘10：
-            uint32_t cpu_percent_x10 = (busy_time_us_ * 10) / (period_ms * 10);
+            // CPU占用率 = (总忙碌微秒 / 周期微秒) * 100，为了小数点后1位精度再乘10
+            uint32_t cpu_percent_x10 = (uint32_t)((uint64_t)busy_time_us_ * 1000 / period_us);
             
             // 额外显示：总忙碌时间（毫秒）
             uint32_t busy_time_ms = busy_time_us_ / 1000;
             
             printf("[WAT] %5u.%03u s | CPU: %2u.%u%% | Draw: %5u us/frame (%u frames) | Busy: %u ms\r\n", 
-                   (unsigned int)(elapsed_ms_ / 1000), 
-                   (unsigned int)(elapsed_ms_ % 1000),
+                   (unsigned int)(elapsed_ms() / 1000), 
+                   (unsigned int)(elapsed_ms() % 1000),
                    (unsigned int)(cpu_percent_x10 / 10),
                    (unsigned int)(cpu_percent_x10 % 10),
                    (unsigned int)avg_frame_us,
                    (unsigned int)frame_count,
                    (unsigned int)busy_time_ms);
+            printf("[GOV] Quality: %s | Misses: %u/%u frames, worst %u us | Total: %u misses in %u frames, %u changes\r\n",
+                   QUALITY_NAMES[governor_.level()],
+                   (unsigned int)governor_.window_misses(),
+                   (unsigned int)frame_count,
+                   (unsigned int)governor_.window_worst_us(),
+                   (unsigned int)governor_.misses(),
+                   (unsigned int)governor_.frames(),
+                   (unsigned int)governor_.changes());
+            governor_.reset_window();
+            if (latch_stats_.frames > 0) {
+                const uint32_t n = latch_stats_.frames;
+                printf("[LATCH] %s | Lead: %u us | Error: %u us avg | Jitter: %u us avg, %u us max (%u frames)\r\n",
+                       late_latch_ ? "late" : "off",
+                       (unsigned int)(latch_stats_.lead_us_sum / n),
+                       (unsigned int)(latch_stats_.error_us_sum / n),
+                       (unsigned int)(latch_stats_.jitter_us_sum / n),
+                       (unsigned int)latch_stats_.jitter_us_max,
+                       (unsigned int)n);
+                latch_stats_ = {};
+            }
+            if (pacing_) {
+                const FramePacer::Stats& timing = pacer_.window();
+                const uint32_t presents = timing.presents ? timing.presents : 1;
+                printf("[PACE] %s, period %u us, %u TE edges | Phase: %u us | Missed vblanks: %u | Tear risks: %u"
+                       " | Input-to-photon: %u us avg, %u us max\r\n",
+                       pacer_.synced() ? "TE" : "timer", (unsigned int)pacer_.period_us(),
+                       (unsigned int)timing.te_edges,
+                       (unsigned int)(timing.phase_us_sum / presents),
+                       (unsigned int)timing.missed,
+                       (unsigned int)timing.tear_risks,
+                       (unsigned int)(timing.latency_us_sum / presents),
+                       (unsigned int)timing.latency_us_max);
+                pacer_.reset_window();
+            }
+            
+            // 屏幕上的统计（HUD文字节点，内容不变时不产生脏区）
+            char stats[16];
+            snprintf(stats, sizeof(stats), "%u FPS", (unsigned int)((uint64_t)frame_count * 1000000 / period_us));
+            fps_text_.set_text(stats);
+            snprintf(stats, sizeof(stats), "%u.%u%% CPU",
+                     (unsigned int)(cpu_percent_x10 / 10), (unsigned int)(cpu_percent_x10 % 10));
+            cpu_text_.set_text(stats);
+            cpu_text_.set_position(HUD_X + HUD_W - cpu_text_.font().measure(stats), HUD_Y);
             
-            last_cpu_calc_tick_ = now;
+            cpu_window_start_ = now;
             busy_time_us_ = 0;
+            frames_sent_ = 0;
+        }
+        
+        // 空闲时间执行后台任务
+        if (idle_task_) {
+            idle_task_();
         }
         
-        HAL_Delay(1);
+        // 最多睡1 ms（帧节拍模式要轮询屏刷新，后台任务要分片运行），到帧时刻提前醒来
+        const uint64_t wake = timebase::cycles() + timebase::from_us(1000);
+        timebase::wait_until((!pacing_ && next_draw.cycles() < wake) ? next_draw.cycles() : wake);
     }
 }
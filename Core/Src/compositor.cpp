@@ -0,0 +1,233 @@
+#include "compositor.hpp"
+#include "accel2d.hpp"
+#include "fastmem.hpp"
+#include <cstring>
+
+namespace {
+    // one composed line, in DTCM (.bss)
+    alignas(8) uint16_t line_buffer[gfx::Compositor::MAX_WIDTH];
+
+    inline int16_t min16(int16_t a, int16_t b) { return a < b ? a : b; }
+    inline int16_t max16(int16_t a, int16_t b) { return a > b ? a : b; }
+} // namespace
+
+namespace gfx {
+
+    // ========== DamageList ==========
+
+    void DamageList::add(Rect r) {
+        if (r.empty()) {
+            return;
+        }
+        // absorb every overlapping rectangle, then store the union
+        uint8_t i = 0;
+        while (i < count) {
+            if (rects[i].intersects(r)) {
+                r = r.united(rects[i]);
+                rects[i] = rects[--count];
+                i = 0;
+            } else {
+                i++;
+            }
+        }
+        if (count == MAX_RECTS) {
+            // out of slots: collapse everything into one box
+            r = r.united(bounds());
+            count = 0;
+        }
+        rects[count++] = r;
+    }
+
+    Rect DamageList::bounds() const {
+        Rect box = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < count; i++) {
+            box = box.united(rects[i]);
+        }
+        return box;
+    }
+
+    // ========== Layers ==========
+
+    Layer::Layer(const Rect& bounds, uint8_t alpha)
+        : bounds_(bounds), alpha_(alpha), visible_(true) {}
+
+    BitmapLayer::BitmapLayer(const Rect& bounds, const uint16_t* pixels, uint32_t stride, uint8_t alpha)
+        : Layer(bounds, alpha), pixels_(pixels), stride_(stride) {}
+
+    void BitmapLayer::render_span(uint16_t* line, int16_t y, int16_t x0, int16_t x1) const {
+        const Rect& b = bounds();
+        const uint16_t* src = pixels_ + (uint32_t)(y - b.y) * stride_ + (x0 - b.x);
+        if (alpha() == 255) {
+            fastmem::copy(line + x0, src, (uint32_t)(x1 - x0) * sizeof(uint16_t));
+            return;
+        }
+        for (int16_t x = x0; x < x1; x++) {
+            line[x] = Accel2D::blend_pixel(line[x], *src++, alpha());
+        }
+    }
+
+    CanvasLayer::CanvasLayer(const Rect& bounds, uint16_t* pixels, uint8_t* coverage, uint8_t alpha,
+                             uint8_t scale_shift)
+        : Layer(bounds, alpha), pixels_(pixels), coverage_(coverage), shift_(scale_shift) {}
+
+    void CanvasLayer::clear_rows(uint16_t y0, uint16_t y1) {
+        if (y1 >= height()) y1 = height() - 1;
+        if (y0 > y1) return;
+        // colour is don't-care where coverage is 0
+        std::memset(coverage_ + (uint32_t)y0 * width(), 0, (uint32_t)(y1 - y0 + 1) * width());
+    }
+
+    void CanvasLayer::clear_rect(const Rect& r) {
+        const Rect a = area();
+        Rect c = r.intersected(a);
+        if (c.empty()) {
+            return;
+        }
+        if (c.w == width()) {
+            clear_rows(c.y - a.y, c.bottom() - 1 - a.y);
+            return;
+        }
+        uint8_t* p = coverage_ + (uint32_t)(c.y - a.y) * width() + (c.x - a.x);
+        for (uint16_t y = 0; y < c.h; y++) {
+            std::memset(p, 0, c.w);
+            p += width();
+        }
+    }
+
+    void CanvasLayer::render_span(uint16_t* line, int16_t y, int16_t x0, int16_t x1) const {
+        const Rect a = area();
+        const uint32_t row = (uint32_t)((y >> shift_) - a.y) * width();
+        const uint16_t* src = pixels_ + row - a.x;
+        const uint8_t* cov = coverage_ + row - a.x;
+        const uint32_t layer_alpha = alpha();
+        if (shift_ != 0) {
+            // half resolution: every plane pixel covers a 2x2 block, lines are read twice
+            for (int16_t x = x0; x < x1; x++) {
+                const int16_t cx = x >> 1;
+                uint32_t c = cov[cx];
+                if (c == 0) {
+                    continue;
+                }
+                if (layer_alpha != 255) {
+                    c = c * layer_alpha / 255;
+                }
+                line[x] = (c == 255) ? src[cx] : Accel2D::blend_pixel(line[x], src[cx], (uint8_t)c);
+            }
+            return;
+        }
+        for (int16_t x = x0; x < x1; x++) {
+            uint32_t a = cov[x];
+            if (a == 0) {
+                continue;
+            }
+            if (layer_alpha != 255) {
+                a = a * layer_alpha / 255;
+            }
+            line[x] = (a == 255) ? src[x] : Accel2D::blend_pixel(line[x], src[x], (uint8_t)a);
+        }
+    }
+
+    // ========== Compositor ==========
+
+    Compositor::Compositor(uint16_t width, uint16_t height, uint8_t targets, uint16_t clear_color)
+        : width_(width), height_(height),
+          targets_(targets > MAX_TARGETS ? MAX_TARGETS : targets), clear_color_(clear_color),
+          layers_(), layer_count_(0), damage_(), last_pixels_(0) {
+        damage_all();
+    }
+
+    bool Compositor::add_layer(Layer* layer) {
+        if (layer_count_ == MAX_LAYERS) {
+            return false;
+        }
+        layers_[layer_count_++] = layer;
+        damage(layer->bounds());
+        return true;
+    }
+
+    void Compositor::damage(const Rect& r) {
+        Rect clipped = r.intersected({0, 0, width_, height_});
+        if (clipped.empty()) {
+            return;
+        }
+        for (uint8_t t = 0; t < targets_; t++) {
+            damage_[t].add(clipped);
+        }
+    }
+
+    Rect Compositor::pending(uint8_t target) const {
+        return damage_[target].bounds();
+    }
+
+    void Compositor::compose_rect(const Rect& r, const Target& frame) {
+        const int16_t x0 = r.x;
+        const int16_t x1 = r.right();
+        for (int16_t y = r.y; y < r.bottom(); y++) {
+            bool covered = false;
+            for (uint8_t l = 0; l < layer_count_; l++) {
+                const Layer* layer = layers_[l];
+                if (!layer->visible()) {
+                    continue;
+                }
+                const Rect& b = layer->bounds();
+                if (y < b.y || y >= b.bottom()) {
+                    continue;
+                }
+                int16_t sx0 = max16(x0, b.x);
+                int16_t sx1 = min16(x1, b.right());
+                if (sx0 >= sx1) {
+                    continue;
+                }
+                // the first layer must start from a defined line
+                if (!covered && !(layer->opaque() && sx0 == x0 && sx1 == x1)) {
+                    fastmem::fill16(line_buffer + x0, clear_color_, (uint32_t)(x1 - x0));
+                }
+                covered = true;
+                layer->render_span(line_buffer, y, sx0, sx1);
+            }
+            if (!covered) {
+                fastmem::fill16(line_buffer + x0, clear_color_, (uint32_t)(x1 - x0));
+            }
+            if (frame.rgb) {
+                fastmem::copy(frame.rgb->at(x0, y), line_buffer + x0,
+                              (uint32_t)(x1 - x0) * sizeof(uint16_t));
+            } else {
+                frame.palette->quantize(frame.indexed->at(x0, y), line_buffer + x0, (uint32_t)(x1 - x0));
+            }
+        }
+        last_pixels_ += (uint32_t)r.w * r.h;
+    }
+
+    Rect Compositor::compose(uint8_t target, const Surface565& frame, DamageList* written) {
+        return compose(target, {&frame, nullptr, nullptr}, frame.clip(), written);
+    }
+
+    Rect Compositor::compose(uint8_t target, const SurfaceI8& frame, const Palette& palette, DamageList* written) {
+        return compose(target, {nullptr, &frame, &palette}, frame.clip(), written);
+    }
+
+    Rect Compositor::compose(uint8_t target, const Target& frame, const Rect& clip, DamageList* written) {
+        last_pixels_ = 0;
+        if (written) {
+            written->clear();
+        }
+        if (target >= targets_) {
+            return {0, 0, 0, 0};
+        }
+        DamageList& list = damage_[target];
+        Rect box = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < list.count; i++) {
+            const Rect r = list.rects[i].intersected(clip);
+            if (!r.empty()) {
+                compose_rect(r, frame);
+                box = box.united(r);
+                if (written) {
+                    written->rects[written->count++] = r;
+                }
+            }
+        }
+        list.clear();
+        return box;
+    }
+
+} // namespace gfx
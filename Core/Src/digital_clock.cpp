@@ -0,0 +1,145 @@
+#include "digital_clock.hpp"
+#include "font_stroke40.hpp"
+#include "timebase.hpp"
+#include "sdram_map.hpp"
+#include <stdio.h>
+
+// SDRAM布局与ClockApp相同（sdram_map.hpp）：[0]帧缓冲 | [1]帧缓冲 | （静态表盘，不用）| 画布RGB565 | 画布覆盖率
+DigitalClock::DigitalClock(ST7789* lcd)
+    : frame_{DmaBuffer((void*)sdram_map::FRAME0, WIDTH * HEIGHT * 2),
+             DmaBuffer((void*)sdram_map::FRAME1, WIDTH * HEIGHT * 2)},
+      current_buffer_idx_(0),
+      canvas_({0, 0, WIDTH, HEIGHT}, (uint16_t*)sdram_map::HAND_PIXELS,
+              (uint8_t*)sdram_map::HAND_COVERAGE),
+      compositor_(WIDTH, HEIGHT, 2),
+      scene_(&canvas_, &compositor_),
+      background_(WIDTH, HEIGHT, ST7789::rgb_to_rgb565(12, 12, 12)),
+      colon_{gfx::TextNode(gfx::fonts::stroke40, ":", ST7789::rgb_to_rgb565(200, 170, 120)),
+              gfx::TextNode(gfx::fonts::stroke40, ":", ST7789::rgb_to_rgb565(200, 170, 120))},
+      hours_text_(gfx::fonts::stroke40, "00", ST7789::rgb_to_rgb565(200, 170, 120)),
+      minutes_text_(gfx::fonts::stroke40, "00", ST7789::rgb_to_rgb565(200, 170, 120)),
+      seconds_text_(gfx::fonts::stroke40, "00", ST7789::rgb_to_rgb565(220, 150, 130)),
+      lcd_(lcd), hours_(0), minutes_(0), seconds_(0), color_mode_(false) {
+    compositor_.add_layer(&canvas_);
+    canvas_.clear();
+    
+    // 居中："HH:MM:SS"，数字等宽，各字段位置按字体度量（含字距）
+    const gfx::Font& font = gfx::fonts::stroke40;
+    const int16_t x = (WIDTH - font.measure("00:00:00")) / 2;
+    const int16_t y = (HEIGHT - font.line_height) / 2;
+    hours_text_.set_position(x, y);
+    colon_[0].set_position(x + font.measure("00"), y);
+    minutes_text_.set_position(x + font.measure("00:"), y);
+    colon_[1].set_position(x + font.measure("00:00"), y);
+    seconds_text_.set_position(x + font.measure("00:00:"), y);
+    
+    scene_.add(&background_);
+    scene_.add(&colon_[0]);
+    scene_.add(&colon_[1]);
+    scene_.add(&hours_text_);
+    scene_.add(&minutes_text_);
+    scene_.add(&seconds_text_);
+}
+
+void DigitalClock::set_time(uint8_t hours, uint8_t minutes, uint8_t seconds) {
+    hours_ = hours % 24;
+    minutes_ = minutes % 60;
+    seconds_ = seconds % 60;
+}
+
+void DigitalClock::set_color_mode(bool on) {
+    color_mode_ = on;
+}
+
+void DigitalClock::tick() {
+    seconds_++;
+    if (seconds_ >= 60) {
+        seconds_ = 0;
+        minutes_++;
+        if (minutes_ >= 60) {
+            minutes_ = 0;
+            hours_++;
+            if (hours_ >= 24) {
+                hours_ = 0;
+            }
+        }
+    }
+}
+
+void DigitalClock::update_scene() {
+    char buf[3];
+    snprintf(buf, sizeof(buf), "%02u", (unsigned int)hours_);
+    hours_text_.set_text(buf);
+    snprintf(buf, sizeof(buf), "%02u", (unsigned int)minutes_);
+    minutes_text_.set_text(buf);
+    snprintf(buf, sizeof(buf), "%02u", (unsigned int)seconds_);
+    seconds_text_.set_text(buf);
+    
+    if (color_mode_) {
+        // 映射时间到颜色（每秒变化，整屏重画）
+        uint8_t r = (hours_ * 255) / 23;      // 0-23 → 0-255
+        uint8_t g = (minutes_ * 255) / 59;    // 0-59 → 0-255
+        uint8_t b = (seconds_ * 255) / 59;    // 0-59 → 0-255
+        background_.set_color(ST7789::rgb_to_rgb565(r, g, b));
+    }
+}
+
+void DigitalClock::run() {
+    printf("[CLOCK] Digital clock started at %02u:%02u:%02u (%s)\r\n",
+           (unsigned int)hours_, (unsigned int)minutes_, (unsigned int)seconds_,
+           color_mode_ ? "color" : "text");
+    
+    if (color_mode_) {
+        // 背景随时间变化，文字用固定的珍珠白
+        uint16_t pearl = ST7789::rgb_to_rgb565(240, 235, 230);
+        colon_[0].set_color(pearl);
+        colon_[1].set_color(pearl);
+        hours_text_.set_color(pearl);
+        minutes_text_.set_color(pearl);
+        seconds_text_.set_color(pearl);
+    }
+    
+    timebase::init();
+    
+    // 秒节拍按时基的截止时刻累加，不随循环延迟漂移
+    const uint64_t second = timebase::from_us(1000000);
+    timebase::Deadline next_second = timebase::Deadline::at(timebase::cycles() + second);
+    timebase::Deadline next_print = timebase::Deadline::at(next_second.cycles() + 9 * second);
+    uint32_t frames = 0;
+    uint64_t busy_cycles = 0;
+    
+    while (1) {
+        // 每秒更新
+        if (next_second.expired()) {
+            next_second = timebase::Deadline::at(next_second.cycles() + second);
+            tick();
+        }
+        
+        // 只有节点变化时才合成和发送
+        const uint64_t work_start = timebase::cycles();
+        update_scene();
+        if (!scene_.update().empty()) {
+            gfx::Rect written = compositor_.compose(current_buffer_idx_, {frame_[current_buffer_idx_].data16(), WIDTH, HEIGHT, WIDTH});
+            frame_[current_buffer_idx_].mark_dirty(written.y * WIDTH * sizeof(uint16_t),
+                                                   written.h * WIDTH * sizeof(uint16_t));
+            lcd_->transmit_buffer_dma(frame_[current_buffer_idx_]);
+            current_buffer_idx_ = 1 - current_buffer_idx_;
+            frames++;
+        }
+        busy_cycles += timebase::cycles() - work_start;
+        
+        // 每10秒打印一次统计
+        if (next_print.expired()) {
+            printf("[CLOCK] %02u:%02u:%02u | frames: %u | busy: %u us\r\n",
+                   (unsigned int)hours_, (unsigned int)minutes_, (unsigned int)seconds_,
+                   (unsigned int)frames, (unsigned int)timebase::to_us(busy_cycles));
+            next_print = timebase::Deadline::at(next_print.cycles() + 10 * second);
+            frames = 0;
+            busy_cycles = 0;
+        }
+        
+        // 最多睡10 ms，到整秒时提前醒来
+        const uint64_t wake = timebase::cycles() + timebase::from_us(10000);
+        timebase::wait_until(next_second.cycles() < wake ? next_second.cycles() : wake);
+    }
+}
@@ -0,0 +1,93 @@
+#include "dma_buffer.hpp"
+#include "mpu_profile.hpp"
+
+DmaBuffer::DmaBuffer(void* data, uint32_t size)
+    : data_((uint8_t*)data), size_(size), ranges_(), range_count_(0), last_cleaned_(0),
+      last_clean_cycles_(0) {
+    if (((uint32_t)data & (CACHE_LINE - 1)) != 0) {
+        Error_Handler();    // cache maintenance by line would touch a neighbour
+    }
+    mark_all_dirty();
+}
+
+void DmaBuffer::mark_dirty(uint32_t offset, uint32_t bytes) {
+    if (bytes == 0 || offset >= size_) {
+        return;
+    }
+    if (offset + bytes > size_) {
+        bytes = size_ - offset;
+    }
+
+    // widen to whole cache lines
+    uint32_t begin = offset & ~(CACHE_LINE - 1);
+    uint32_t end = (offset + bytes + CACHE_LINE - 1) & ~(CACHE_LINE - 1);
+
+    // absorb every range overlapping or touching [begin, end)
+    uint8_t i = 0;
+    while (i < range_count_) {
+        Range& r = ranges_[i];
+        if (r.begin <= end && begin <= r.end) {
+            begin = (r.begin < begin) ? r.begin : begin;
+            end = (r.end > end) ? r.end : end;
+            ranges_[i] = ranges_[--range_count_];
+        } else {
+            i++;
+        }
+    }
+
+    if (range_count_ == MAX_RANGES) {
+        merge_closest();
+    }
+    ranges_[range_count_++] = {begin, end};
+}
+
+void DmaBuffer::mark_all_dirty() {
+    ranges_[0] = {0, (size_ + CACHE_LINE - 1) & ~(CACHE_LINE - 1)};
+    range_count_ = 1;
+}
+
+// join the two ranges with the smallest gap, trading a few clean lines for a slot
+void DmaBuffer::merge_closest() {
+    uint8_t best_a = 0;
+    uint8_t best_b = 1;
+    uint32_t best_gap = UINT32_MAX;
+    for (uint8_t a = 0; a < range_count_; a++) {
+        for (uint8_t b = 0; b < range_count_; b++) {
+            if (a == b || ranges_[a].end > ranges_[b].begin) {
+                continue;
+            }
+            uint32_t gap = ranges_[b].begin - ranges_[a].end;
+            if (gap < best_gap) {
+                best_gap = gap;
+                best_a = a;
+                best_b = b;
+            }
+        }
+    }
+    ranges_[best_a].end = ranges_[best_b].end;
+    ranges_[best_b] = ranges_[--range_count_];
+}
+
+uint32_t DmaBuffer::dirty_bytes() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < range_count_; i++) {
+        total += ranges_[i].end - ranges_[i].begin;
+    }
+    return total;
+}
+
+uint32_t DmaBuffer::clean() {
+    uint32_t start = DWT->CYCCNT;
+    uint32_t total = 0;
+    // write-through / non-cacheable regions need no maintenance (see mpu_profile.hpp)
+    const uint8_t count = mpu::is_dma_coherent((uint32_t)data_, size_) ? 0 : range_count_;
+    for (uint8_t i = 0; i < count; i++) {
+        const Range& r = ranges_[i];
+        SCB_CleanDCache_by_Addr((uint32_t*)(data_ + r.begin), (int32_t)(r.end - r.begin));
+        total += r.end - r.begin;
+    }
+    range_count_ = 0;
+    last_cleaned_ = total;
+    last_clean_cycles_ = DWT->CYCCNT - start;
+    return total;
+}
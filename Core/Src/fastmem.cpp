@@ -0,0 +1,218 @@
+#include "fastmem.hpp"
+
+// the kernels are only worth having unrolled and scheduled, also in Debug builds;
+// loop distribution must stay off or GCC turns the loops back into memcpy/memset calls
+#pragma GCC optimize ("O2", "no-tree-loop-distribute-patterns")
+
+namespace {
+    // LDRD/STRD need 4-byte alignment on ARMv7-M, not 8
+    typedef uint64_t __attribute__((may_alias, aligned(4))) u64_a4;
+    typedef uint32_t __attribute__((may_alias)) u32_a4;
+    typedef uint32_t __attribute__((may_alias, aligned(1))) u32_a1;    // unaligned LDR/STR
+    typedef uint16_t __attribute__((may_alias)) u16_a2;
+
+    inline void copy_bytes(uint8_t* d, const uint8_t* s, uint32_t n) {
+        while (n--) {
+            *d++ = *s++;
+        }
+    }
+
+    // 32 bytes per iteration, loads grouped ahead of stores so they issue back to back
+    inline void copy_body_64(uint8_t*& d, const uint8_t*& s, uint32_t& n) {
+        while (n >= 32) {
+            uint64_t a = ((const u64_a4*)s)[0];
+            uint64_t b = ((const u64_a4*)s)[1];
+            uint64_t c = ((const u64_a4*)s)[2];
+            uint64_t e = ((const u64_a4*)s)[3];
+            ((u64_a4*)d)[0] = a;
+            ((u64_a4*)d)[1] = b;
+            ((u64_a4*)d)[2] = c;
+            ((u64_a4*)d)[3] = e;
+            d += 32;
+            s += 32;
+            n -= 32;
+        }
+        while (n >= 4) {
+            *(u32_a4*)d = *(const u32_a4*)s;
+            d += 4;
+            s += 4;
+            n -= 4;
+        }
+    }
+
+    // source misaligned against the destination: unaligned word loads, aligned stores
+    inline void copy_body_unaligned(uint8_t*& d, const uint8_t*& s, uint32_t& n) {
+        while (n >= 16) {
+            uint32_t a = ((const u32_a1*)s)[0];
+            uint32_t b = ((const u32_a1*)s)[1];
+            uint32_t c = ((const u32_a1*)s)[2];
+            uint32_t e = ((const u32_a1*)s)[3];
+            ((u32_a4*)d)[0] = a;
+            ((u32_a4*)d)[1] = b;
+            ((u32_a4*)d)[2] = c;
+            ((u32_a4*)d)[3] = e;
+            d += 16;
+            s += 16;
+            n -= 16;
+        }
+        while (n >= 4) {
+            *(u32_a4*)d = *(const u32_a1*)s;
+            d += 4;
+            s += 4;
+            n -= 4;
+        }
+    }
+
+    // dst 4-byte aligned, bytes a multiple of 4
+    inline void fill_words(uint8_t* d, uint32_t value, uint32_t bytes) {
+        if (((uint32_t)d & 4) && bytes >= 4) {
+            *(u32_a4*)d = value;
+            d += 4;
+            bytes -= 4;
+        }
+        const uint64_t v64 = ((uint64_t)value << 32) | value;
+        while (bytes >= 32) {
+            ((u64_a4*)d)[0] = v64;
+            ((u64_a4*)d)[1] = v64;
+            ((u64_a4*)d)[2] = v64;
+            ((u64_a4*)d)[3] = v64;
+            d += 32;
+            bytes -= 32;
+        }
+        while (bytes >= 4) {
+            *(u32_a4*)d = value;
+            d += 4;
+            bytes -= 4;
+        }
+    }
+} // namespace
+
+namespace fastmem {
+
+    void copy(void* dst, const void* src, uint32_t bytes) {
+        uint8_t* d = (uint8_t*)dst;
+        const uint8_t* s = (const uint8_t*)src;
+        if (bytes < 16) {
+            copy_bytes(d, s, bytes);
+            return;
+        }
+        // head: bring the destination to an 8-byte boundary
+        uint32_t head = (8 - ((uint32_t)d & 7)) & 7;
+        copy_bytes(d, s, head);
+        d += head;
+        s += head;
+        bytes -= head;
+
+        if (((uint32_t)s & 3) == 0) {
+            copy_body_64(d, s, bytes);
+        } else {
+            copy_body_unaligned(d, s, bytes);
+        }
+        copy_bytes(d, s, bytes);
+    }
+
+    void move(void* dst, const void* src, uint32_t bytes) {
+        uint8_t* d = (uint8_t*)dst;
+        const uint8_t* s = (const uint8_t*)src;
+        if (d <= s || d >= s + bytes) {
+            copy(dst, src, bytes);
+            return;
+        }
+        // overlapping with dst above src: walk backwards from the end
+        d += bytes;
+        s += bytes;
+        while (bytes > 0 && ((uint32_t)d & 3)) {
+            *--d = *--s;
+            bytes--;
+        }
+        if (((uint32_t)s & 3) == 0) {
+            while (bytes >= 16) {
+                d -= 16;
+                s -= 16;
+                uint32_t a = ((const u32_a4*)s)[3];
+                uint32_t b = ((const u32_a4*)s)[2];
+                uint32_t c = ((const u32_a4*)s)[1];
+                uint32_t e = ((const u32_a4*)s)[0];
+                ((u32_a4*)d)[3] = a;
+                ((u32_a4*)d)[2] = b;
+                ((u32_a4*)d)[1] = c;
+                ((u32_a4*)d)[0] = e;
+                bytes -= 16;
+            }
+        }
+        while (bytes > 0) {
+            *--d = *--s;
+            bytes--;
+        }
+    }
+
+    void fill16(uint16_t* dst, uint16_t value, uint32_t count) {
+        if (count == 0) {
+            return;
+        }
+        if ((uint32_t)dst & 2) {
+            *(u16_a2*)dst++ = value;
+            count--;
+        }
+        fill_words((uint8_t*)dst, ((uint32_t)value << 16) | value, (count / 2) * 4);
+        if (count & 1) {
+            *(u16_a2*)(dst + count - 1) = value;
+        }
+    }
+
+    void fill32(uint32_t* dst, uint32_t value, uint32_t count) {
+        fill_words((uint8_t*)dst, value, count * 4);
+    }
+
+    void copy_rect16(uint16_t* dst, uint32_t dst_stride,
+                     const uint16_t* src, uint32_t src_stride,
+                     uint32_t w, uint32_t h) {
+        if (dst_stride == w && src_stride == w) {
+            copy(dst, src, w * h * sizeof(uint16_t));
+            return;
+        }
+        for (uint32_t y = 0; y < h; y++) {
+            copy(dst, src, w * sizeof(uint16_t));
+            dst += dst_stride;
+            src += src_stride;
+        }
+    }
+
+    void fill_rect16(uint16_t* dst, uint32_t dst_stride, uint32_t w, uint32_t h, uint16_t value) {
+        if (dst_stride == w) {
+            fill16(dst, value, w * h);
+            return;
+        }
+        for (uint32_t y = 0; y < h; y++) {
+            fill16(dst, value, w);
+            dst += dst_stride;
+        }
+    }
+
+    void copy_nt(void* dst, const void* src, uint32_t bytes) {
+        uint8_t* d = (uint8_t*)dst;
+        const uint8_t* s = (const uint8_t*)src;
+        while (bytes > 0) {
+            uint32_t n = (bytes > NT_BLOCK) ? NT_BLOCK : bytes;
+            copy(d, s, n);
+            // write out and drop both sides before the next block allocates
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t*)d, (int32_t)n);
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t*)s, (int32_t)n);
+            d += n;
+            s += n;
+            bytes -= n;
+        }
+    }
+
+    void fill16_nt(uint16_t* dst, uint16_t value, uint32_t count) {
+        const uint32_t block = NT_BLOCK / sizeof(uint16_t);
+        while (count > 0) {
+            uint32_t n = (count > block) ? block : count;
+            fill16(dst, value, n);
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t*)dst, (int32_t)(n * sizeof(uint16_t)));
+            dst += n;
+            count -= n;
+        }
+    }
+
+} // namespace fastmem
@@ -0,0 +1,187 @@
+#include "font.hpp"
+#include "scene.hpp"
+#include "fastmem.hpp"
+#include "mask.hpp"
+#include "mpu_profile.hpp"
+
+namespace gfx {
+
+    // ========== Font ==========
+
+    const GlyphInfo* Font::find(uint16_t code) const {
+        uint16_t lo = 0;
+        uint16_t hi = glyph_count;
+        while (lo < hi) {
+            uint16_t mid = (lo + hi) / 2;
+            if (glyphs[mid].code < code) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return (lo < glyph_count && glyphs[lo].code == code) ? &glyphs[lo] : nullptr;
+    }
+
+    int8_t Font::kern(uint16_t left, uint16_t right) const {
+        const uint32_t key = ((uint32_t)left << 16) | right;
+        uint16_t lo = 0;
+        uint16_t hi = kern_count;
+        while (lo < hi) {
+            uint16_t mid = (lo + hi) / 2;
+            uint32_t k = ((uint32_t)kerning[mid].left << 16) | kerning[mid].right;
+            if (k < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo < kern_count && kerning[lo].left == left && kerning[lo].right == right) {
+            return kerning[lo].adjust;
+        }
+        return 0;
+    }
+
+    uint16_t Font::measure(const char* text) const {
+        int16_t pen = 0;
+        uint8_t prev = 0;
+        for (const char* c = text; *c != '\0'; c++) {
+            const GlyphInfo* g = find((uint8_t)*c);
+            if (g == nullptr) {
+                continue;
+            }
+            if (prev != 0) {
+                pen += kern(prev, (uint8_t)*c);
+            }
+            pen += g->advance;
+            prev = (uint8_t)*c;
+        }
+        return pen > 0 ? (uint16_t)pen : 0;
+    }
+
+    Rect Font::bounds(const char* text, int16_t x, int16_t y) const {
+        Rect box = {0, 0, 0, 0};
+        int16_t pen = x;
+        uint8_t prev = 0;
+        for (const char* c = text; *c != '\0'; c++) {
+            const GlyphInfo* g = find((uint8_t)*c);
+            if (g == nullptr) {
+                continue;
+            }
+            if (prev != 0) {
+                pen += kern(prev, (uint8_t)*c);
+            }
+            box = box.united({(int16_t)(pen + g->x_off), (int16_t)(y + g->y_off), g->w, g->h});
+            pen += g->advance;
+            prev = (uint8_t)*c;
+        }
+        return box;
+    }
+
+    // ========== Rendering ==========
+
+    void draw_glyph(Painter& p, const Font& font, const GlyphInfo& g, int16_t x, int16_t y,
+                    uint16_t color, uint8_t alpha) {
+        mask::draw(p, font.data + g.offset, x + g.x_off, y + g.y_off, g.w, g.h, color, alpha);
+    }
+
+    int16_t draw_text(Painter& p, const Font& font, int16_t x, int16_t y, const char* text,
+                      uint16_t color, uint8_t alpha) {
+        uint8_t prev = 0;
+        for (const char* c = text; *c != '\0'; c++) {
+            const GlyphInfo* g = font.find((uint8_t)*c);
+            if (g == nullptr) {
+                continue;
+            }
+            if (prev != 0) {
+                x += font.kern(prev, (uint8_t)*c);
+            }
+            draw_glyph(p, font, *g, x, y, color, alpha);
+            x += g->advance;
+            prev = (uint8_t)*c;
+        }
+        return x;
+    }
+
+    // ========== GlyphCache ==========
+
+    GlyphCache::GlyphCache(uint16_t* storage, uint32_t pixels)
+        : storage_(storage), capacity_(pixels), accel_(nullptr), font_(nullptr), fg_(0), bg_(0), cells_(), count_(0) {}
+
+    bool GlyphCache::build(const Font& font, const char* chars, uint16_t fg, uint16_t bg) {
+        font_ = &font;
+        fg_ = fg;
+        bg_ = bg;
+        count_ = 0;
+        uint32_t used = 0;
+        bool complete = true;
+        for (const char* c = chars; *c != '\0'; c++) {
+            const GlyphInfo* g = font.find((uint8_t)*c);
+            if (g == nullptr) {
+                continue;
+            }
+            const uint32_t cell_pixels = (uint32_t)g->advance * font.line_height;
+            if (count_ == MAX_GLYPHS || used + cell_pixels > capacity_) {
+                complete = false;
+                break;
+            }
+            uint16_t* cell = storage_ + used;
+            fastmem::fill16(cell, bg, cell_pixels);
+            Painter p(Surface565(cell, g->advance, font.line_height, g->advance), {0, 0, g->advance, font.line_height});
+            draw_glyph(p, font, *g, 0, 0, fg);
+            cells_[count_++] = {g->code, g->advance, cell};
+            used += cell_pixels;
+        }
+        // cells are a copy source for Accel2D
+        mpu::clean_for_dma(storage_, used * 2);
+        return complete;
+    }
+
+    const GlyphCache::Cell* GlyphCache::find(uint16_t code) const {
+        for (uint8_t i = 0; i < count_; i++) {
+            if (cells_[i].code == code) {
+                return &cells_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    uint16_t GlyphCache::draw(const Surface565& dst, int16_t x, int16_t y, const char* text) const {
+        if (font_ == nullptr) {
+            return 0;
+        }
+        const uint8_t lh = font_->line_height;
+        int16_t pen = x;
+        for (const char* c = text; *c != '\0'; c++) {
+            const Cell* cell = find((uint8_t)*c);
+            if (cell == nullptr) {
+                const GlyphInfo* g = font_->find((uint8_t)*c);
+                if (g == nullptr) {
+                    continue;
+                }
+                // slow path: blend over a freshly filled cell, on the CPU
+                if (accel_ != nullptr) {
+                    accel_->wait();
+                }
+                const Rect r = {pen, y, g->advance, lh};
+                dst.fill(r, bg_);
+                Painter p(dst, r);
+                draw_glyph(p, *font_, *g, pen, y, fg_);
+                pen += g->advance;
+                continue;
+            }
+            // the cell as a surface placed at the pen
+            const Surface565 src(cell->pixels, cell->advance, lh, cell->advance, pen, y);
+            if (accel_ != nullptr) {
+                const Rect c = src.bounds().intersected(dst.clip());
+                if (!c.empty()) {
+                    accel_->copy(dst.at(c.x, c.y), dst.stride(), src.at(c.x, c.y), src.stride(), c.w, c.h);
+                }
+            } else {
+                dst.copy(src.bounds(), src);
+            }
+            pen += cell->advance;
+        }
+        return (uint16_t)(pen - x);
+    }
+
+} // namespace gfx
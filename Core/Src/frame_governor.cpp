@@ -0,0 +1,44 @@
+#include "frame_governor.hpp"
+
+FrameGovernor::FrameGovernor(uint32_t budget_us, uint8_t levels)
+    : budget_us_(budget_us), levels_(levels ? levels : 1), level_(0), over_run_(0), under_run_(0),
+      misses_(0), frames_(0), changes_(0), window_misses_(0), window_worst_us_(0) {}
+
+bool FrameGovernor::report(uint32_t render_us, uint32_t transfer_us) {
+    const uint32_t cost = render_us > transfer_us ? render_us : transfer_us;
+    frames_++;
+    if (cost > window_worst_us_) {
+        window_worst_us_ = cost;
+    }
+
+    if (cost > budget_us_) {
+        misses_++;
+        window_misses_++;
+        under_run_ = 0;
+        if (++over_run_ >= DOWN_FRAMES && level_ + 1 < levels_) {
+            level_++;
+            changes_++;
+            over_run_ = 0;
+            return true;
+        }
+        return false;
+    }
+
+    over_run_ = 0;
+    if (cost * 100 > budget_us_ * UP_PERCENT) {
+        under_run_ = 0;     // inside the budget, but too close to step up
+        return false;
+    }
+    if (++under_run_ >= UP_FRAMES && level_ > 0) {
+        level_--;
+        changes_++;
+        under_run_ = 0;
+        return true;
+    }
+    return false;
+}
+
+void FrameGovernor::reset_window() {
+    window_misses_ = 0;
+    window_worst_us_ = 0;
+}
@@ -0,0 +1,208 @@
+#include "frame_pacer.hpp"
+#include "irq_latency.h"
+
+namespace {
+    constexpr uint8_t GUARD_LINES {2};     // scan lines of slack on each side of a window
+} // namespace
+
+FramePacer* FramePacer::instances_[MAX_PACERS] = {};
+uint16_t FramePacer::pins_[MAX_PACERS] = {};
+uint8_t FramePacer::instance_count_ = 0;
+
+FramePacer::FramePacer(const lcd::Panel& panel)
+    : panel_(panel), te_cycles_(timebase::cycles()), te_index_(0),
+      period_((uint32_t)timebase::from_us(panel.frame_us)),
+      edges_(0), seen_edges_(0), quiet_refreshes_(TE_TIMEOUT), taken_index_(0), pixel_cost_q8_(0),
+      element_cost_(0), last_y0_(0), last_y1_(0), last_pixels_(0), last_elements_(0), last_scanout_(0),
+      window_() {}
+
+bool FramePacer::attach_te(GPIO_TypeDef* port, uint16_t pin) {
+    if (instance_count_ == MAX_PACERS || pin < GPIO_PIN_5 || (pin & (pin - 1)) != 0) {
+        return false;
+    }
+    GPIO_InitTypeDef init = {};
+    init.Pin = pin;
+    init.Mode = GPIO_MODE_IT_RISING;
+    init.Pull = GPIO_PULLDOWN;
+    init.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(port, &init);
+
+    pins_[instance_count_] = pin;
+    instances_[instance_count_++] = this;
+
+    // above the display DMA (5): the edge timestamp is the phase reference
+    const IRQn_Type irq = (pin >= GPIO_PIN_10) ? EXTI15_10_IRQn : EXTI9_5_IRQn;
+    HAL_NVIC_SetPriority(irq, 4, 0);
+    HAL_NVIC_EnableIRQ(irq);
+    return true;
+}
+
+ITCM_FUNC void FramePacer::dispatch_te(uint16_t pin) {
+    for (uint8_t i = 0; i < instance_count_; i++) {
+        if (pins_[i] == pin) {
+            instances_[i]->on_te();
+            return;
+        }
+    }
+}
+
+ITCM_FUNC void FramePacer::on_te() {
+    const uint64_t now = timebase::cycles();
+    const uint32_t period = period_;
+    const uint64_t elapsed = now - te_cycles_;
+    const uint32_t n = (uint32_t)((elapsed + period / 2) / period);    // refreshes since the last edge
+    if (edges_ > 0) {
+        if (elapsed < period / 2) {
+            return;     // glitch, a refresh cannot be this short
+        }
+        if (n <= TE_TIMEOUT) {
+            // track the real refresh rate (RC oscillator, temperature)
+            const int32_t error = (int32_t)(elapsed / n) - (int32_t)period;
+            if (error > -(int32_t)(period / 8) && error < (int32_t)(period / 8)) {
+                period_ = period + error / 8;
+            }
+        }
+    }
+    te_cycles_ = now;
+    te_index_ = te_index_ + (n ? n : 1);
+    edges_ = edges_ + 1;
+}
+
+bool FramePacer::synced() const {
+    return edges_ > 0 && quiet_refreshes_ < TE_TIMEOUT;
+}
+
+// start and number of the refresh in progress, extrapolated from the last edge
+void FramePacer::snapshot(uint64_t& te, uint32_t& index, uint32_t& period) const {
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    te = te_cycles_;
+    index = te_index_;
+    period = period_;
+    __set_PRIMASK(primask);
+    const uint32_t k = (uint32_t)((timebase::cycles() - te) / period);
+    te += (uint64_t)k * period;
+    index += k;
+}
+
+uint32_t FramePacer::take_refresh() {
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    const uint32_t index = te_index_ + (uint32_t)((timebase::cycles() - te_cycles_) / period_);
+    const uint32_t edges = edges_;
+    __set_PRIMASK(primask);
+
+    const uint32_t n = index - taken_index_;
+    if (n == 0) {
+        return 0;
+    }
+    taken_index_ = index;
+    if (edges != seen_edges_) {
+        window_.te_edges += edges - seen_edges_;
+        seen_edges_ = edges;
+        quiet_refreshes_ = 0;
+    } else if (quiet_refreshes_ < TE_TIMEOUT) {
+        quiet_refreshes_ += n;
+    }
+    if (n > 1) {
+        window_.missed += n - 1;
+    }
+    return n;
+}
+
+FramePacer::Placement FramePacer::place(uint64_t ready, uint16_t y0, uint16_t y1, uint32_t pixels,
+                                        uint8_t elements) const {
+    uint64_t te;
+    uint32_t index;
+    uint32_t period;
+    snapshot(te, index, period);
+    while ((int64_t)(ready - te) >= (int64_t)period) {
+        te += period;   // ready in a later refresh
+    }
+
+    // scan times of the rows, relative to the start of a refresh
+    const uint32_t line = period / panel_.scan_lines;
+    const uint32_t reach = (panel_.blank_lines + panel_.y_offset + y0) * line;     // scan reaches y0
+    const uint32_t leave = (panel_.blank_lines + panel_.y_offset + y1 + 1) * line; // scan leaves y1
+    const uint32_t duration = elements * element_cost_ + (uint32_t)(((uint64_t)pixels * pixel_cost_q8_) >> 8)
+                              + GUARD_LINES * line;
+
+    Placement p = {ready, 0, te, period, false};
+    uint64_t shown;     // refresh start whose scan shows the new rows
+    if ((int64_t)(te + reach - ready) >= (int64_t)duration) {
+        // ahead of the scan: done before it reaches y0 in this refresh
+        shown = te;
+    } else if (period + reach >= leave + duration) {
+        // behind the scan: after it leaves y1, done before the next one reaches y0
+        const uint64_t open = te + leave;
+        const uint64_t close = te + period + reach - duration;
+        if (ready > close) {
+            p.start = open + period;
+            p.refresh = te + period;
+            shown = te + 2 * period;
+        } else {
+            p.start = (ready > open) ? ready : open;
+            shown = te + period;
+        }
+    } else {
+        // longer than any window: follow the scan from y0, the next scan may catch up
+        p.start = te + reach;
+        shown = te + period;
+        if (ready > p.start) {
+            p.start += period;
+            p.refresh = te + period;
+            shown += period;
+        }
+        p.tear_risk = true;
+    }
+    p.scanout = shown + (reach + leave) / 2;
+    return p;
+}
+
+uint64_t FramePacer::schedule(uint16_t y0, uint16_t y1, uint32_t pixels, uint8_t elements, uint64_t input) {
+    const Placement p = place(timebase::cycles(), y0, y1, pixels, elements);
+    last_y0_ = y0;
+    last_y1_ = y1;
+    last_pixels_ = pixels;
+    last_elements_ = elements;
+    last_scanout_ = p.scanout;
+
+    // latency to the first changed row
+    const uint64_t first_row = p.scanout - (y1 - y0 + 1) * (p.period / panel_.scan_lines) / 2;
+    const uint32_t latency_us = (uint32_t)timebase::to_us(first_row - input);
+    window_.presents++;
+    window_.tear_risks += p.tear_risk ? 1 : 0;
+    window_.phase_us_sum += (uint32_t)timebase::to_us((p.start - p.refresh) % p.period);
+    window_.latency_us_sum += latency_us;
+    if (latency_us > window_.latency_us_max) {
+        window_.latency_us_max = latency_us;
+    }
+    return p.start;
+}
+
+uint64_t FramePacer::predict_scanout(uint64_t ready) const {
+    if (last_elements_ == 0) {
+        return ready;
+    }
+    return place(ready, last_y0_, last_y1_, last_pixels_, last_elements_).scanout;
+}
+
+void FramePacer::record_transfer(uint32_t pixels, uint8_t elements, uint32_t total_cycles, uint32_t gap_cycles) {
+    if (pixels == 0 || elements == 0 || gap_cycles > total_cycles) {
+        return;
+    }
+    const uint32_t element = gap_cycles / elements;
+    const uint32_t pixel_q8 = (uint32_t)(((uint64_t)(total_cycles - gap_cycles) << 8) / pixels);
+    if (pixel_cost_q8_ == 0) {
+        element_cost_ = element;
+        pixel_cost_q8_ = pixel_q8;
+        return;
+    }
+    // slow average: single transfers stretched by other interrupts should not move it much
+    element_cost_ = element_cost_ - element_cost_ / 4 + element / 4;
+    pixel_cost_q8_ = pixel_cost_q8_ - pixel_cost_q8_ / 4 + pixel_q8 / 4;
+}
+
+void FramePacer::reset_window() {
+    window_ = {};
+}
@@ -0,0 +1,137 @@
+#include "image.hpp"
+#include "fastmem.hpp"
+#include <cstring>
+
+namespace {
+    constexpr uint8_t OP_DIFF  {0x40};
+    constexpr uint8_t OP_LUMA  {0x80};
+    constexpr uint8_t OP_RUN   {0xC0};
+    constexpr uint8_t OP_LONG  {0xE0};
+    constexpr uint8_t OP_RAW   {0xFF};
+    constexpr uint16_t LONG_BIAS {33};
+    constexpr uint32_t FILL_MIN {8};    // shorter runs are stored inline
+
+    inline uint8_t hash565(uint16_t p) {
+        return (uint8_t)(((p >> 11) * 3 + ((p >> 5) & 0x3F) * 5 + (p & 0x1F) * 7) & 63);
+    }
+
+    inline uint16_t add565(uint16_t p, int32_t dr, int32_t dg, int32_t db) {
+        uint32_t r = ((p >> 11) + dr) & 0x1F;
+        uint32_t g = (((p >> 5) & 0x3F) + dg) & 0x3F;
+        uint32_t b = ((p & 0x1F) + db) & 0x1F;
+        return (uint16_t)((r << 11) | (g << 5) | b);
+    }
+} // namespace
+
+namespace gfx {
+
+    ImageDecoder::ImageDecoder(const Image& image)
+        : image_(&image), pos_(nullptr), end_(nullptr), total_(0), decoded_(0),
+          prev_(0), run_(0), error_(false), index_() {
+        rewind();
+    }
+
+    void ImageDecoder::rewind() {
+        pos_ = image_->data;
+        end_ = image_->data + image_->size;
+        total_ = (uint32_t)image_->width * image_->height;
+        decoded_ = 0;
+        prev_ = 0;
+        run_ = 0;
+        error_ = false;
+        std::memset(index_, 0, sizeof(index_));
+    }
+
+    uint32_t ImageDecoder::read(uint16_t* dst, uint32_t count) {
+        if (count > total_ - decoded_) {
+            count = total_ - decoded_;
+        }
+        uint32_t n = 0;
+        while (n < count) {
+            if (run_ > 0) {
+                uint32_t k = run_ < count - n ? run_ : count - n;
+                if (k >= FILL_MIN) {
+                    fastmem::fill16(dst + n, prev_, k);
+                } else {
+                    for (uint32_t i = 0; i < k; i++) {
+                        dst[n + i] = prev_;
+                    }
+                }
+                run_ -= k;
+                n += k;
+                continue;
+            }
+            if (pos_ >= end_) {
+                error_ = true;
+                break;
+            }
+            const uint8_t op = *pos_++;
+            if (op < OP_DIFF) {
+                prev_ = index_[op];
+                dst[n++] = prev_;
+                continue;
+            }
+            if (op >= OP_RUN && op != OP_RAW) {
+                if (op < OP_LONG) {
+                    run_ = (op & 0x1F) + 1;
+                } else if (pos_ < end_) {
+                    run_ = (uint16_t)((((op & 0x1F) << 8) | *pos_++) + LONG_BIAS);
+                } else {
+                    error_ = true;
+                    break;
+                }
+                continue;
+            }
+            if (op < OP_LUMA) {
+                prev_ = add565(prev_, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2);
+            } else if (op < OP_RUN) {
+                if (pos_ >= end_) {
+                    error_ = true;
+                    break;
+                }
+                const int32_t dg = (op & 0x3F) - 32;
+                const uint8_t rb = *pos_++;
+                prev_ = add565(prev_, (rb >> 4) - 8 + (dg >> 1), dg, (rb & 0x0F) - 8 + (dg >> 1));
+            } else {
+                if (end_ - pos_ < 2) {
+                    error_ = true;
+                    break;
+                }
+                prev_ = (uint16_t)(pos_[0] | (pos_[1] << 8));
+                pos_ += 2;
+            }
+            index_[hash565(prev_)] = prev_;
+            dst[n++] = prev_;
+        }
+        decoded_ += n;
+        return n;
+    }
+
+    uint16_t ImageDecoder::read_rows(uint16_t* dst, uint32_t stride, uint16_t rows) {
+        const uint16_t w = image_->width;
+        uint16_t done_rows = 0;
+        while (done_rows < rows && read(dst + done_rows * stride, w) == w) {
+            done_rows++;
+        }
+        return done_rows;
+    }
+
+    bool decode_image(const Image& image, uint16_t* dst, uint32_t stride) {
+        ImageDecoder decoder(image);
+        decoder.read_rows(dst, stride, image.height);
+        return decoder.done() && !decoder.error();
+    }
+
+    uint32_t image_checksum(const uint16_t* pixels, uint16_t width, uint16_t height, uint32_t stride) {
+        uint32_t h = 0x811C9DC5;
+        for (uint16_t y = 0; y < height; y++) {
+            const uint16_t* row = pixels + y * stride;
+            for (uint16_t x = 0; x < width; x++) {
+                h = (h ^ (row[x] & 0xFF)) * 0x01000193;
+                h = (h ^ (row[x] >> 8)) * 0x01000193;
+            }
+        }
+        return h;
+    }
+
+} // namespace gfx
@@ -0,0 +1,92 @@
+#include "irq_latency.h"
+#include "main.hpp"
+#include <stdio.h>
+
+namespace {
+    struct ProbeStats {
+        uint32_t entry;     // CYCCNT at handler entry
+        bool armed;         // entry stamped, callback not reached yet
+        uint32_t min;
+        uint32_t max;
+        uint32_t sum;
+        uint32_t count;
+    };
+
+    volatile ProbeStats probes[IRQ_PROBE_COUNT];
+
+    const char* const probe_names[IRQ_PROBE_COUNT] = {
+        "DMA1_S0", "SPI5", "USART1", "TIM6", "TIM7", "TE",
+    };
+
+    void clear_stats() {
+        for (uint32_t i = 0; i < IRQ_PROBE_COUNT; i++) {
+            probes[i].armed = false;
+            probes[i].min = UINT32_MAX;
+            probes[i].max = 0;
+            probes[i].sum = 0;
+            probes[i].count = 0;
+        }
+    }
+} // namespace
+
+extern "C" {
+
+    void irq_probe_init(void) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        clear_stats();
+    }
+
+    ITCM_FUNC void irq_probe_enter(IrqProbeId id) {
+        probes[id].entry = DWT->CYCCNT;
+        probes[id].armed = true;
+    }
+
+    ITCM_FUNC void irq_probe_reach(IrqProbeId id) {
+        uint32_t now = DWT->CYCCNT;
+        volatile ProbeStats& p = probes[id];
+        if (!p.armed) {
+            return;
+        }
+        p.armed = false;
+        uint32_t cycles = now - p.entry;
+        if (cycles < p.min) {
+            p.min = cycles;
+        }
+        if (cycles > p.max) {
+            p.max = cycles;
+        }
+        p.sum += cycles;
+        p.count++;
+    }
+
+    void irq_probe_report(void) {
+        ProbeStats snap[IRQ_PROBE_COUNT];
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        for (uint32_t i = 0; i < IRQ_PROBE_COUNT; i++) {
+            snap[i].min = probes[i].min;
+            snap[i].max = probes[i].max;
+            snap[i].sum = probes[i].sum;
+            snap[i].count = probes[i].count;
+        }
+        clear_stats();
+        __set_PRIMASK(primask);
+
+#if defined(ISR_IN_ITCM)
+        const char* where = "itcm";
+#else
+        const char* where = "flash";
+#endif
+        for (uint32_t i = 0; i < IRQ_PROBE_COUNT; i++) {
+            if (snap[i].count == 0) {
+                continue;
+            }
+            printf("[IRQ] %-7s (%s) n=%lu min %lu avg %lu max %lu cycles\r\n",
+                   probe_names[i], where, (unsigned long)snap[i].count,
+                   (unsigned long)snap[i].min, (unsigned long)(snap[i].sum / snap[i].count),
+                   (unsigned long)snap[i].max);
+        }
+    }
+
+}
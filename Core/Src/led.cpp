@@ -1,18 +1,19 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "led.hpp"
+#include "irq_latency.h"
 
 Led::Led() : is_on_(false), counter_(0), current_duration_(0), 
              brightness_(50), brightness_step_(1), pwm_counter_(0), pwm_period_(5) {
     off();
 }
 
-void Led::on() {
+ITCM_FUNC void Led::on() {
     HAL_GPIO_WritePin(GPIOC, GPIO_PIN_13, GPIO_PIN_RESET);
     is_on_ = true;
 }
 
-void Led::off() {
+ITCM_FUNC void Led::off() {
     HAL_GPIO_WritePin(GPIOC, GPIO_PIN_13, GPIO_PIN_SET);
     is_on_ = false;
 }
@@ -32,7 +33,7 @@ void Led::set_brightness(uint8_t brightness) {
 
 // Breathing light effect using software PWM
 // Called once per millisecond from HAL_TIM_PeriodElapsedCallback
-void Led::breathing() {
+ITCM_FUNC void Led::breathing() {
     // Software PWM implementation
     // pwm_period_ = 10ms, update brightness every 10ms
     pwm_counter_++;
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include "gpio.h"
 #include "dma.h"  // ⭐ 添加DMA头文件
+#include "mdma.h"
 #include "fmc.h"
 #include "usart.h"
 #include "tim.h"
@@ -11,11 +12,21 @@
 
 #include "bsp_sdram.hpp"
 #include "test.hpp"
+#include "bench_sdram.hpp"
+#include "bench_mem.hpp"
+#include "bench_gfx.hpp"
+#include "bench_image.hpp"
+#include "bench_display.hpp"
+#include "mem_test.hpp"
+#include "sdram_map.hpp"
 #include "led.hpp"
 #include "uart.hpp"
 #include "system_setup.hpp"
 #include "ST7789.hpp"
 #include "clock_app.hpp"
+#include "digital_clock.hpp"
+#include "irq_latency.h"
+#include "timebase.hpp"
 
 
 // use static storage for Led instead of unique_ptr to avoid SDRAM allocation
@@ -26,18 +37,44 @@ Led* led_pc13_ptr = nullptr;
 static unsigned char lcd_storage[sizeof(ST7789)];
 ST7789* g_lcd_ptr = nullptr;
 
+// background SDRAM self-test over the area not used by the clock: frame buffers and
+// layers live in the first 1 MB, the hand sprite cache at 2-3 MB (see sdram_map.hpp)
+static test::MemTest sdram_bg_test({sdram_map::SELF_TEST, sdram_map::SELF_TEST_SIZE, 4096, true});
+
+/// @brief run one chunk of the SDRAM self-test, report and restart after each pass
+static void sdram_bg_test_step() {
+    if (!sdram_bg_test.step()) {
+        sdram_bg_test.print_report();
+        sdram_bg_test.restart();
+    }
+}
+
+/// @brief idle work of the clock app: SDRAM self-test and IRQ latency report every 5s
+static void app_idle_task() {
+    static uint32_t last_irq_report = 0;
+    sdram_bg_test_step();
+    if (HAL_GetTick() - last_irq_report >= 5000) {
+        last_irq_report = HAL_GetTick();
+        irq_probe_report();
+    }
+}
+
 /// @brief  application entry point
 /// @retval int type 0 reprentes success
 int main(void) {
+    ISR_Relocate();
     MPU_Config();
     SCB_EnableICache();
     SCB_EnableDCache();
     HAL_Init();
     SystemClock_Config();
+    timebase::init();   // 64-bit cycle clock, calibrated to the configured core clock
+    irq_probe_init();
 
     // initial all hardware peripherals
     MX_GPIO_Init();
     MX_DMA_Init();  // ⭐ 关键：必须在SPI初始化之前调用，启用DMA时钟
+    MX_MDMA_Init();
     MX_FMC_Init();
     // wakeup sdram after fmc init
     bsp::sdram::init_sequence(&hsdram1);
@@ -55,7 +92,10 @@ int main(void) {
     Uart::init(&huart1);
     printf("[%s] %s", "LOG", "STM32H743XIH6 started\r\n");
     // ⭐ Initialize LCD using placement new for DMA callback access
-    g_lcd_ptr = new (&lcd_storage) ST7789(&hspi5, GPIOJ, GPIO_PIN_11, GPIOH, GPIO_PIN_6);
+    // 纯色填充借用SDRAM起始处的两帧（与应用的帧缓冲区相同）
+    // 第二块屏：在另一路SPI上用自己的面板描述符和缓冲区再构造一个实例即可，发送完成中断按SPI句柄分发
+    g_lcd_ptr = new (&lcd_storage) ST7789(lcd::panels::st7789_240x280, &hspi5, GPIOJ, GPIO_PIN_11, GPIOH, GPIO_PIN_6,
+                                          (uint16_t*)sdram_map::FRAME0);
     g_lcd_ptr->init_basic();
 
     // register UART receive callback
@@ -66,12 +106,26 @@ int main(void) {
     HAL_TIM_Base_Start_IT(&htim7);
     printf("[%s] %s", "LOG", "system ready\r\n");
 
+    // SDRAM/FMC benchmark, run before the app takes over the frame buffers
+    // bench::sdram::run_report();
+    // bench::mem::run_report();
+    // bench::gfx2d::run_report();
+    // bench::gfx2d::run_rotozoom_report();
+    // bench::image::run_report();
+    // bench::display::run_report(*g_lcd_ptr);
+
     // ⭐ DMA双缓冲秒表应用（平滑指针）
     ClockApp stopwatch(g_lcd_ptr);
+    stopwatch.set_idle_task(app_idle_task);
+    stopwatch.set_late_latch(true);     // 画面时间外推到上屏时刻（关掉可对比[LATCH]的误差和抖动）
+    // 与屏刷新同步发送（无撕裂，帧率跟随屏的约59 Hz）：屏的TE脚接到一个空闲的EXTI 5..15引脚
+    // stopwatch.attach_te(GPIOJ, GPIO_PIN_12);
+    // stopwatch.set_frame_pacing(true);
+    // stopwatch.set_profile_report(true);  // 启动时对比三种MPU帧缓冲区属性下的帧循环耗时
     stopwatch.run();
     
     // 其他模式：
     // DigitalClock dclock(g_lcd_ptr); dclock.set_time(12, 30, 0); dclock.run();  // 数字时钟
     // g_lcd_ptr->color_cycle_loop();  // 彩虹动画
-    // g_lcd_ptr->clock_color_display();  // 颜色时钟
+    // DigitalClock cclock(g_lcd_ptr); cclock.set_time(12, 30, 45); cclock.set_color_mode(true); cclock.run();  // 颜色时钟
 }
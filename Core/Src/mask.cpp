@@ -0,0 +1,146 @@
+#include "mask.hpp"
+#include "scene.hpp"
+
+namespace {
+    // code byte types, 0x00 (transparent run) only advances the position
+    constexpr uint8_t CODE_SKIP    {0x00};
+    constexpr uint8_t CODE_OPAQUE  {0x40};
+    constexpr uint8_t CODE_LITERAL {0x80};
+    constexpr uint8_t CODE_MAX     {64};
+    constexpr uint8_t RUN_MIN      {4};     // shorter runs after a literal stay literal
+
+    class Writer {
+        public:
+            Writer(uint8_t* out, uint32_t capacity) : out_(out), capacity_(capacity), size_(0), lit_count_(0) {}
+
+            void run(uint8_t a4, uint32_t n) {
+                flush();
+                const uint8_t type = (a4 == 0) ? CODE_SKIP : CODE_OPAQUE;
+                while (n > 0) {
+                    uint32_t k = n < CODE_MAX ? n : CODE_MAX;
+                    put((uint8_t)(type | (k - 1)));
+                    n -= k;
+                }
+            }
+
+            void literal(uint8_t a4, uint32_t n) {
+                while (n-- > 0) {
+                    lit_[lit_count_++] = a4;
+                    if (lit_count_ == CODE_MAX) {
+                        flush();
+                    }
+                }
+            }
+
+            void flush() {
+                if (lit_count_ == 0) {
+                    return;
+                }
+                put((uint8_t)(CODE_LITERAL | (lit_count_ - 1)));
+                for (uint8_t i = 0; i < lit_count_; i += 2) {
+                    uint8_t hi = (i + 1 < lit_count_) ? lit_[i + 1] : 0;
+                    put((uint8_t)(lit_[i] | (hi << 4)));
+                }
+                lit_count_ = 0;
+            }
+
+            bool has_literal() const { return lit_count_ != 0; }
+            // overflow is sticky: size() reports 0
+            uint32_t size() const { return size_ <= capacity_ ? size_ : 0; }
+
+        private:
+            void put(uint8_t b) {
+                if (size_ < capacity_) {
+                    out_[size_] = b;
+                }
+                size_++;
+            }
+
+            uint8_t* out_;
+            uint32_t capacity_;
+            uint32_t size_;
+            uint8_t lit_[CODE_MAX];
+            uint8_t lit_count_;
+    };
+} // namespace
+
+namespace gfx {
+    namespace mask {
+
+        uint32_t encode(const SurfaceA8& coverage, uint8_t* out, uint32_t capacity) {
+            Writer writer(out, capacity);
+            const uint16_t w = coverage.width();
+            const uint32_t stride = coverage.stride();
+            const uint8_t* cov = coverage.data();
+            const uint32_t total = (uint32_t)w * coverage.height();
+            auto a4_at = [&](uint32_t i) {
+                return (uint8_t)((cov[(i / w) * stride + i % w] + 8) / 17);   // 0xNN -> 0xN, rounded
+            };
+            uint32_t i = 0;
+            while (i < total) {
+                const uint8_t v = a4_at(i);
+                uint32_t n = 1;
+                while (i + n < total && a4_at(i + n) == v) {
+                    n++;
+                }
+                if ((v == 0 || v == 15) && (n >= RUN_MIN || !writer.has_literal())) {
+                    writer.run(v, n);
+                } else {
+                    writer.literal(v, n);
+                }
+                i += n;
+            }
+            writer.flush();
+            return writer.size();
+        }
+
+        // runs become skipped / filled spans, literals per-pixel blends
+        void draw(Painter& p, const uint8_t* data, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                  uint16_t color, uint8_t alpha, bool antialias) {
+            if (w == 0 || !Rect{x, y, w, h}.intersects(p.clip())) {
+                return;
+            }
+            const uint8_t* s = data;
+            uint16_t col = 0;
+            int16_t row = y;
+            const int16_t row_end = y + h;
+            while (row < row_end) {
+                const uint8_t code = *s++;
+                const uint8_t type = code & 0xC0;
+                uint8_t n = (code & 0x3F) + 1;
+                if (type == CODE_LITERAL) {
+                    for (uint8_t i = 0; i < n; i++) {
+                        uint8_t a4 = (i & 1) ? (s[i / 2] >> 4) : (s[i / 2] & 0x0F);
+                        if (!antialias) {
+                            if (a4 >= 8) {
+                                p.plot(x + col, row, color, alpha);
+                            }
+                        } else if (a4 != 0) {
+                            p.plot(x + col, row, color, (uint8_t)(a4 * 17 * alpha / 255));   // 0xN -> 0xNN
+                        }
+                        if (++col == w) {
+                            col = 0;
+                            row++;
+                        }
+                    }
+                    s += (n + 1) / 2;
+                    continue;
+                }
+                // a run may wrap into the following rows
+                while (n > 0) {
+                    uint16_t k = (uint16_t)(w - col) < n ? (uint16_t)(w - col) : n;
+                    if (type == CODE_OPAQUE) {
+                        p.fill_span(row, x + col, x + col + k, color, alpha);
+                    }
+                    col += k;
+                    n -= (uint8_t)k;
+                    if (col == w) {
+                        col = 0;
+                        row++;
+                    }
+                }
+            }
+        }
+
+    } // namespace mask
+} // namespace gfx
@@ -0,0 +1,272 @@
+#include "mem_test.hpp"
+#include <stdio.h>
+
+namespace {
+    constexpr uint32_t CACHE_LINE {32};
+
+    /// March C-: {⇕(w0); ⇑(r0,w1); ⇑(r1,w0); ⇓(r0,w1); ⇓(r1,w0); ⇕(r0)}
+    struct MarchElement {
+        bool descending;
+        int8_t read;    // -1: no read, else expected background (0/1)
+        int8_t write;   // -1: no write, else background to write (0/1)
+    };
+
+    constexpr MarchElement MARCH_C[] = {
+        {false, -1,  0},
+        {false,  0,  1},
+        {false,  1,  0},
+        {true,   0,  1},
+        {true,   1,  0},
+        {false,  0, -1},
+    };
+    constexpr uint8_t MARCH_ELEMENTS = sizeof(MARCH_C) / sizeof(MARCH_C[0]);
+
+    inline uint32_t background(int8_t v) {
+        return v ? 0xFFFFFFFF : 0x00000000;
+    }
+
+    /// push a word to SDRAM and drop its line, so the next read really hits the device
+    inline void flush_word(volatile uint32_t* p) {
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t*)((uint32_t)p & ~(CACHE_LINE - 1)), CACHE_LINE);
+    }
+} // namespace
+
+namespace test {
+
+    MemTest::MemTest(const Config& cfg)
+        : cfg_(cfg), phase_(Phase::DataBus), element_(0), chunk_(0),
+          chunk_count_(cfg.bytes / cfg.chunk_bytes), mdma_pending_(false), mdma_ready_(false),
+          fault_count_(0), failing_bits_(0), passes_(0), faults_(), hmdma_(), fill_word_(0) {}
+
+    void MemTest::restart() {
+        if (mdma_pending_) {
+            HAL_MDMA_Abort(&hmdma_);
+            mdma_pending_ = false;
+        }
+        phase_ = Phase::DataBus;
+        element_ = 0;
+        chunk_ = 0;
+        fault_count_ = 0;
+        failing_bits_ = 0;
+        // no dirty line of the window may survive, it would later overwrite test data
+        SCB_CleanInvalidateDCache();
+    }
+
+    void MemTest::record(uint32_t addr, uint32_t expected, uint32_t actual) {
+        if (fault_count_ < MAX_FAULTS) {
+            MemFault& f = faults_[fault_count_];
+            f.address = addr;
+            f.expected = expected;
+            f.actual = actual;
+            f.failing_bits = expected ^ actual;
+            f.phase = (uint8_t)phase_;
+            f.element = (phase_ == Phase::March) ? element_ : 0;
+        }
+        fault_count_++;
+        failing_bits_ |= expected ^ actual;
+    }
+
+    // walking ones on a single word: every data line must toggle on its own
+    void MemTest::test_data_bus() {
+        volatile uint32_t* p = (volatile uint32_t*)cfg_.base;
+        for (uint32_t bit = 0; bit < 32; bit++) {
+            uint32_t pattern = 1U << bit;
+            *p = pattern;
+            flush_word(p);
+            uint32_t actual = *p;
+            if (actual != pattern) {
+                record((uint32_t)p, pattern, actual);
+            }
+        }
+    }
+
+    // power-of-two offsets: each address line is exercised on its own
+    void MemTest::test_address_bus() {
+        volatile uint32_t* p = (volatile uint32_t*)cfg_.base;
+        const uint32_t words = cfg_.bytes / sizeof(uint32_t);
+        const uint32_t pattern = 0xAAAAAAAA;
+        const uint32_t antipattern = 0x55555555;
+
+        auto flush_all = [&]() {
+            flush_word(&p[0]);
+            for (uint32_t off = 1; off < words; off <<= 1) {
+                flush_word(&p[off]);
+            }
+        };
+
+        for (uint32_t off = 1; off < words; off <<= 1) {
+            p[off] = pattern;
+        }
+        // address lines stuck high: writing offset 0 must not alias any other offset
+        p[0] = antipattern;
+        flush_all();
+        for (uint32_t off = 1; off < words; off <<= 1) {
+            uint32_t actual = p[off];
+            if (actual != pattern) {
+                record((uint32_t)&p[off], pattern, actual);
+            }
+        }
+        p[0] = pattern;
+
+        // address lines stuck low or shorted together
+        for (uint32_t test = 1; test < words; test <<= 1) {
+            p[test] = antipattern;
+            flush_all();
+            if (p[0] != pattern) {
+                record((uint32_t)&p[0], pattern, p[0]);
+            }
+            for (uint32_t off = 1; off < words; off <<= 1) {
+                uint32_t actual = p[off];
+                if (off != test && actual != pattern) {
+                    record((uint32_t)&p[off], pattern, actual);
+                }
+            }
+            p[test] = pattern;
+        }
+        flush_all();
+    }
+
+    bool MemTest::mdma_fill_start(uint32_t addr, uint32_t bytes, uint32_t pattern) {
+        if (!mdma_ready_) {
+            hmdma_.Instance = MDMA_Channel1;
+            hmdma_.Init.Request = MDMA_REQUEST_SW;
+            hmdma_.Init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+            hmdma_.Init.Priority = MDMA_PRIORITY_LOW;
+            hmdma_.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+            hmdma_.Init.SourceInc = MDMA_SRC_INC_DISABLE;
+            hmdma_.Init.DestinationInc = MDMA_DEST_INC_WORD;
+            hmdma_.Init.SourceDataSize = MDMA_SRC_DATASIZE_WORD;
+            hmdma_.Init.DestDataSize = MDMA_DEST_DATASIZE_WORD;
+            hmdma_.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+            hmdma_.Init.BufferTransferLength = 128;
+            hmdma_.Init.SourceBurst = MDMA_SOURCE_BURST_SINGLE;
+            hmdma_.Init.DestBurst = MDMA_DEST_BURST_16BEATS;
+            hmdma_.Init.SourceBlockAddressOffset = 0;
+            hmdma_.Init.DestBlockAddressOffset = 0;
+            if (HAL_MDMA_Init(&hmdma_) != HAL_OK) {
+                return false;
+            }
+            mdma_ready_ = true;
+        }
+        fill_word_ = pattern;
+        // lines are clean here (every chunk is flushed after use), dropping them is safe
+        SCB_InvalidateDCache_by_Addr((uint32_t*)addr, bytes);
+        return HAL_MDMA_Start(&hmdma_, (uint32_t)&fill_word_, addr, bytes, 1) == HAL_OK;
+    }
+
+    bool MemTest::mdma_busy() {
+        if (__HAL_MDMA_GET_FLAG(&hmdma_, MDMA_FLAG_CTC) == 0U) {
+            return true;
+        }
+        // flag already set: this returns at once and puts the handle back to READY
+        HAL_MDMA_PollForTransfer(&hmdma_, HAL_MDMA_FULL_TRANSFER, 1);
+        return false;
+    }
+
+    bool MemTest::march_chunk() {
+        const MarchElement& e = MARCH_C[element_];
+        const uint32_t index = e.descending ? (chunk_count_ - 1 - chunk_) : chunk_;
+        const uint32_t addr = cfg_.base + index * cfg_.chunk_bytes;
+
+        if (mdma_pending_) {
+            if (mdma_busy()) {
+                return true;
+            }
+            mdma_pending_ = false;
+            // drop anything speculatively allocated while MDMA was writing
+            SCB_InvalidateDCache_by_Addr((uint32_t*)addr, cfg_.chunk_bytes);
+        } else if (cfg_.use_mdma && e.read < 0 && mdma_fill_start(addr, cfg_.chunk_bytes, background(e.write))) {
+            mdma_pending_ = true;
+            return true;
+        } else {
+            volatile uint32_t* p = (volatile uint32_t*)addr;
+            const uint32_t words = cfg_.chunk_bytes / sizeof(uint32_t);
+            const uint32_t expected = background(e.read);
+            const uint32_t value = background(e.write);
+
+            for (uint32_t n = 0; n < words; n++) {
+                uint32_t i = e.descending ? (words - 1 - n) : n;
+                if (e.read >= 0) {
+                    uint32_t actual = p[i];
+                    if (actual != expected) {
+                        record((uint32_t)&p[i], expected, actual);
+                    }
+                }
+                if (e.write >= 0) {
+                    p[i] = value;
+                }
+            }
+            // write back and evict, the next element must read from the device
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t*)addr, cfg_.chunk_bytes);
+        }
+
+        if (++chunk_ >= chunk_count_) {
+            chunk_ = 0;
+            if (++element_ >= MARCH_ELEMENTS) {
+                element_ = 0;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool MemTest::step() {
+        switch (phase_) {
+            case Phase::DataBus:
+                test_data_bus();
+                phase_ = Phase::AddressBus;
+                return true;
+            case Phase::AddressBus:
+                test_address_bus();
+                phase_ = Phase::March;
+                return true;
+            case Phase::March:
+                if (!march_chunk()) {
+                    phase_ = Phase::Done;
+                    passes_++;
+                    return false;
+                }
+                return true;
+            case Phase::Done:
+            default:
+                return false;
+        }
+    }
+
+    uint32_t MemTest::run_blocking() {
+        restart();
+        while (step()) {
+        }
+        return fault_count_;
+    }
+
+    uint8_t MemTest::progress_percent() const {
+        switch (phase_) {
+            case Phase::DataBus:    return 0;
+            case Phase::AddressBus: return 1;
+            case Phase::Done:       return 100;
+            default: break;
+        }
+        uint32_t done = element_ * chunk_count_ + chunk_;
+        return (uint8_t)(2 + (uint64_t)done * 98 / (MARCH_ELEMENTS * chunk_count_));
+    }
+
+    void MemTest::print_report() const {
+        printf("[MEMTEST] pass %lu @0x%08lX %lu KB: %lu fault(s)\r\n",
+               (unsigned long)passes_, (unsigned long)cfg_.base,
+               (unsigned long)(cfg_.bytes / 1024), (unsigned long)fault_count_);
+        uint32_t shown = fault_count_ < MAX_FAULTS ? fault_count_ : MAX_FAULTS;
+        for (uint32_t i = 0; i < shown; i++) {
+            const MemFault& f = faults_[i];
+            static const char* const phase_names[] = {"data", "addr", "march", "done"};
+            printf("[MEMTEST]   @0x%08lX exp 0x%08lX got 0x%08lX bits 0x%08lX (%s e%u)\r\n",
+                   (unsigned long)f.address, (unsigned long)f.expected,
+                   (unsigned long)f.actual, (unsigned long)f.failing_bits,
+                   phase_names[f.phase], (unsigned int)f.element);
+        }
+        if (fault_count_ > 0) {
+            printf("[MEMTEST] failing DQ lines: 0x%04X\r\n", (unsigned int)failing_dq_lines());
+        }
+    }
+
+} // namespace test
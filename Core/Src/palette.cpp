@@ -0,0 +1,112 @@
+#include "palette.hpp"
+#include "accel2d.hpp"
+#include "irq_latency.h"
+
+namespace gfx {
+
+    Palette::Palette() : colors_(), size_(0), inverse_(nullptr) {}
+
+    int16_t Palette::add(uint16_t color) {
+        for (uint16_t i = 0; i < size_; i++) {
+            if (colors_[i] == color) {
+                return (int16_t)i;
+            }
+        }
+        if (size_ == MAX_COLORS) {
+            return -1;
+        }
+        colors_[size_] = color;
+        return (int16_t)size_++;
+    }
+
+    // the same blend_pixel the renderer uses, so ramp entries match rendered edges exactly
+    bool Palette::add_ramp(uint16_t from, uint16_t to, uint8_t steps) {
+        if (add(from) < 0 || add(to) < 0) {
+            return false;
+        }
+        for (uint8_t i = 1; i < steps; i++) {
+            if (add(Accel2D::blend_pixel(from, to, (uint8_t)(i * 255 / steps))) < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint16_t Palette::add_image(const uint16_t* pixels, uint32_t count, uint16_t max_new) {
+        uint16_t added = 0;
+        uint16_t last = 0;
+        bool have_last = false;
+        for (uint32_t i = 0; i < count && added < max_new; i++) {
+            const uint16_t c = pixels[i];
+            if (have_last && c == last) {
+                continue;   // runs are the common case, skip the search
+            }
+            last = c;
+            have_last = true;
+            const uint16_t before = size_;
+            if (add(c) < 0) {
+                break;
+            }
+            added += (uint16_t)(size_ - before);
+        }
+        return added;
+    }
+
+    // squared distance weighted 2:4:1 (R:G:B) on a 5-bit scale; the 6-bit green
+    // difference squared already carries the factor 4
+    uint8_t Palette::nearest(uint16_t color) const {
+        const int32_t r = color >> 11;
+        const int32_t g = (color >> 5) & 0x3F;
+        const int32_t b = color & 0x1F;
+        uint32_t best = UINT32_MAX;
+        uint8_t index = 0;
+        for (uint16_t i = 0; i < size_; i++) {
+            const uint16_t p = colors_[i];
+            const int32_t dr = r - (p >> 11);
+            const int32_t dg = g - ((p >> 5) & 0x3F);
+            const int32_t db = b - (p & 0x1F);
+            const uint32_t d = (uint32_t)(dr * dr * 2 + dg * dg + db * db);
+            if (d < best) {
+                best = d;
+                index = (uint8_t)i;
+                if (d == 0) {
+                    break;
+                }
+            }
+        }
+        return index;
+    }
+
+    void Palette::build_inverse(uint8_t* table) {
+        for (uint32_t c = 0; c < INVERSE_BYTES; c++) {
+            table[c] = nearest((uint16_t)c);
+        }
+        inverse_ = table;
+    }
+
+    void Palette::quantize(uint8_t* dst, const uint16_t* src, uint32_t n) const {
+        for (uint32_t i = 0; i < n; i++) {
+            dst[i] = inverse_[src[i]];
+        }
+    }
+
+    // runs in the SPI DMA-complete interrupt (ST7789 LUT transfers)
+    ITCM_FUNC void Palette::expand(uint16_t* dst, const uint8_t* src, uint32_t n, const uint16_t* lut) {
+        // four indices per word load
+        while (n >= 4) {
+            uint32_t q;
+            __builtin_memcpy(&q, src, 4);
+            dst[0] = lut[q & 0xFF];
+            dst[1] = lut[(q >> 8) & 0xFF];
+            dst[2] = lut[(q >> 16) & 0xFF];
+            dst[3] = lut[q >> 24];
+            dst += 4;
+            src += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dst++ = lut[*src++];
+        }
+    }
+
+} // namespace gfx
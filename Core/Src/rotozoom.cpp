@@ -0,0 +1,253 @@
+#include "rotozoom.hpp"
+#include <cmath>
+
+namespace {
+    constexpr float DEG_TO_RAD {3.14159265f / 180.0f};
+    constexpr int32_t ONE {1 << 16};
+    constexpr uint16_t MAX_SPAN {320};      // colours / alphas staged per put_span
+
+    // RGB565 spread to 0x07E0F81F so one multiply scales all channels
+    inline uint32_t spread(uint16_t c) {
+        return (c | ((uint32_t)c << 16)) & 0x07E0F81F;
+    }
+
+    inline uint16_t pack(uint32_t v) {
+        v &= 0x07E0F81F;
+        return (uint16_t)(v | (v >> 16));
+    }
+
+    // w in 0..32
+    inline uint32_t lerp(uint32_t a, uint32_t b, uint32_t w) {
+        return ((a * (32 - w) + b * w) >> 5) & 0x07E0F81F;
+    }
+
+    inline int32_t clamp(int32_t v, int32_t hi) {
+        return v < 0 ? 0 : (v > hi ? hi : v);
+    }
+
+    inline int32_t to_fixed(float v) {
+        return (int32_t)lroundf(v * ONE);
+    }
+
+    // columns x (relative to the span start) with 0 <= u0 + x * du < limit, as floats
+    void solve(float u0, float du, float limit, float& lo, float& hi) {
+        if (du == 0.0f) {
+            if (u0 < 0.0f || u0 >= limit) {
+                lo = 1.0f;
+                hi = 0.0f;
+            }
+            return;
+        }
+        float a = -u0 / du;
+        float b = (limit - u0) / du;
+        if (a > b) {
+            float t = a;
+            a = b;
+            b = t;
+        }
+        if (a > lo) lo = a;
+        if (b < hi) hi = b;
+    }
+
+    struct Stepper {
+        int32_t u;      // 16.16 at the span start, +0.5 so floor() is the nearest texel
+        int32_t v;
+        int32_t du;
+        int32_t dv;
+        int32_t limit_u;
+        int32_t limit_v;
+
+        bool inside(int32_t x) const {
+            int32_t su = u + x * du;
+            int32_t sv = v + x * dv;
+            return su >= 0 && su < limit_u && sv >= 0 && sv < limit_v;
+        }
+    };
+
+    void sample_nearest(const gfx::Texture& tex, int32_t u, int32_t v, int32_t du, int32_t dv,
+                        uint16_t n, uint8_t alpha, uint16_t* colors, uint8_t* alphas) {
+        for (uint16_t k = 0; k < n; k++) {
+            const uint32_t i = (uint32_t)(v >> 16) * tex.stride + (uint32_t)(u >> 16);
+            colors[k] = tex.pixels[i];
+            if (alphas != nullptr) {
+                uint32_t a = tex.alpha ? tex.alpha[i] : 255;
+                alphas[k] = (uint8_t)(alpha == 255 ? a : a * alpha / 255);
+            }
+            u += du;
+            v += dv;
+        }
+    }
+
+    void sample_bilinear(const gfx::Texture& tex, int32_t u, int32_t v, int32_t du, int32_t dv,
+                         uint16_t n, uint8_t alpha, uint16_t* colors, uint8_t* alphas) {
+        const int32_t max_x = tex.width - 1;
+        const int32_t max_y = tex.height - 1;
+        // taps around the sample: back to texel-centre coordinates
+        u -= ONE / 2;
+        v -= ONE / 2;
+        for (uint16_t k = 0; k < n; k++) {
+            const int32_t x0 = u >> 16;
+            const int32_t y0 = v >> 16;
+            const uint32_t fx = (uint32_t)(u >> 11) & 31;
+            const uint32_t fy = (uint32_t)(v >> 11) & 31;
+            const uint32_t r0 = (uint32_t)clamp(y0, max_y) * tex.stride;
+            const uint32_t r1 = (uint32_t)clamp(y0 + 1, max_y) * tex.stride;
+            const uint32_t c0 = (uint32_t)clamp(x0, max_x);
+            const uint32_t c1 = (uint32_t)clamp(x0 + 1, max_x);
+            const uint32_t top = lerp(spread(tex.pixels[r0 + c0]), spread(tex.pixels[r0 + c1]), fx);
+            const uint32_t bottom = lerp(spread(tex.pixels[r1 + c0]), spread(tex.pixels[r1 + c1]), fx);
+            colors[k] = pack(lerp(top, bottom, fy));
+            if (alphas != nullptr) {
+                uint32_t a = 255;
+                if (tex.alpha != nullptr) {
+                    uint32_t at = tex.alpha[r0 + c0] * (32 - fx) + tex.alpha[r0 + c1] * fx;
+                    uint32_t ab = tex.alpha[r1 + c0] * (32 - fx) + tex.alpha[r1 + c1] * fx;
+                    a = (at * (32 - fy) + ab * fy) >> 10;
+                }
+                alphas[k] = (uint8_t)(alpha == 255 ? a : a * alpha / 255);
+            }
+            u += du;
+            v += dv;
+        }
+    }
+} // namespace
+
+namespace gfx {
+
+    Rect rotozoom_bounds(const Texture& tex, const Affine& xf) {
+        const float c = cosf(xf.degrees * DEG_TO_RAD) * xf.scale;
+        const float s = sinf(xf.degrees * DEG_TO_RAD) * xf.scale;
+        const float corners[4][2] = {
+            {-0.5f, -0.5f}, {tex.width - 0.5f, -0.5f},
+            {-0.5f, tex.height - 0.5f}, {tex.width - 0.5f, tex.height - 0.5f},
+        };
+        float xmin = 1e9f, ymin = 1e9f, xmax = -1e9f, ymax = -1e9f;
+        for (const auto& p : corners) {
+            const float lx = p[0] - xf.pivot_x;
+            const float ly = p[1] - xf.pivot_y;
+            const float sx = xf.x + lx * c - ly * s;
+            const float sy = xf.y + lx * s + ly * c;
+            xmin = fminf(xmin, sx);
+            xmax = fmaxf(xmax, sx);
+            ymin = fminf(ymin, sy);
+            ymax = fmaxf(ymax, sy);
+        }
+        // pixel x covers [x - 0.5, x + 0.5)
+        int16_t x0 = (int16_t)floorf(xmin + 0.5f);
+        int16_t y0 = (int16_t)floorf(ymin + 0.5f);
+        int16_t x1 = (int16_t)ceilf(xmax + 0.5f);
+        int16_t y1 = (int16_t)ceilf(ymax + 0.5f);
+        return {x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+    }
+
+    uint32_t rotozoom(Painter& p, const Texture& tex, const Affine& xf, Sampling sampling, uint8_t alpha) {
+        if (alpha == 0 || xf.scale <= 0.0f || tex.width == 0 || tex.height == 0) {
+            return 0;
+        }
+        const Rect box = rotozoom_bounds(tex, xf).intersected(p.clip());
+        if (box.empty()) {
+            return 0;
+        }
+        // inverse rotation and scale: screen step -> texture step
+        const float c = cosf(xf.degrees * DEG_TO_RAD) / xf.scale;
+        const float s = sinf(xf.degrees * DEG_TO_RAD) / xf.scale;
+        const float dudx = c, dvdx = -s;
+        const float dudy = s, dvdy = c;
+        const float limit_u = tex.width;
+        const float limit_v = tex.height;
+        const bool need_alpha = tex.alpha != nullptr || alpha != 255;
+
+        Stepper st;
+        st.du = to_fixed(dudx);
+        st.dv = to_fixed(dvdx);
+        st.limit_u = tex.width * ONE;
+        st.limit_v = tex.height * ONE;
+
+        uint16_t colors[MAX_SPAN];
+        uint8_t alphas[MAX_SPAN];
+        uint32_t written = 0;
+        for (int16_t y = box.y; y < box.bottom(); y++) {
+            // sample at the first column of the box, +0.5 texel for floor()
+            const float dx = box.x - xf.x;
+            const float dy = y - xf.y;
+            const float u0 = xf.pivot_x + 0.5f + dx * dudx + dy * dudy;
+            const float v0 = xf.pivot_y + 0.5f + dx * dvdx + dy * dvdy;
+
+            // per-span edge setup: columns whose sample lands inside the texture
+            float lo = 0.0f;
+            float hi = box.w;
+            solve(u0, dudx, limit_u, lo, hi);
+            solve(v0, dvdx, limit_v, lo, hi);
+            if (lo > hi) {
+                continue;
+            }
+            st.u = to_fixed(u0);
+            st.v = to_fixed(v0);
+            // float estimate, then exact in fixed point (the inside set is one interval)
+            int32_t xs = (int32_t)floorf(lo);
+            int32_t xe = (int32_t)ceilf(hi) + 1;
+            if (xs < 0) xs = 0;
+            if (xe > box.w) xe = box.w;
+            while (xs < xe && !st.inside(xs)) xs++;
+            while (xe > xs && !st.inside(xe - 1)) xe--;
+            while (xs > 0 && st.inside(xs - 1)) xs--;
+            while (xe < box.w && st.inside(xe)) xe++;
+            if (xs >= xe) {
+                continue;
+            }
+
+            int32_t u = st.u + xs * st.du;
+            int32_t v = st.v + xs * st.dv;
+            for (int32_t x = xs; x < xe; x += MAX_SPAN) {
+                const uint16_t n = (uint16_t)((xe - x) < MAX_SPAN ? (xe - x) : MAX_SPAN);
+                if (sampling == Sampling::Bilinear) {
+                    sample_bilinear(tex, u, v, st.du, st.dv, n, alpha, colors, need_alpha ? alphas : nullptr);
+                } else {
+                    sample_nearest(tex, u, v, st.du, st.dv, n, alpha, colors, need_alpha ? alphas : nullptr);
+                }
+                p.put_span(y, box.x + x, box.x + x + n, colors, need_alpha ? alphas : nullptr);
+                u += n * st.du;
+                v += n * st.dv;
+                written += n;
+            }
+        }
+        return written;
+    }
+
+    // ========== TextureNode ==========
+
+    TextureNode::TextureNode(const Texture& texture, float pivot_x, float pivot_y, Sampling sampling)
+        : Node(0), texture_(texture), pivot_x_(pivot_x), pivot_y_(pivot_y), scale_(1.0f), sampling_(sampling) {}
+
+    void TextureNode::set_scale(float scale) {
+        if (scale != scale_) {
+            scale_ = scale;
+            invalidate();
+        }
+    }
+
+    void TextureNode::set_sampling(Sampling sampling) {
+        if (sampling != sampling_) {
+            sampling_ = sampling;
+            invalidate();
+        }
+    }
+
+    void TextureNode::set_texture(const Texture& texture) {
+        texture_ = texture;
+        invalidate();
+    }
+
+    Affine TextureNode::affine() const {
+        return {(float)x(), (float)y(), pivot_x_, pivot_y_, rotation(), scale_};
+    }
+
+    Rect TextureNode::extent() const {
+        return rotozoom_bounds(texture_, affine());
+    }
+
+    void TextureNode::render(Painter& p) const {
+        rotozoom(p, texture_, affine(), sampling_, alpha());
+    }
+
+} // namespace gfx
@@ -0,0 +1,108 @@
+#include "row_hash.hpp"
+
+RowHash::RowHash()
+    : hashes_(), rows_(0), width_(0), valid_(false), last_changed_(0), last_sent_(0), last_cycles_(0) {}
+
+uint32_t RowHash::crc_row(const uint16_t* row, uint16_t width) {
+    CRC->CR = CRC_CR_RESET;
+    const uint32_t* words = (const uint32_t*)row;
+    uint16_t n = width >> 1;
+    if (((uint32_t)row & 3U) != 0) {
+        // odd pixel offset: start with one halfword to reach word alignment
+        *(__IO uint16_t*)&CRC->DR = *row;
+        words = (const uint32_t*)(row + 1);
+        n = (width - 1) >> 1;
+        width--;
+    }
+    while (n--) {
+        CRC->DR = *words++;
+    }
+    if (width & 1U) {
+        *(__IO uint16_t*)&CRC->DR = *(const uint16_t*)words;
+    }
+    return CRC->DR;
+}
+
+uint8_t RowHash::add_span(Span* spans, uint8_t count, uint8_t max_spans, uint16_t y0, uint16_t y1) {
+    // extend the last span when the run continues it
+    if (count > 0 && spans[count - 1].y1 + 1 == y0) {
+        spans[count - 1].y1 = y1;
+        return count;
+    }
+    if (count < max_spans) {
+        spans[count] = {y0, y1};
+        return count + 1;
+    }
+    // out of spans: close the smallest gap, counting the new run as the last span
+    uint8_t best = count - 1;
+    uint16_t best_gap = y0 - spans[count - 1].y1;
+    for (uint8_t i = 0; i + 1 < count; i++) {
+        const uint16_t gap = spans[i + 1].y0 - spans[i].y1;
+        if (gap < best_gap) {
+            best_gap = gap;
+            best = i;
+        }
+    }
+    if (best == count - 1) {
+        spans[best].y1 = y1;
+        return count;
+    }
+    spans[best].y1 = spans[best + 1].y1;
+    for (uint8_t i = best + 1; i + 1 < count; i++) {
+        spans[i] = spans[i + 1];
+    }
+    spans[count - 1] = {y0, y1};
+    return count;
+}
+
+uint8_t RowHash::diff(const uint16_t* frame, uint16_t width, uint16_t height, Span* spans, uint8_t max_spans) {
+    const uint32_t start = DWT->CYCCNT;
+    if (max_spans == 0 || height == 0) {
+        return 0;
+    }
+    if (height > MAX_ROWS) {
+        rows_ = 0;
+        valid_ = false;
+        spans[0] = {0, (uint16_t)(height - 1)};
+        last_changed_ = height;
+        last_sent_ = height;
+        last_cycles_ = DWT->CYCCNT - start;
+        return 1;
+    }
+    if ((RCC->AHB4ENR & RCC_AHB4ENR_CRCEN) == 0) {
+        __HAL_RCC_CRC_CLK_ENABLE();
+    }
+
+    const bool compare = valid_ && rows_ == height && width_ == width;
+    uint8_t count = 0;
+    uint16_t changed = 0;
+    int32_t run_start = -1;
+    for (uint16_t y = 0; y < height; y++) {
+        const uint32_t h = crc_row(frame + (uint32_t)y * width, width);
+        const bool differs = !compare || h != hashes_[y];
+        hashes_[y] = h;
+        if (differs) {
+            changed++;
+            if (run_start < 0) {
+                run_start = y;
+            }
+        } else if (run_start >= 0) {
+            count = add_span(spans, count, max_spans, (uint16_t)run_start, y - 1);
+            run_start = -1;
+        }
+    }
+    if (run_start >= 0) {
+        count = add_span(spans, count, max_spans, (uint16_t)run_start, height - 1);
+    }
+    rows_ = height;
+    width_ = width;
+    valid_ = true;
+
+    last_changed_ = changed;
+    last_sent_ = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        last_sent_ += spans[i].y1 - spans[i].y0 + 1;
+    }
+    last_cycles_ = DWT->CYCCNT - start;
+    return count;
+}
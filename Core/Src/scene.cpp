@@ -0,0 +1,460 @@
+#include "scene.hpp"
+#include "accel2d.hpp"
+#include "fastmem.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace {
+    constexpr float DEG_TO_RAD {3.14159265f / 180.0f};
+
+    // pixel centres sit on integer coordinates
+    gfx::Rect bbox(float xmin, float ymin, float xmax, float ymax) {
+        int16_t x0 = (int16_t)floorf(xmin);
+        int16_t y0 = (int16_t)floorf(ymin);
+        int16_t x1 = (int16_t)ceilf(xmax);
+        int16_t y1 = (int16_t)ceilf(ymax);
+        return {x0, y0, (uint16_t)(x1 - x0 + 1), (uint16_t)(y1 - y0 + 1)};
+    }
+
+    // c: distance of the pixel centre inside the edge plus half a pixel
+    inline uint8_t edge_alpha(float c, uint8_t alpha) {
+        if (c >= 1.0f) {
+            return alpha;
+        }
+        return (c <= 0.0f) ? 0 : (uint8_t)(c * alpha);
+    }
+
+    inline float clamp01(float t) {
+        return t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    }
+
+    // segment a-b widened by r, round caps; a == b gives a disc
+    // without antialiasing a pixel is drawn when its centre is within r (edge alpha >= half)
+    void raster_capsule(gfx::Painter& p, float ax, float ay, float bx, float by, float r,
+                        uint16_t color, uint8_t alpha, bool antialias) {
+        gfx::Rect box = bbox(fminf(ax, bx) - r - 1, fminf(ay, by) - r - 1,
+                             fmaxf(ax, bx) + r + 1, fmaxf(ay, by) + r + 1).intersected(p.clip());
+        if (box.empty()) {
+            return;
+        }
+        const float dx = bx - ax;
+        const float dy = by - ay;
+        const float len2 = dx * dx + dy * dy;
+        const float inv = (len2 > 0.0f) ? 1.0f / len2 : 0.0f;
+        const float outer2 = antialias ? (r + 0.5f) * (r + 0.5f) : r * r;
+        // steep segments: each row only crosses a short span around the centre line
+        const bool steep = fabsf(dy) > fabsf(dx);
+        const float half = steep ? (r + 1.5f) * sqrtf(len2) / fabsf(dy) : 0.0f;
+
+        for (int16_t y = box.y; y < box.bottom(); y++) {
+            const float py = y - ay;
+            int16_t xs = box.x;
+            int16_t xe = box.right();
+            if (steep) {
+                float xc = ax + clamp01(py / dy) * dx;
+                int16_t lo = (int16_t)floorf(xc - half);
+                int16_t hi = (int16_t)ceilf(xc + half) + 1;
+                if (lo > xs) xs = lo;
+                if (hi < xe) xe = hi;
+            }
+            for (int16_t x = xs; x < xe; x++) {
+                const float px = x - ax;
+                const float t = clamp01((px * dx + py * dy) * inv);
+                const float ex = px - t * dx;
+                const float ey = py - t * dy;
+                const float d2 = ex * ex + ey * ey;
+                if (d2 >= outer2) {
+                    continue;
+                }
+                p.blend(x, y, color, antialias ? edge_alpha(r + 0.5f - sqrtf(d2), alpha) : alpha);
+            }
+        }
+    }
+} // namespace
+
+namespace gfx {
+
+    // ========== Painter ==========
+
+    Painter::Painter(const Surface565& target, const Rect& clip) : Painter(target, SurfaceA8(), clip) {}
+
+    Painter::Painter(const Surface565& target, const SurfaceA8& coverage, const Rect& clip)
+        : target_(target), coverage_(coverage.data()) {
+        target_.set_clip(clip.intersected(target.clip()));
+    }
+
+    void Painter::blend(int16_t x, int16_t y, uint16_t color, uint8_t alpha) {
+        if (alpha == 0) {
+            return;
+        }
+        const int32_t i = target_.offset(x, y);
+        uint16_t* px = target_.data() + i;
+        if (coverage_ == nullptr) {
+            *px = (alpha == 255) ? color : Accel2D::blend_pixel(*px, color, alpha);
+            return;
+        }
+        const uint8_t cov = coverage_[i];
+        if (cov == 0 || alpha == 255) {
+            *px = color;
+        } else {
+            // over an already covered pixel: mix colours, keep the stronger coverage
+            *px = Accel2D::blend_pixel(*px, color, alpha);
+        }
+        coverage_[i] = (alpha > cov) ? alpha : cov;
+    }
+
+    void Painter::fill_span(int16_t y, int16_t x0, int16_t x1, uint16_t color, uint8_t alpha) {
+        if (alpha == 0 || !target_.clip_span(y, x0, x1)) {
+            return;
+        }
+        if (alpha != 255) {
+            for (int16_t x = x0; x < x1; x++) {
+                blend(x, y, color, alpha);
+            }
+            return;
+        }
+        const int32_t i = target_.offset(x0, y);
+        fastmem::fill16(target_.data() + i, color, (uint32_t)(x1 - x0));
+        if (coverage_ != nullptr) {
+            std::memset(coverage_ + i, 255, (uint32_t)(x1 - x0));
+        }
+    }
+
+    void Painter::put_span(int16_t y, int16_t x0, int16_t x1, const uint16_t* colors, const uint8_t* alphas) {
+        const int16_t start = x0;
+        if (!target_.clip_span(y, x0, x1)) {
+            return;
+        }
+        colors += x0 - start;
+        if (alphas != nullptr) {
+            alphas += x0 - start;
+        }
+        const uint32_t n = (uint32_t)(x1 - x0);
+        const int32_t i = target_.offset(x0, y);
+        uint16_t* dst = target_.data() + i;
+        if (alphas == nullptr) {
+            fastmem::copy(dst, colors, n * sizeof(uint16_t));
+            if (coverage_ != nullptr) {
+                std::memset(coverage_ + i, 255, n);
+            }
+            return;
+        }
+        uint8_t* cov = coverage_ ? coverage_ + i : nullptr;
+        for (uint32_t k = 0; k < n; k++) {
+            const uint8_t a = alphas[k];
+            if (a == 0) {
+                continue;
+            }
+            if (cov == nullptr) {
+                dst[k] = (a == 255) ? colors[k] : Accel2D::blend_pixel(dst[k], colors[k], a);
+                continue;
+            }
+            // same rules as blend()
+            dst[k] = (cov[k] == 0 || a == 255) ? colors[k] : Accel2D::blend_pixel(dst[k], colors[k], a);
+            if (a > cov[k]) {
+                cov[k] = a;
+            }
+        }
+    }
+
+    // ========== Node ==========
+
+    Node::Node(uint16_t color)
+        : x_(0), y_(0), angle_(0.0f), cos_(1.0f), sin_(0.0f), color_(color), alpha_(255),
+          visible_(true), antialias_(true), dirty_(true), bounds_{0, 0, 0, 0}, next_(nullptr) {}
+
+    void Node::set_position(int16_t x, int16_t y) {
+        if (x != x_ || y != y_) {
+            x_ = x;
+            y_ = y;
+            invalidate();
+        }
+    }
+
+    void Node::set_rotation(float degrees) {
+        degrees = snap_rotation(degrees);
+        if (degrees != angle_) {
+            angle_ = degrees;
+            cos_ = cosf(degrees * DEG_TO_RAD);
+            sin_ = sinf(degrees * DEG_TO_RAD);
+            invalidate();
+        }
+    }
+
+    void Node::set_color(uint16_t color) {
+        if (color != color_) {
+            color_ = color;
+            invalidate();
+        }
+    }
+
+    void Node::set_alpha(uint8_t alpha) {
+        if (alpha != alpha_) {
+            alpha_ = alpha;
+            invalidate();
+        }
+    }
+
+    void Node::set_visible(bool visible) {
+        if (visible != visible_) {
+            visible_ = visible;
+            invalidate();
+        }
+    }
+
+    void Node::set_antialias(bool on) {
+        if (on != antialias_) {
+            antialias_ = on;
+            invalidate();
+        }
+    }
+
+    // clockwise on screen (y grows downwards)
+    void Node::to_screen(float lx, float ly, float& sx, float& sy) const {
+        sx = x_ + lx * cos_ - ly * sin_;
+        sy = y_ + lx * sin_ + ly * cos_;
+    }
+
+    // ========== Shapes ==========
+
+    CapsuleNode::CapsuleNode(float x0, float y0, float x1, float y1, float width, uint16_t color)
+        : Node(color), x0_(x0), y0_(y0), x1_(x1), y1_(y1), radius_(width / 2) {}
+
+    void CapsuleNode::set_points(float x0, float y0, float x1, float y1) {
+        if (x0 != x0_ || y0 != y0_ || x1 != x1_ || y1 != y1_) {
+            x0_ = x0;
+            y0_ = y0;
+            x1_ = x1;
+            y1_ = y1;
+            invalidate();
+        }
+    }
+
+    Rect CapsuleNode::extent() const {
+        float ax, ay, bx, by;
+        to_screen(x0_, y0_, ax, ay);
+        to_screen(x1_, y1_, bx, by);
+        return bbox(fminf(ax, bx) - radius_, fminf(ay, by) - radius_,
+                    fmaxf(ax, bx) + radius_, fmaxf(ay, by) + radius_);
+    }
+
+    void CapsuleNode::render(Painter& p) const {
+        float ax, ay, bx, by;
+        to_screen(x0_, y0_, ax, ay);
+        to_screen(x1_, y1_, bx, by);
+        raster_capsule(p, ax, ay, bx, by, radius_, color(), alpha(), antialias());
+    }
+
+    CircleNode::CircleNode(float radius, uint16_t color) : Node(color), radius_(radius) {}
+
+    void CircleNode::set_radius(float radius) {
+        if (radius != radius_) {
+            radius_ = radius;
+            invalidate();
+        }
+    }
+
+    Rect CircleNode::extent() const {
+        return bbox(x() - radius_ - 1, y() - radius_ - 1, x() + radius_ + 1, y() + radius_ + 1);
+    }
+
+    void CircleNode::render(Painter& p) const {
+        // pixels within radius fully covered, as the old fill_circle
+        raster_capsule(p, x(), y(), x(), y(), radius_ + 0.5f, color(), alpha(), antialias());
+    }
+
+    RingNode::RingNode(float radius, float thickness, uint16_t color)
+        : Node(color), radius_(radius), thickness_(thickness) {}
+
+    Rect RingNode::extent() const {
+        return bbox(x() - radius_ - 1, y() - radius_ - 1, x() + radius_ + 1, y() + radius_ + 1);
+    }
+
+    bool RingNode::covers(float, float) const {
+        return true;
+    }
+
+    // pixels from radius - thickness + 1 to radius are fully covered
+    void RingNode::render(Painter& p) const {
+        Rect box = extent().intersected(p.clip());
+        if (box.empty()) {
+            return;
+        }
+        const float r_out = radius_ + 0.5f;
+        const float r_in = radius_ - thickness_ + 0.5f;
+        const float outer2 = (r_out + 0.5f) * (r_out + 0.5f);
+        const float hole = r_in - 1.0f;     // nothing to draw closer than this
+        for (int16_t y = box.y; y < box.bottom(); y++) {
+            const float dy = y - this->y();
+            int16_t skip_lo = box.right();
+            int16_t skip_hi = box.right();
+            if (hole > 0.0f && fabsf(dy) < hole) {
+                float h = sqrtf(hole * hole - dy * dy);
+                skip_lo = (int16_t)ceilf(this->x() - h) + 1;
+                skip_hi = (int16_t)floorf(this->x() + h);
+            }
+            for (int16_t x = box.x; x < box.right(); x++) {
+                if (x >= skip_lo && x < skip_hi) {
+                    x = skip_hi - 1;
+                    continue;
+                }
+                const float dx = x - this->x();
+                const float d2 = dx * dx + dy * dy;
+                if (d2 >= outer2) {
+                    continue;
+                }
+                const float d = sqrtf(d2);
+                const float c = fminf(r_out + 0.5f - d, d - r_in + 0.5f);
+                if (c <= 0.0f || !covers(dx, dy)) {
+                    continue;
+                }
+                p.blend(x, y, color(), edge_alpha(c, alpha()));
+            }
+        }
+    }
+
+    ArcNode::ArcNode(float radius, float thickness, float start, float sweep, uint16_t color)
+        : RingNode(radius, thickness, color), start_(start), sweep_(sweep) {}
+
+    void ArcNode::set_sweep(float sweep) {
+        if (sweep != sweep_) {
+            sweep_ = sweep;
+            invalidate();
+        }
+    }
+
+    bool ArcNode::covers(float dx, float dy) const {
+        if (sweep_ >= 360.0f) {
+            return true;
+        }
+        // clockwise angle from "up"
+        float a = atan2f(dx, -dy) / DEG_TO_RAD - start_;
+        while (a < 0.0f) a += 360.0f;
+        while (a >= 360.0f) a -= 360.0f;
+        return a <= sweep_;
+    }
+
+    RectNode::RectNode(uint16_t w, uint16_t h, uint16_t color) : Node(color), w_(w), h_(h) {}
+
+    void RectNode::set_size(uint16_t w, uint16_t h) {
+        if (w != w_ || h != h_) {
+            w_ = w;
+            h_ = h;
+            invalidate();
+        }
+    }
+
+    Rect RectNode::extent() const {
+        return {x(), y(), w_, h_};
+    }
+
+    void RectNode::render(Painter& p) const {
+        for (int16_t y = this->y(); y < this->y() + h_; y++) {
+            p.fill_span(y, x(), x() + w_, color(), alpha());
+        }
+    }
+
+    TextNode::TextNode(const Font& font, const char* text, uint16_t color)
+        : Node(color), font_(&font), text_(), length_(0) {
+        set_text(text);
+    }
+
+    void TextNode::set_text(const char* text) {
+        uint8_t n = 0;
+        while (n < MAX_CHARS && text[n] != '\0') {
+            n++;
+        }
+        if (n == length_ && std::memcmp(text_, text, n) == 0) {
+            return;
+        }
+        std::memcpy(text_, text, n);
+        text_[n] = '\0';
+        length_ = n;
+        invalidate();
+    }
+
+    Rect TextNode::extent() const {
+        return font_->bounds(text_, x(), y());
+    }
+
+    void TextNode::render(Painter& p) const {
+        draw_text(p, *font_, x(), y(), text_, color(), alpha());
+    }
+
+    BitmapNode::BitmapNode(const uint16_t* pixels, uint16_t w, uint16_t h, uint32_t stride)
+        : Node(0), pixels_(pixels), w_(w), h_(h), stride_(stride) {}
+
+    void BitmapNode::set_pixels(const uint16_t* pixels) {
+        pixels_ = pixels;
+        invalidate();
+    }
+
+    Rect BitmapNode::extent() const {
+        return {x(), y(), w_, h_};
+    }
+
+    void BitmapNode::render(Painter& p) const {
+        Rect box = extent().intersected(p.clip());
+        for (int16_t y = box.y; y < box.bottom(); y++) {
+            const uint16_t* src = pixels_ + (uint32_t)(y - this->y()) * stride_ - this->x();
+            if (alpha() == 255) {
+                p.put_span(y, box.x, box.right(), src + box.x, nullptr);
+                continue;
+            }
+            for (int16_t x = box.x; x < box.right(); x++) {
+                p.blend(x, y, src[x], alpha());
+            }
+        }
+    }
+
+    // ========== Scene ==========
+
+    Scene::Scene(CanvasLayer* canvas, Compositor* compositor)
+        : canvas_(canvas), compositor_(compositor), head_(nullptr), tail_(nullptr), last_rendered_(0) {}
+
+    void Scene::add(Node* node) {
+        node->next_ = nullptr;
+        node->dirty_ = true;
+        if (tail_ == nullptr) {
+            head_ = node;
+        } else {
+            tail_->next_ = node;
+        }
+        tail_ = node;
+    }
+
+    Rect Scene::update() {
+        const Rect area = canvas_->area();
+        DamageList damage;
+        damage.clear();
+        for (Node* n = head_; n != nullptr; n = n->next_) {
+            if (!n->dirty_) {
+                continue;
+            }
+            Rect now = n->visible() ? n->extent().intersected(area) : Rect{0, 0, 0, 0};
+            damage.add(n->bounds_);
+            damage.add(now);
+            n->bounds_ = now;
+            n->dirty_ = false;
+        }
+        last_rendered_ = 0;
+        if (damage.empty()) {
+            return {0, 0, 0, 0};
+        }
+
+        for (uint8_t i = 0; i < damage.count; i++) {
+            const Rect& r = damage.rects[i];
+            canvas_->clear_rect(r);
+            Painter p(canvas_->surface(), canvas_->coverage_surface(), r);
+            for (Node* n = head_; n != nullptr; n = n->next_) {
+                if (n->visible() && n->bounds_.intersects(r)) {
+                    n->render(p);
+                    last_rendered_++;
+                }
+            }
+            compositor_->damage(canvas_->to_screen(r));
+        }
+        return canvas_->to_screen(damage.bounds());
+    }
+
+} // namespace gfx
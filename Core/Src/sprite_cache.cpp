@@ -0,0 +1,96 @@
+#include "sprite_cache.hpp"
+#include "mask.hpp"
+#include <cmath>
+
+namespace gfx {
+
+    // ========== SpriteCache ==========
+
+    SpriteCache::SpriteCache(uint8_t* storage, uint32_t bytes)
+        : storage_(storage), capacity_(bytes), entries_(nullptr), data_(nullptr),
+          angles_(0), used_(0) {}
+
+    // masks hold pure coverage: colour and alpha come from the drawing node
+    bool SpriteCache::build(Node& shape, uint16_t angles, CanvasLayer& scratch) {
+        const uint8_t alpha = shape.alpha();
+        const float rotation = shape.rotation();
+        shape.set_alpha(255);
+        bool ok = false;
+        for (uint16_t n = angles; n >= MIN_ANGLES && !ok; n /= 2) {
+            ok = try_build(shape, n, scratch);
+        }
+        shape.set_alpha(alpha);
+        shape.set_rotation(rotation);
+        return ok;
+    }
+
+    bool SpriteCache::try_build(Node& shape, uint16_t angles, CanvasLayer& scratch) {
+        angles_ = 0;
+        used_ = 0;
+        const uint32_t index_bytes = angles * sizeof(Entry);
+        if (index_bytes >= capacity_) {
+            return false;
+        }
+        entries_ = (Entry*)storage_;
+        data_ = storage_ + index_bytes;
+        const Rect area = scratch.area();
+        uint32_t offset = 0;
+        for (uint16_t i = 0; i < angles; i++) {
+            shape.set_rotation(i * 360.0f / angles);
+            Rect r = shape.extent().intersected(area);
+            Painter p(scratch.surface(), scratch.coverage_surface(), r);
+            shape.render(p);
+            uint32_t n = r.empty() ? 0 : mask::encode(scratch.coverage_surface().sub(r), data_ + offset,
+                                                      capacity_ - index_bytes - offset);
+            scratch.clear_rect(r);
+            if (!r.empty() && n == 0) {
+                return false;   // over budget
+            }
+            entries_[i] = {(int16_t)(r.x - shape.x()), (int16_t)(r.y - shape.y()),
+                           n ? r.w : (uint16_t)0, r.h, offset};
+            offset += n;
+        }
+        angles_ = angles;
+        used_ = index_bytes + offset;
+        return true;
+    }
+
+    uint16_t SpriteCache::index_of(float degrees) const {
+        int32_t i = (int32_t)floorf(degrees * angles_ / 360.0f + 0.5f) % angles_;
+        return (uint16_t)(i < 0 ? i + angles_ : i);
+    }
+
+    float SpriteCache::quantize(float degrees) const {
+        return angles_ ? index_of(degrees) * 360.0f / angles_ : degrees;
+    }
+
+    Rect SpriteCache::extent(int16_t x, int16_t y, float degrees) const {
+        if (!angles_) {
+            return {0, 0, 0, 0};
+        }
+        const Entry& e = entries_[index_of(degrees)];
+        return {(int16_t)(x + e.x), (int16_t)(y + e.y), e.w, e.h};
+    }
+
+    void SpriteCache::draw(Painter& p, int16_t x, int16_t y, float degrees, uint16_t color, uint8_t alpha,
+                           bool antialias) const {
+        if (!angles_) {
+            return;
+        }
+        const Entry& e = entries_[index_of(degrees)];
+        mask::draw(p, data_ + e.offset, x + e.x, y + e.y, e.w, e.h, color, alpha, antialias);
+    }
+
+    // ========== SpriteNode ==========
+
+    SpriteNode::SpriteNode(const SpriteCache& cache, uint16_t color) : Node(color), cache_(&cache) {}
+
+    Rect SpriteNode::extent() const {
+        return cache_->extent(x(), y(), rotation());
+    }
+
+    void SpriteNode::render(Painter& p) const {
+        cache_->draw(p, x(), y(), rotation(), color(), alpha(), antialias());
+    }
+
+} // namespace gfx
@@ -22,6 +22,7 @@
 #include "stm32h7xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "irq_latency.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -208,11 +209,11 @@ void SysTick_Handler(void)
 void DMA1_Stream0_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA1_Stream0_IRQn 0 */
-
+  irq_probe_enter(IRQ_PROBE_DMA1_STREAM0);
   /* USER CODE END DMA1_Stream0_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_spi5_tx);
   /* USER CODE BEGIN DMA1_Stream0_IRQn 1 */
-
+  irq_probe_reach(IRQ_PROBE_DMA1_STREAM0);
   /* USER CODE END DMA1_Stream0_IRQn 1 */
 }
 
@@ -222,7 +223,7 @@ void DMA1_Stream0_IRQHandler(void)
 void USART1_IRQHandler(void)
 {
   /* USER CODE BEGIN USART1_IRQn 0 */
-
+  irq_probe_enter(IRQ_PROBE_USART1);
   /* USER CODE END USART1_IRQn 0 */
   HAL_UART_IRQHandler(&huart1);
   /* USER CODE BEGIN USART1_IRQn 1 */
@@ -236,7 +237,7 @@ void USART1_IRQHandler(void)
 void TIM6_DAC_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM6_DAC_IRQn 0 */
-
+  irq_probe_enter(IRQ_PROBE_TIM6);
   /* USER CODE END TIM6_DAC_IRQn 0 */
   HAL_TIM_IRQHandler(&htim6);
   /* USER CODE BEGIN TIM6_DAC_IRQn 1 */
@@ -250,7 +251,7 @@ void TIM6_DAC_IRQHandler(void)
 void TIM7_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM7_IRQn 0 */
-
+  irq_probe_enter(IRQ_PROBE_TIM7);
   /* USER CODE END TIM7_IRQn 0 */
   HAL_TIM_IRQHandler(&htim7);
   /* USER CODE BEGIN TIM7_IRQn 1 */
@@ -264,7 +265,7 @@ void TIM7_IRQHandler(void)
 void SPI5_IRQHandler(void)
 {
   /* USER CODE BEGIN SPI5_IRQn 0 */
-
+  irq_probe_enter(IRQ_PROBE_SPI5);
   /* USER CODE END SPI5_IRQn 0 */
   HAL_SPI_IRQHandler(&hspi5);
   /* USER CODE BEGIN SPI5_IRQn 1 */
@@ -274,4 +275,28 @@ void SPI5_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles EXTI line[9:5] interrupts (panel TE, see FramePacer::attach_te).
+  */
+void EXTI9_5_IRQHandler(void)
+{
+  irq_probe_enter(IRQ_PROBE_TE);
+  for (uint32_t pin = GPIO_PIN_5; pin <= GPIO_PIN_9; pin <<= 1)
+  {
+    HAL_GPIO_EXTI_IRQHandler((uint16_t)pin);
+  }
+}
+
+/**
+  * @brief This function handles EXTI line[15:10] interrupts (panel TE, see FramePacer::attach_te).
+  */
+void EXTI15_10_IRQHandler(void)
+{
+  irq_probe_enter(IRQ_PROBE_TE);
+  for (uint32_t pin = GPIO_PIN_10; pin <= GPIO_PIN_15; pin <<= 1)
+  {
+    HAL_GPIO_EXTI_IRQHandler((uint16_t)pin);
+  }
+}
+
 /* USER CODE END 1 */
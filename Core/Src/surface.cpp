@@ -0,0 +1,41 @@
+#include "surface.hpp"
+
+namespace {
+    inline int16_t min16(int16_t a, int16_t b) { return a < b ? a : b; }
+    inline int16_t max16(int16_t a, int16_t b) { return a > b ? a : b; }
+} // namespace
+
+namespace gfx {
+
+    // ========== Rect ==========
+
+    Rect Rect::united(const Rect& o) const {
+        if (empty()) return o;
+        if (o.empty()) return *this;
+        int16_t x0 = min16(x, o.x);
+        int16_t y0 = min16(y, o.y);
+        int16_t x1 = max16(right(), o.right());
+        int16_t y1 = max16(bottom(), o.bottom());
+        return {x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+    }
+
+    Rect Rect::intersected(const Rect& o) const {
+        int16_t x0 = max16(x, o.x);
+        int16_t y0 = max16(y, o.y);
+        int16_t x1 = min16(right(), o.right());
+        int16_t y1 = min16(bottom(), o.bottom());
+        if (x1 <= x0 || y1 <= y0) {
+            return {0, 0, 0, 0};
+        }
+        return {x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+    }
+
+    Rect Rect::from_points(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t pad) {
+        int16_t lx = min16(x0, x1) - pad;
+        int16_t ly = min16(y0, y1) - pad;
+        int16_t hx = max16(x0, x1) + pad;
+        int16_t hy = max16(y0, y1) + pad;
+        return {lx, ly, (uint16_t)(hx - lx + 1), (uint16_t)(hy - ly + 1)};
+    }
+
+} // namespace gfx
@@ -1,4 +1,5 @@
 #include "system_setup.hpp"
+#include "mpu_profile.hpp"
 
 /// @brief  System Clock Configuration
 /// @retval None
@@ -44,6 +45,33 @@ void SystemClock_Config(void) {
     }
 }
 
+/// @brief Region 2: frame buffer window, overrides Region 0 (higher number wins)
+/// @note  the region is the power of two above the window, trimmed with subregions; the
+///        disabled eighths fall back to Region 0
+static void config_framebuffer_region(mpu::Profile profile) {
+    MPU_Region_InitTypeDef MPU_InitStruct = {0};
+    MPU_InitStruct.Enable = profile == mpu::Profile::WriteBack ? MPU_REGION_DISABLE : MPU_REGION_ENABLE;
+    MPU_InitStruct.Number = MPU_REGION_NUMBER2;
+    MPU_InitStruct.BaseAddress = mpu::FRAMEBUFFER_BASE;
+    MPU_InitStruct.Size = mpu::region_size(mpu::FRAMEBUFFER_SIZE);
+    MPU_InitStruct.SubRegionDisable = mpu::subregions_disabled(mpu::FRAMEBUFFER_SIZE);
+    MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
+    MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+    MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    if (profile == mpu::Profile::FramebufferNonCacheable) {
+        // TEX=1 C=0 B=0: normal memory, non-cacheable
+        MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+        MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+        MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+    } else {
+        // TEX=0 C=1 B=0: write-through, no write allocate
+        MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
+        MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+        MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+    }
+    HAL_MPU_ConfigRegion(&MPU_InitStruct);
+}
+
 /// @brief static function, also used in this source file
 void MPU_Config(void) {
     MPU_Region_InitTypeDef MPU_InitStruct = {0};
@@ -73,10 +101,66 @@ void MPU_Config(void) {
     MPU_InitStruct.Size = MPU_REGION_SIZE_128KB;
 
     HAL_MPU_ConfigRegion(&MPU_InitStruct);  // Apply Region 1 config
+
+    config_framebuffer_region(mpu::PROFILE);
+
+    if (mpu::PROFILE != mpu::Profile::WriteBack) {
+        // Region 3: D2 SRAM1-3 for small DMA buffers (.dma_sram), non-cacheable
+        MPU_InitStruct.Number = MPU_REGION_NUMBER3;
+        MPU_InitStruct.BaseAddress = mpu::DMA_SRAM_BASE;
+        MPU_InitStruct.Size = MPU_REGION_SIZE_512KB;
+        MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+        MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+        MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+        HAL_MPU_ConfigRegion(&MPU_InitStruct);
+    }
+
+    // D2 SRAM clocks are off after reset
+    __HAL_RCC_D2SRAM1_CLK_ENABLE();
+    __HAL_RCC_D2SRAM2_CLK_ENABLE();
+    __HAL_RCC_D2SRAM3_CLK_ENABLE();
+
     // Enables the MPU
     HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
 }
 
+// dirty lines of a window turning non-cacheable would be written back over later stores,
+// and stale ones would be read again when it turns cacheable
+void mpu::set_framebuffer_profile(mpu::Profile profile) {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t*)mpu::FRAMEBUFFER_BASE, (int32_t)mpu::FRAMEBUFFER_SIZE);
+    HAL_MPU_Disable();
+    config_framebuffer_region(profile);
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+// linker script symbols, see STM32H743XX_FLASH.ld
+extern "C" uint32_t _siitcm_text, _sitcm_text, _eitcm_text;
+extern "C" uint32_t _sisr_vector, _eisr_vector, _sram_vectors;
+
+/// @brief  copy the ITCM code image out of flash and, with ISR_IN_ITCM, move the
+///         vector table to DTCM
+/// @note   must run first in main(), before any interrupt or ITCM_FUNC is used
+void ISR_Relocate(void) {
+    const uint32_t* src = &_siitcm_text;
+    for (uint32_t* dst = &_sitcm_text; dst < &_eitcm_text; ) {
+        *dst++ = *src++;
+    }
+
+#if defined(ISR_IN_ITCM)
+    src = &_sisr_vector;
+    for (uint32_t* dst = &_sram_vectors; src < &_eisr_vector; ) {
+        *dst++ = *src++;
+    }
+    __disable_irq();
+    SCB->VTOR = (uint32_t)&_sram_vectors;
+    __DSB();
+    __enable_irq();
+#endif
+    // new instructions in ITCM must be visible to the fetch stage
+    __DSB();
+    __ISB();
+}
+
 /// @brief  This function is executed in case of error occurrence.
 /// @retval None
 void Error_Handler(void) {
@@ -0,0 +1,116 @@
+#include "timebase.hpp"
+#include "irq_latency.h"
+
+namespace {
+    /// value * (whole + frac / 2^shift), shift in [32, 63]
+    struct Ratio {
+        uint32_t whole;
+        uint32_t frac;
+        uint8_t shift;
+    };
+
+    uint32_t frequency_ = 0;
+    uint32_t last_low_ = 0;     // CYCCNT at the last read
+    uint32_t high_ = 0;         // wraps seen
+    Ratio to_us_ = {0, 0, 32};
+    Ratio to_ns_ = {0, 0, 32};
+    Ratio from_us_ = {0, 0, 32};
+
+    // num / den as whole part and the longest binary fraction that fits 32 bits, rounded up
+    Ratio make_ratio(uint32_t num, uint32_t den) {
+        Ratio r = {num / den, 0, 32};
+        uint64_t rem = num % den;
+        uint64_t q = 0;
+        uint8_t s = 0;
+        while (s < 63 && rem != 0) {
+            const uint64_t next = (q << 1) | ((rem << 1) >= den ? 1U : 0U);
+            if (next > 0xFFFFFFFFULL) {
+                break;
+            }
+            rem = (rem << 1) >= den ? (rem << 1) - den : rem << 1;
+            q = next;
+            s++;
+        }
+        if (s < 32) {
+            q <<= 32 - s;   // exact fraction found early
+            s = 32;
+        } else if (rem != 0 && q < 0xFFFFFFFFULL) {
+            q++;            // round up: exact multiples (480 cycles -> 1 us) must not come out one short
+        }
+        r.frac = (uint32_t)q;
+        r.shift = s;
+        return r;
+    }
+
+    // 64 x 32 bit multiply, 96-bit product shifted right by r.shift
+    inline uint64_t apply(uint64_t v, const Ratio& r) {
+        const uint64_t lo = (uint64_t)(uint32_t)v * r.frac;
+        const uint64_t hi = (v >> 32) * r.frac;
+        const uint64_t mid = (lo >> 32) + (uint32_t)hi;     // bits 32..64 of the product
+        const uint64_t top = (hi >> 32) + (mid >> 32);      // bits 64..95
+        const uint64_t frac = (top << (64 - r.shift)) | ((uint32_t)mid >> (r.shift - 32));
+        return v * r.whole + frac;
+    }
+} // namespace
+
+namespace timebase {
+
+    void init() {
+        if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        }
+        calibrate();
+    }
+
+    void calibrate() {
+        frequency_ = SystemCoreClock;
+        to_us_ = make_ratio(1000000U, frequency_);
+        to_ns_ = make_ratio(1000000000U, frequency_);
+        from_us_ = make_ratio(frequency_, 1000000U);
+    }
+
+    void poll() {
+        (void)cycles();
+    }
+
+    uint32_t frequency() {
+        return frequency_;
+    }
+
+    ITCM_FUNC uint64_t cycles() {
+        const uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        const uint32_t low = DWT->CYCCNT;
+        if (low < last_low_) {
+            high_++;
+        }
+        last_low_ = low;
+        const uint64_t now = ((uint64_t)high_ << 32) | low;
+        __set_PRIMASK(primask);
+        return now;
+    }
+
+    uint64_t to_us(uint64_t cycles) {
+        return apply(cycles, to_us_);
+    }
+
+    uint64_t to_ns(uint64_t cycles) {
+        return apply(cycles, to_ns_);
+    }
+
+    uint64_t from_us(uint64_t us) {
+        return apply(us, from_us_);
+    }
+
+    void wait_until(uint64_t at) {
+        while (cycles() < at) {
+        }
+    }
+
+    uint64_t Deadline::remaining_us() const {
+        const uint64_t now = timebase::cycles();
+        return now >= at_ ? 0 : to_us(at_ - now);
+    }
+
+} // namespace timebase
@@ -1,4 +1,5 @@
 #include "uart.hpp"
+#include "irq_latency.h"
 #include <stdio.h>
 
 /// @brief initialize static variables
@@ -29,7 +30,7 @@ int Uart::read() {
 }
 
 /// @brief UART interrupt service routine handler
-void Uart::isr_handler() {
+ITCM_FUNC void Uart::isr_handler() {
     rx_buffer_.push(rx_data_);
     if (rx_callback_) {
         rx_callback_(rx_data_);
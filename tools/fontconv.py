@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+"""Glyph atlas converter for the gfx font engine (Core/Inc/font.hpp).
+
+Rasterizes glyphs with anti-aliasing, quantizes coverage to 4 bits per pixel,
+RLE-compresses every glyph and writes a header with constexpr arrays.
+
+Stream, row-major over the glyph box, codes may wrap rows. Each code byte has
+a 2 bit type and a 6 bit count - 1 (1..64 pixels):
+    00  transparent run         (alpha 0)
+    01  opaque run              (alpha 15)
+    10  literal pixels, followed by ceil(count / 2) bytes of 4 bpp alpha,
+        low nibble first
+Runs map directly to skipped / filled spans on the device, literals carry the
+anti-aliased edges.
+
+Sources:
+    built-in stroke font (default, no dependencies, rounded "watch" digits)
+    --ttf FILE            any TrueType/OpenType font, needs Pillow
+
+Kerning pairs are computed from the ink profiles for every pair without a digit
+or a space (digits stay tabular so changing numbers do not jitter).
+
+Examples:
+    tools/fontconv.py --name stroke20 --size 20 --chars "0123456789:.%-/ CFMPSU" \
+        -o Core/Inc/font_stroke20.hpp
+    tools/fontconv.py --name lato24 --size 24 --ttf Lato-Regular.ttf -o font_lato24.hpp
+"""
+
+import argparse
+import math
+import sys
+
+SUPERSAMPLE = 4
+SIDE_BEARING = 1.2  # stroke font units added to every advance
+
+# ---------------------------------------------------------------------------
+# built-in stroke font: glyphs on a 10 unit cap height, y grows downwards
+# ---------------------------------------------------------------------------
+
+
+def arc(cx, cy, rx, ry, a0, a1, steps=24):
+    """points on an ellipse from angle a0 to a1 (degrees, 0 = right, 90 = up)"""
+    pts = []
+    for i in range(steps + 1):
+        t = math.radians(a0 + (a1 - a0) * i / steps)
+        pts.append((cx + rx * math.cos(t), cy - ry * math.sin(t)))
+    return pts
+
+
+def ellipse(cx, cy, rx, ry):
+    return arc(cx, cy, rx, ry, 0, 360, 48)
+
+
+def rotate180(strokes, w=6.0, h=10.0):
+    return [[(w - x, h - y) for (x, y) in s] for s in strokes]
+
+
+def stroke_glyphs():
+    six = [arc(3, 5, 3, 5, 50, 200), ellipse(3, 7, 3, 3)]
+    g = {
+        '0': [ellipse(3, 5, 3, 5)],
+        '1': [[(1.2, 2.2), (3.5, 0), (3.5, 10)]],
+        '2': [arc(3, 3, 3, 3, 160, -30) + [(0, 10), (6, 10)]],
+        '3': [arc(3, 2.6, 2.8, 2.6, 150, -90), arc(3, 7.4, 3, 2.6, 90, -150)],
+        '4': [[(4.5, 10), (4.5, 0), (0, 7), (6, 7)]],
+        '5': [[(5.6, 0), (0.6, 0), (0.4, 5.2)] + arc(3, 6.8, 3, 3.2, 150, -150)],
+        '6': six,
+        '7': [[(0, 0), (6, 0), (2, 10)]],
+        '8': [ellipse(3, 2.6, 2.6, 2.6), ellipse(3, 7.4, 3, 2.6)],
+        '9': rotate180(six),
+        ':': [[(1.5, 3)], [(1.5, 8)]],
+        '.': [[(1.5, 9.5)]],
+        '%': [ellipse(1.3, 1.8, 1.2, 1.6), ellipse(4.7, 8.2, 1.2, 1.6), [(5.5, 0), (0.5, 10)]],
+        '-': [[(0.5, 5.5), (3.5, 5.5)]],
+        '/': [[(4, 0), (0, 10)]],
+        ' ': [],
+        'C': [arc(3.3, 5, 3, 5, 50, 310)],
+        'F': [[(5.5, 0), (0.5, 0), (0.5, 10)], [(0.5, 4.8), (4.5, 4.8)]],
+        'M': [[(0.3, 10), (0.6, 0), (3, 7), (5.4, 0), (5.7, 10)]],
+        'P': [[(0.5, 10), (0.5, 0), (3.3, 0)] + arc(3.3, 2.6, 2.4, 2.6, 90, -90) + [(0.5, 5.2)]],
+        'S': [arc(3, 2.6, 2.7, 2.6, 30, 270) + arc(3, 7.4, 2.8, 2.6, 90, -150)],
+        'U': [[(0.5, 0)] + arc(3, 7, 2.5, 3, 180, 360) + [(5.5, 0)]],
+    }
+    # advance in units; the ink of narrow glyphs is already drawn near x = 0
+    advance = {':': 3.0, '.': 3.0, '-': 4.0, '/': 4.0, ' ': 4.0}
+    return g, advance
+
+
+def seg_dist(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    l2 = dx * dx + dy * dy
+    t = 0.0 if l2 == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / l2))
+    ex, ey = px - ax - t * dx, py - ay - t * dy
+    return math.sqrt(ex * ex + ey * ey)
+
+
+def render_stroke(strokes, adv_units, size, weight, bearing):
+    """coverage rows (0..1) of one glyph cell, origin = top-left of the line"""
+    scale = size / 10.0
+    half = weight * scale / 2
+    pad = int(math.ceil(half)) + 1
+    w = int(math.ceil((adv_units + bearing) * scale)) + 2 * pad
+    h = size + 2 * pad
+    segs = []
+    for s in strokes:
+        pts = [((x + bearing) * scale + pad, (y * scale) + pad) for (x, y) in s]
+        if len(pts) == 1:
+            pts = pts * 2
+        segs += [(pts[i][0], pts[i][1], pts[i + 1][0], pts[i + 1][1]) for i in range(len(pts) - 1)]
+    rows = []
+    ss = SUPERSAMPLE
+    for y in range(h):
+        row = []
+        for x in range(w):
+            hit = 0
+            for sy in range(ss):
+                for sx in range(ss):
+                    px = x + (sx + 0.5) / ss
+                    py = y + (sy + 0.5) / ss
+                    if any(seg_dist(px, py, *sg) <= half for sg in segs):
+                        hit += 1
+            row.append(hit / (ss * ss))
+        rows.append(row)
+    return rows, -pad, -pad
+
+
+def load_stroke(size, chars, weight):
+    shapes, adv = stroke_glyphs()
+    scale = size / 10.0
+    out = {}
+    for ch in chars:
+        if ch not in shapes:
+            sys.exit("stroke font has no glyph for %r" % ch)
+        a = adv.get(ch, 6.0)
+        # ink centred in the rounded advance so it stays inside the advance box
+        adv_px = int(round((a + SIDE_BEARING) * scale))
+        cov, ox, oy = render_stroke(shapes[ch], a, size, weight, (adv_px / scale - a) / 2)
+        out[ch] = (cov, ox, oy, adv_px)
+    line_height = int(math.ceil(size * 1.2))
+    top = int(math.ceil(size * 0.1))  # leading above the cap height
+    return {ch: (cov, ox, oy + top, adv) for ch, (cov, ox, oy, adv) in out.items()}, line_height
+
+
+def load_ttf(path, size, chars):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("--ttf needs Pillow (pip install pillow)")
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    out = {}
+    for ch in chars:
+        adv = int(round(font.getlength(ch)))
+        l, t, r, b = font.getbbox(ch)
+        w, h = max(r - l, 1), max(b - t, 1)
+        img = Image.new("L", (w, h), 0)
+        ImageDraw.Draw(img).text((-l, -t), ch, font=font, fill=255)
+        px = img.load()
+        cov = [[px[x, y] / 255.0 for x in range(w)] for y in range(h)]
+        out[ch] = (cov, l, t, adv)
+    return out, ascent + descent
+
+
+# ---------------------------------------------------------------------------
+# atlas building
+# ---------------------------------------------------------------------------
+
+
+def crop(cov, ox, oy):
+    """trim transparent borders, adjust offsets"""
+    q = [[int(round(c * 15)) for c in row] for row in cov]
+    ys = [y for y, row in enumerate(q) if any(row)]
+    if not ys:
+        return [], 0, 0, 0, 0
+    xs = [x for x in range(len(q[0])) if any(row[x] for row in q)]
+    y0, y1, x0, x1 = ys[0], ys[-1], xs[0], xs[-1]
+    q = [row[x0:x1 + 1] for row in q[y0:y1 + 1]]
+    return q, x1 - x0 + 1, y1 - y0 + 1, ox + x0, oy + y0
+
+
+RUN_MIN = 4     # shorter 0/15 runs are cheaper inside a literal
+
+
+def rle(q):
+    flat = [v for row in q for v in row]
+    out = []
+    lit = []
+
+    def flush():
+        while lit:
+            chunk = lit[:64]
+            del lit[:64]
+            out.append(0x80 | (len(chunk) - 1))
+            for i in range(0, len(chunk), 2):
+                lo = chunk[i]
+                hi = chunk[i + 1] if i + 1 < len(chunk) else 0
+                out.append(lo | (hi << 4))
+
+    i = 0
+    while i < len(flat):
+        v = flat[i]
+        n = 1
+        while i + n < len(flat) and flat[i + n] == v:
+            n += 1
+        if v in (0, 15) and (n >= RUN_MIN or not lit):
+            flush()
+            left = n
+            while left > 0:
+                k = min(left, 64)
+                out.append((0x00 if v == 0 else 0x40) | (k - 1))
+                left -= k
+        else:
+            lit += [v] * n
+        i += n
+    flush()
+    return out
+
+
+def profile(g):
+    """per-row (left, right) ink extent in line coordinates, None when empty"""
+    q, w, h, ox, oy, adv = g
+    prof = {}
+    for y in range(h):
+        xs = [x for x in range(w) if q[y][x] >= 4]
+        if xs:
+            prof[oy + y] = (ox + xs[0], ox + xs[-1])
+    return prof
+
+
+def kerning(glyphs, chars):
+    """pull pairs together / apart so the closest ink gap matches the digit gap"""
+    prof = {ch: profile(glyphs[ch]) for ch in chars}
+    ref = min_gap(prof['0'], prof['0'], glyphs['0'][5]) if '0' in prof else None
+    pairs = []
+    for a in chars:
+        for b in chars:
+            # digits (and what touches them) stay tabular: readouts must not jitter
+            if a.isdigit() or b.isdigit() or a == ' ' or b == ' ' or ref is None:
+                continue
+            gap = min_gap(prof[a], prof[b], glyphs[a][5])
+            if gap is None:
+                continue
+            adj = int(round((ref - gap) / 2))  # half way, keeps round shapes airy
+            if adj != 0:
+                pairs.append((a, b, max(-128, min(127, adj))))
+    return pairs
+
+
+def min_gap(pa, pb, advance):
+    rows = set(pa) & set(pb)
+    if not rows:
+        return None
+    return min(advance + pb[y][0] - pa[y][1] for y in rows)
+
+
+def c_char(ch):
+    return "'\\''" if ch == "'" else ("'\\\\'" if ch == '\\' else "'%s'" % ch)
+
+
+def write_header(path, name, size, line_height, chars, glyphs, pairs, source):
+    """emit the atlas; offsets index the code stream of each glyph"""
+    data = []
+    entries = []
+    for ch in chars:
+        q, w, h, ox, oy, adv = glyphs[ch]
+        entries.append((ord(ch), w, h, ox, oy, adv, len(data), ch))
+        data += rle(q)
+    raw = sum(w * h for (_, w, h, *_rest) in entries)
+    lines = []
+    lines.append("/// @file    font_%s.hpp" % name)
+    lines.append("/// @brief   %d px anti-aliased glyph atlas (%s), 4 bpp run/literal coded" % (size, source))
+    lines.append("/// @note    generated by tools/fontconv.py, do not edit: %d glyphs, %d bytes coded"
+                 " (%d bytes as plain 4 bpp)" % (len(entries), len(data), (raw + 1) // 2))
+    lines.append("#pragma once")
+    lines.append('#include "font.hpp"')
+    lines.append("")
+    lines.append("namespace gfx::fonts {")
+    lines.append("")
+    lines.append("    inline constexpr uint8_t %s_rle[] = {" % name)
+    for i in range(0, len(data), 16):
+        lines.append("        " + ", ".join("0x%02X" % v for v in data[i:i + 16]) + ",")
+    lines.append("    };")
+    lines.append("")
+    lines.append("    // code, w, h, x_off, y_off, advance, offset (sorted by code)")
+    lines.append("    inline constexpr GlyphInfo %s_glyphs[] = {" % name)
+    for code, w, h, ox, oy, adv, off, ch in sorted(entries):
+        lines.append("        {0x%02X, %2d, %2d, %3d, %3d, %2d, %5d},  // %s" % (code, w, h, ox, oy, adv, off, ch))
+    lines.append("    };")
+    lines.append("")
+    if pairs:
+        lines.append("    // left, right, adjust (sorted by left, right)")
+        lines.append("    inline constexpr KernPair %s_kerning[] = {" % name)
+        for a, b, adj in sorted(pairs, key=lambda p: (ord(p[0]), ord(p[1]))):
+            lines.append("        {0x%02X, 0x%02X, %2d},  // %s%s" % (ord(a), ord(b), adj, a, b))
+        lines.append("    };")
+        kern_ref, kern_n = "%s_kerning" % name, "sizeof(%s_kerning) / sizeof(KernPair)" % name
+    else:
+        kern_ref, kern_n = "nullptr", "0"
+    lines.append("")
+    lines.append("    inline constexpr Font %s = {" % name)
+    lines.append("        %s_glyphs, sizeof(%s_glyphs) / sizeof(GlyphInfo)," % (name, name))
+    lines.append("        %s_rle," % name)
+    lines.append("        %s, %s," % (kern_ref, kern_n))
+    lines.append("        %d," % line_height)
+    lines.append("    };")
+    lines.append("")
+    lines.append("} // namespace gfx::fonts")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%s: %d glyphs, %d kerning pairs, %d bytes coded (%d bytes 4bpp)"
+          % (path, len(entries), len(pairs), len(data), (raw + 1) // 2))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--name", required=True, help="C++ identifier of the font")
+    ap.add_argument("--size", type=int, required=True, help="cap height (stroke) or pixel size (ttf)")
+    ap.add_argument("--chars", default="0123456789:.%-/ CFMPSU")
+    ap.add_argument("--weight", type=float, default=1.1, help="stroke width in units of 1/10 cap height")
+    ap.add_argument("--ttf", help="TrueType/OpenType source instead of the stroke font")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    chars = "".join(sorted(set(args.chars), key=ord))
+    if args.ttf:
+        cells, line_height = load_ttf(args.ttf, args.size, chars)
+        source = args.ttf.split("/")[-1]
+    else:
+        cells, line_height = load_stroke(args.size, chars, args.weight)
+        source = "built-in stroke font, weight %.2f" % args.weight
+    glyphs = {}
+    for ch, (cov, ox, oy, adv) in cells.items():
+        q, w, h, gx, gy = crop(cov, ox, oy)
+        glyphs[ch] = (q, w, h, gx, gy, adv)
+    pairs = kerning(glyphs, chars)
+    write_header(args.output, args.name, args.size, line_height, chars, glyphs, pairs, source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""RGB565 image converter for the gfx image decoder (Core/Inc/image.hpp).
+
+Converts a PNG (or a raw little-endian RGB565 dump) into a losslessly
+compressed stream and writes a header with constexpr arrays. Colours are
+reduced to RGB565 the same way as ST7789::rgb_to_rgb565 (truncation), so an
+image saved from RGB565 data round-trips exactly.
+
+Stream, raster order, one op per byte plus operands. A decoder keeps the
+previous pixel (initially 0) and a 64 entry table of recent colours (initially
+0); DIFF, LUMA and RAW pixels are stored at hash(r, g, b) = (3r + 5g + 7b) % 64
+on the 5/6/5 bit channel values. Channel differences wrap (mod 32 / 64 / 32).
+    00iiiiii                      INDEX   table[i]
+    01rrggbb                      DIFF    dr, dg, db in -2..1 (stored + 2)
+    10gggggg rrrrbbbb             LUMA    dg in -32..31 (stored + 32),
+                                          dr - dg/2, db - dg/2 in -8..7 (stored + 8)
+    110nnnnn                      RUN     previous pixel n + 1 times (1..32)
+    111nnnnn nnnnnnnn             LONG    previous pixel n + 33 times (n < 0x1F00)
+    11111111 llllllll hhhhhhhh    RAW     RGB565, little endian
+
+Examples:
+    tools/imgconv.py --name dial_face assets/dial_face.png -o Core/Inc/image_dial_face.hpp
+    tools/imgconv.py --name splash --raw 240x280 splash.rgb565 -o splash.hpp
+"""
+
+import argparse
+import struct
+import sys
+
+RUN_MAX = 32
+LONG_MAX = 0x1EFF + 33
+
+
+def split(p):
+    return p >> 11, (p >> 5) & 0x3F, p & 0x1F
+
+
+def hash565(p):
+    r, g, b = split(p)
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def wrap(v, bits):
+    """signed difference of two channel values modulo 2^bits"""
+    v &= (1 << bits) - 1
+    return v - (1 << bits) if v >= 1 << (bits - 1) else v
+
+
+def encode(pixels):
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    i = 0
+    n = len(pixels)
+    while i < n:
+        p = pixels[i]
+        if p == prev:
+            run = 1
+            while i + run < n and pixels[i + run] == prev and run < LONG_MAX:
+                run += 1
+            if run <= RUN_MAX:
+                out.append(0xC0 | (run - 1))
+            else:
+                v = run - 33
+                out += bytes((0xE0 | (v >> 8), v & 0xFF))
+            i += run
+            continue
+        h = hash565(p)
+        if index[h] == p:
+            out.append(h)
+        else:
+            r, g, b = split(p)
+            pr, pg, pb = split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            dr_dg, db_dg = dr - (dg >> 1), db - (dg >> 1)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out += bytes((0x80 | (dg + 32), ((dr_dg + 8) << 4) | (db_dg + 8)))
+            else:
+                out += bytes((0xFF, p & 0xFF, p >> 8))
+            index[h] = p
+        prev = p
+        i += 1
+    return bytes(out)
+
+
+def decode(data, count):
+    """reference decoder, used to verify every conversion"""
+    out = []
+    index = [0] * 64
+    prev = 0
+    i = 0
+    while len(out) < count:
+        op = data[i]
+        i += 1
+        if op == 0xFF:
+            prev = data[i] | (data[i + 1] << 8)
+            i += 2
+            index[hash565(prev)] = prev
+            out.append(prev)
+        elif op >= 0xE0:
+            out += [prev] * ((((op & 0x1F) << 8) | data[i]) + 33)
+            i += 1
+        elif op >= 0xC0:
+            out += [prev] * ((op & 0x1F) + 1)
+        elif op >= 0x80:
+            dg = (op & 0x3F) - 32
+            dr = (data[i] >> 4) - 8 + (dg >> 1)
+            db = (data[i] & 0x0F) - 8 + (dg >> 1)
+            i += 1
+            r, g, b = split(prev)
+            prev = (((r + dr) & 0x1F) << 11) | (((g + dg) & 0x3F) << 5) | ((b + db) & 0x1F)
+            index[hash565(prev)] = prev
+            out.append(prev)
+        elif op >= 0x40:
+            r, g, b = split(prev)
+            r = (r + ((op >> 4) & 3) - 2) & 0x1F
+            g = (g + ((op >> 2) & 3) - 2) & 0x3F
+            b = (b + (op & 3) - 2) & 0x1F
+            prev = (r << 11) | (g << 5) | b
+            index[hash565(prev)] = prev
+            out.append(prev)
+        else:
+            prev = index[op]
+            out.append(prev)
+    return out, i
+
+
+def fnv1a(pixels):
+    h = 0x811C9DC5
+    for p in pixels:
+        for byte in (p & 0xFF, p >> 8):
+            h = ((h ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("PNG input needs Pillow (pip install pillow)")
+    img = Image.open(path).convert("RGB")
+    w, h = img.size
+    rgb = img.tobytes()
+    px = [((rgb[i] & 0xF8) << 8) | ((rgb[i + 1] & 0xFC) << 3) | (rgb[i + 2] >> 3) for i in range(0, len(rgb), 3)]
+    return px, w, h
+
+
+def load_raw(path, size):
+    w, h = (int(v) for v in size.lower().split("x"))
+    data = open(path, "rb").read()
+    if len(data) != w * h * 2:
+        sys.exit("%s: %d bytes, expected %d for %dx%d" % (path, len(data), w * h * 2, w, h))
+    return list(struct.unpack("<%dH" % (w * h), data)), w, h
+
+
+def write_header(path, name, w, h, data, checksum, source):
+    lines = []
+    lines.append("/// @file    image_%s.hpp" % name)
+    lines.append("/// @brief   %dx%d RGB565 image (%s), Q565 coded" % (w, h, source))
+    lines.append("/// @note    generated by tools/imgconv.py, do not edit: %d bytes coded"
+                 " (%d bytes raw)" % (len(data), w * h * 2))
+    lines.append("#pragma once")
+    lines.append('#include "image.hpp"')
+    lines.append("")
+    lines.append("namespace gfx::images {")
+    lines.append("")
+    lines.append("    inline constexpr uint8_t %s_q565[] = {" % name)
+    for i in range(0, len(data), 16):
+        lines.append("        " + ", ".join("0x%02X" % v for v in data[i:i + 16]) + ",")
+    lines.append("    };")
+    lines.append("")
+    lines.append("    inline constexpr Image %s = {%d, %d, %s_q565, sizeof(%s_q565), 0x%08X};"
+                 % (name, w, h, name, name, checksum))
+    lines.append("")
+    lines.append("} // namespace gfx::images")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--name", required=True, help="C++ identifier of the image")
+    ap.add_argument("--raw", metavar="WxH", help="input is raw little-endian RGB565 of this size")
+    ap.add_argument("input")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    if args.raw:
+        pixels, w, h = load_raw(args.input, args.raw)
+    else:
+        pixels, w, h = load_png(args.input)
+    if w > 0xFFFF or h > 0xFFFF:
+        sys.exit("image too large")
+    data = encode(pixels)
+    check, used = decode(data, len(pixels))
+    if check != pixels or used != len(data):
+        sys.exit("internal error: round trip mismatch")
+    write_header(args.output, args.name, w, h, data, fnv1a(pixels), args.input.split("/")[-1])
+    print("%s: %dx%d, %d bytes coded (%d bytes raw, %.1f%%)"
+          % (args.output, w, h, len(data), w * h * 2, 100.0 * len(data) / (w * h * 2)))
+
+
+if __name__ == "__main__":
+    main()